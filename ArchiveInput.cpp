@@ -0,0 +1,574 @@
+#include <ArchiveInput.hpp>
+#include <LocalInput.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/utility/string_view.hpp>
+
+#ifdef HTML_ANALYZER_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HTML_ANALYZER_ZSTD
+#include <zstd.h>
+#endif
+
+namespace {
+    // Pages handed over at a time, and bytes decompressed at a time by the
+    // streaming decoders
+    const size_t kBatchBytes = 64 * 1024 * 1024;
+    const size_t kBlockBytes = 1024 * 1024;
+
+    const size_t kTarBlockBytes = 512;
+
+    enum class Compression { None, Gzip, Zstd };
+
+    // Cuts the decompressed bytes of an archive into pages
+    class PageSplitter {
+    public:
+        virtual ~PageSplitter() {}
+
+        virtual void feed(const char * data, size_t size) = 0;
+        // End of the decompressed bytes; false, with error set, if the
+        // archive was cut short
+        virtual bool finish(std::string & error) = 0;
+
+        std::vector<ArchiveMember> & members() { return m_members; }
+        // Of the pages not handed over yet
+        size_t memberBytes() const { return m_memberBytes; }
+        void clearMembers()
+        {
+            m_members.clear();
+            m_memberBytes = 0;
+        }
+
+    protected:
+        void addMember(std::string name, std::shared_ptr<std::string> data)
+        {
+            m_memberBytes += data->size();
+            m_members.push_back(ArchiveMember{std::move(name), std::move(data)});
+        }
+
+        std::vector<ArchiveMember> m_members;
+        size_t m_memberBytes = 0;
+    };
+
+    // A compressed page on its own (page.html.gz): one page of everything
+    class SinglePage final : public PageSplitter {
+    public:
+        explicit SinglePage(std::string name) : m_name(std::move(name)), m_data(new std::string) {}
+
+        void feed(const char * data, size_t size) override
+        {
+            m_data->append(data, size);
+        }
+
+        bool finish(std::string &) override
+        {
+            addMember(m_name, std::move(m_data));
+            return true;
+        }
+
+    private:
+        const std::string m_name;
+        std::shared_ptr<std::string> m_data;
+    };
+
+    // Members of a tar archive (POSIX ustar, with GNU long names and pax
+    // path records), as the bytes come: a 512-byte header, then the data
+    // padded to 512 bytes. Only regular files are pages.
+    class TarSplitter final : public PageSplitter {
+    public:
+        TarSplitter(std::string archiveName, const std::vector<std::string> & extensions)
+            : m_archiveName(std::move(archiveName)), m_extensions(extensions)
+        {
+        }
+
+        void feed(const char * p, size_t size) override;
+
+        bool finish(std::string & error) override
+        {
+            if (!m_error.empty())
+                error = m_error;
+            else if (!m_ended && (m_remaining != 0 || !m_header.empty()))
+                error = "archive is truncated";
+            return error.empty();
+        }
+
+    private:
+        enum class Entry { Page, LongName, PaxHeader, Skipped };
+
+        void startEntry();
+        void endEntry();
+
+        const std::string m_archiveName;
+        const std::vector<std::string> & m_extensions;
+        std::string m_header;               // bytes of the header being read
+        Entry m_entry = Entry::Skipped;
+        std::string m_name;                 // of the page being read
+        std::shared_ptr<std::string> m_data;    // of the entry being read, unless skipped
+        std::string m_nextName;             // from a long name or pax entry, for the next header
+        uint64_t m_remaining = 0;           // data bytes of the entry still to come
+        uint64_t m_padding = 0;             // then padding bytes
+        bool m_ended = false;               // at the end-of-archive block, or stopped by an error
+        std::string m_error;
+    };
+
+    /**
+     * Reads a numeric tar header field: octal digits, or base-256 when the
+     * first byte has its top bit set (GNU, for sizes of 8 GB and more)
+     *
+     * @param field     start of the field
+     * @param length    field width
+     * @return the value
+     */
+    uint64_t tarNumber(const char * field, size_t length)
+    {
+        uint64_t value = 0;
+        if (static_cast<unsigned char>(field[0]) & 0x80) {
+            for (size_t i = 1; i < length; ++i)
+                value = (value << 8) | static_cast<unsigned char>(field[i]);
+            return value;
+        }
+        for (size_t i = 0; i < length && field[i] != '\0'; ++i) {
+            if (field[i] >= '0' && field[i] <= '7')
+                value = value * 8 + (field[i] - '0');
+        }
+        return value;
+    }
+
+    // A NUL-padded header field as a string
+    std::string tarString(const char * field, size_t length)
+    {
+        return std::string(field, std::find(field, field + length, '\0'));
+    }
+
+    /**
+     * Takes decompressed bytes: completes the current header, copies the
+     * data of pages into their buffers and steps over everything else
+     *
+     * @param p     next decompressed bytes
+     * @param size  number of bytes
+     */
+    void TarSplitter::feed(const char * p, size_t size)
+    {
+        const char * const end = p + size;
+        while (p < end && !m_ended) {
+            if (m_remaining != 0) {
+                const size_t take = static_cast<size_t>(std::min<uint64_t>(m_remaining, end - p));
+                if (m_data)
+                    m_data->append(p, take);
+                p += take;
+                m_remaining -= take;
+                if (m_remaining == 0)
+                    endEntry();
+            } else if (m_padding != 0) {
+                const size_t take = static_cast<size_t>(std::min<uint64_t>(m_padding, end - p));
+                p += take;
+                m_padding -= take;
+            } else {
+                const size_t take = std::min(kTarBlockBytes - m_header.size(), static_cast<size_t>(end - p));
+                m_header.append(p, take);
+                p += take;
+                if (m_header.size() == kTarBlockBytes) {
+                    startEntry();
+                    m_header.clear();
+                }
+            }
+        }
+    }
+
+    // Starts the entry of the complete header in m_header
+    void TarSplitter::startEntry()
+    {
+        const char * const header = m_header.data();
+        if (std::all_of(header, header + kTarBlockBytes, [](char c) { return c == '\0'; })) {
+            m_ended = true;
+            return;
+        }
+
+        // The checksum field counts as spaces
+        uint64_t sum = 0;
+        for (size_t i = 0; i < kTarBlockBytes; ++i)
+            sum += (i >= 148 && i < 156) ? ' ' : static_cast<unsigned char>(header[i]);
+        if (sum != tarNumber(header + 148, 8)) {
+            m_error = "not a tar archive, or corrupt";
+            m_ended = true;
+            return;
+        }
+
+        const uint64_t size = tarNumber(header + 124, 12);
+        const char type = header[156];
+        // Extension headers (long names, pax records, GNU long link names,
+        // global pax records) leave a pending name for the entry they describe
+        const bool extension = type == 'L' || type == 'x' || type == 'K' || type == 'g';
+        std::string name;
+        if (!m_nextName.empty() && !extension) {
+            name.swap(m_nextName);
+        } else {
+            name = tarString(header, 100);
+            // Only POSIX ustar has a name prefix; in GNU headers ("ustar  ")
+            // those bytes hold access and change times
+            const std::string prefix = tarString(header + 345, 155);
+            if (std::memcmp(header + 257, "ustar\0", 6) == 0 && !prefix.empty())
+                name = prefix + '/' + name;
+        }
+
+        m_data.reset();
+        if (type == 'L') {
+            m_entry = Entry::LongName;
+        } else if (type == 'x') {
+            m_entry = Entry::PaxHeader;
+        } else if ((type == '0' || type == '\0' || type == '7') && hasInputExtension(name, m_extensions)) {
+            m_entry = Entry::Page;
+            m_name = m_archiveName + ':' + name;
+        } else {
+            // Directories, links, global pax headers and pages not taken
+            m_entry = Entry::Skipped;
+        }
+        // Entries are held whole, so one larger than a batch would break
+        // the memory bound of a batch
+        if (m_entry != Entry::Skipped && size > kBatchBytes) {
+            std::cerr << m_archiveName << ':' << name << " skipped, " << size << " bytes > "
+                      << kBatchBytes / (1024 * 1024) << " MB" << std::endl;
+            m_entry = Entry::Skipped;
+        }
+        if (m_entry != Entry::Skipped) {
+            m_data = std::make_shared<std::string>();
+            m_data->reserve(static_cast<size_t>(size));
+        }
+
+        m_remaining = size;
+        m_padding = (kTarBlockBytes - size % kTarBlockBytes) % kTarBlockBytes;
+        if (size == 0)
+            endEntry();
+    }
+
+    // Ends the entry whose data was just read
+    void TarSplitter::endEntry()
+    {
+        if (m_entry == Entry::Page) {
+            addMember(std::move(m_name), std::move(m_data));
+        } else if (m_entry == Entry::LongName) {
+            m_nextName = tarString(m_data->data(), m_data->size());
+        } else if (m_entry == Entry::PaxHeader) {
+            // Records of "<length> <key>=<value>\n"; only the path is used
+            boost::string_view records(*m_data);
+            while (!records.empty()) {
+                const size_t space = records.find(' ');
+                const uint64_t length = std::strtoull(records.substr(0, space).to_string().c_str(), nullptr, 10);
+                if (space == boost::string_view::npos || length <= space || length > records.size())
+                    break;
+                const boost::string_view record = records.substr(space + 1, length - space - 2);
+                if (record.starts_with("path="))
+                    m_nextName = record.substr(5).to_string();
+                records.remove_prefix(length);
+            }
+        }
+        m_data.reset();
+    }
+
+    /**
+     * How a file is compressed, and whether it holds a tar archive, from
+     * its name
+     *
+     * @param path          archive path
+     * @param isTar         set for tar archives
+     * @param pageName      name of the page of a compressed single page
+     * @return the compression
+     */
+    Compression archiveFormat(const std::string & path, bool & isTar, std::string & pageName)
+    {
+        using boost::algorithm::iends_with;
+        Compression compression = Compression::None;
+        size_t suffix = 0;
+        if (iends_with(path, ".gz") || iends_with(path, ".tgz")) {
+            compression = Compression::Gzip;
+            suffix = iends_with(path, ".gz") ? 3 : 4;
+        } else if (iends_with(path, ".zst") || iends_with(path, ".tzst")) {
+            compression = Compression::Zstd;
+            suffix = iends_with(path, ".zst") ? 4 : 5;
+        }
+        isTar = iends_with(path, ".tar") || iends_with(path, ".tar.gz") || iends_with(path, ".tgz")
+                || iends_with(path, ".tar.zst") || iends_with(path, ".tzst");
+        pageName = path.substr(0, path.size() - suffix);
+        return compression;
+    }
+
+    // Decompresses one archive into its splitter, handing the pages over
+    // whenever a batch is complete
+    class ArchiveReader final {
+    public:
+        ArchiveReader(PageSplitter & splitter, const ArchiveBatchHandler & handler, ArchiveStats & stats)
+            : m_splitter(splitter), m_handler(handler), m_stats(stats), m_start(clock::now())
+        {
+        }
+
+        ~ArchiveReader()
+        {
+            m_stats.decompressSeconds += std::chrono::duration<double>(clock::now() - m_start).count();
+        }
+
+        bool readStored(boost::string_view archive, std::string & error);
+        bool readGzip(boost::string_view archive, std::string & error);
+        bool readZstd(boost::string_view archive, unsigned numThreads, std::string & error);
+
+        // Hands over the pages read so far; the handler's time is not
+        // counted as decompression
+        void deliver(bool all)
+        {
+            if (m_splitter.members().empty() || (!all && m_splitter.memberBytes() < kBatchBytes))
+                return;
+            const auto now = clock::now();
+            m_stats.decompressSeconds += std::chrono::duration<double>(now - m_start).count();
+            m_stats.members += m_splitter.members().size();
+            m_handler(m_splitter.members());
+            m_splitter.clearMembers();
+            m_start = clock::now();
+        }
+
+    private:
+        typedef std::chrono::steady_clock clock;
+
+        void feed(const char * data, size_t size)
+        {
+            m_stats.decompressedBytes += size;
+            m_splitter.feed(data, size);
+            deliver(false);
+        }
+
+        PageSplitter & m_splitter;
+        const ArchiveBatchHandler & m_handler;
+        ArchiveStats & m_stats;
+        clock::time_point m_start;
+    };
+
+    /**
+     * Reads an uncompressed archive, in blocks
+     *
+     * @param archive   the mapped archive
+     * @param error     unused
+     * @return true
+     */
+    bool ArchiveReader::readStored(boost::string_view archive, std::string &)
+    {
+        for (size_t offset = 0; offset < archive.size(); offset += kBlockBytes)
+            feed(archive.data() + offset, std::min(kBlockBytes, archive.size() - offset));
+        return true;
+    }
+
+    /**
+     * Inflates a gzip file, one block at a time. Concatenated gzip members
+     * (as written by parallel compressors) are read one after the other.
+     *
+     * @param archive   the mapped archive
+     * @param error     receives zlib's message on failure
+     * @return false if the data is corrupt or cut short
+     */
+    bool ArchiveReader::readGzip(boost::string_view archive, std::string & error)
+    {
+#ifdef HTML_ANALYZER_ZLIB
+        z_stream stream;
+        std::memset(&stream, 0, sizeof(stream));
+        // 32: gzip or zlib header, detected
+        if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+            error = "cannot initialize zlib";
+            return false;
+        }
+        std::unique_ptr<char[]> block(new char[kBlockBytes]);
+        const char * input = archive.data();
+        size_t inputLeft = archive.size();
+        int result = Z_OK;
+        for (;;) {
+            if (stream.avail_in == 0 && inputLeft != 0) {
+                // avail_in is 32 bits wide
+                const size_t take = std::min<size_t>(inputLeft, 1u << 30);
+                stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input));
+                stream.avail_in = static_cast<uInt>(take);
+                input += take;
+                inputLeft -= take;
+            }
+            stream.next_out = reinterpret_cast<Bytef *>(block.get());
+            stream.avail_out = static_cast<uInt>(kBlockBytes);
+            result = inflate(&stream, Z_NO_FLUSH);
+            if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR)
+                break;
+            feed(block.get(), kBlockBytes - stream.avail_out);
+            if (result == Z_STREAM_END) {
+                if (stream.avail_in == 0 && inputLeft == 0)
+                    break;
+                inflateReset(&stream);
+            } else if (result == Z_BUF_ERROR && stream.avail_in == 0 && inputLeft == 0) {
+                break;
+            }
+        }
+        if (result != Z_STREAM_END)
+            error = stream.msg ? stream.msg : "gzip stream is truncated";
+        inflateEnd(&stream);
+        return result == Z_STREAM_END;
+#else
+        (void)archive;
+        error = "built without zlib (HTML_ANALYZER_ZLIB)";
+        return false;
+#endif
+    }
+
+    /**
+     * Decompresses a zstd file. Frames are independent, so consecutive
+     * frames whose size is known are decompressed in parallel, a batch at
+     * a time, and fed in order; a frame of unknown or batch-exceeding size
+     * is streamed one block at a time.
+     *
+     * @param archive       the mapped archive
+     * @param numThreads    threads decompressing frames
+     * @param error         receives zstd's message on failure
+     * @return false if the data is corrupt or cut short
+     */
+    bool ArchiveReader::readZstd(boost::string_view archive, unsigned numThreads, std::string & error)
+    {
+#ifdef HTML_ANALYZER_ZSTD
+        std::vector<boost::string_view> frames;
+        for (size_t offset = 0; offset < archive.size(); ) {
+            const size_t size = ZSTD_findFrameCompressedSize(archive.data() + offset, archive.size() - offset);
+            if (ZSTD_isError(size)) {
+                error = ZSTD_getErrorName(size);
+                return false;
+            }
+            frames.push_back(archive.substr(offset, size));
+            offset += size;
+        }
+
+        auto contentSize = [](boost::string_view frame) {
+            return ZSTD_getFrameContentSize(frame.data(), frame.size());
+        };
+        auto fitsBatch = [](unsigned long long size) {
+            return size != ZSTD_CONTENTSIZE_UNKNOWN && size != ZSTD_CONTENTSIZE_ERROR && size <= kBatchBytes;
+        };
+
+        std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx *)> context(ZSTD_createDCtx(), ZSTD_freeDCtx);
+        std::unique_ptr<char[]> block(new char[kBlockBytes]);
+        for (size_t first = 0; first < frames.size(); ) {
+            if (!fitsBatch(contentSize(frames[first]))) {
+                ZSTD_DCtx_reset(context.get(), ZSTD_reset_session_only);
+                ZSTD_inBuffer in = { frames[first].data(), frames[first].size(), 0 };
+                size_t result = 1;
+                while (result != 0) {
+                    ZSTD_outBuffer out = { block.get(), kBlockBytes, 0 };
+                    result = ZSTD_decompressStream(context.get(), &out, &in);
+                    if (ZSTD_isError(result)) {
+                        error = ZSTD_getErrorName(result);
+                        return false;
+                    }
+                    if (result != 0 && in.pos == in.size && out.pos == 0) {
+                        error = "zstd frame is truncated";
+                        return false;
+                    }
+                    feed(block.get(), out.pos);
+                }
+                ++first;
+                continue;
+            }
+
+            size_t last = first;
+            unsigned long long batchBytes = 0;
+            while (last < frames.size() && fitsBatch(contentSize(frames[last]))
+                   && (last == first || batchBytes + contentSize(frames[last]) <= kBatchBytes)) {
+                batchBytes += contentSize(frames[last]);
+                ++last;
+            }
+
+            std::vector<std::string> outputs(last - first);
+            std::vector<size_t> results(last - first);
+            #pragma omp parallel num_threads(numThreads)
+            {
+                ZSTD_DCtx * frameContext = ZSTD_createDCtx();
+                #pragma omp for schedule(dynamic)
+                for (int i = 0; i < static_cast<int>(outputs.size()); ++i) {
+                    const boost::string_view frame = frames[first + i];
+                    outputs[i].resize(static_cast<size_t>(contentSize(frame)));
+                    results[i] = ZSTD_decompressDCtx(frameContext, &outputs[i][0], outputs[i].size(),
+                                                     frame.data(), frame.size());
+                }
+                ZSTD_freeDCtx(frameContext);
+            }
+            for (size_t i = 0; i < outputs.size(); ++i) {
+                if (ZSTD_isError(results[i])) {
+                    error = ZSTD_getErrorName(results[i]);
+                    return false;
+                }
+                feed(outputs[i].data(), results[i]);
+            }
+            first = last;
+        }
+        return true;
+#else
+        (void)archive;
+        (void)numThreads;
+        error = "built without zstd (HTML_ANALYZER_ZSTD)";
+        return false;
+#endif
+    }
+}
+
+/**
+ * Reads the archives in turn: each is mapped, decompressed by the reader
+ * for its format, split into pages, and its pages handed over in batches.
+ * Decompression of the next batch waits for the handler, so the time
+ * reported is that of decompressing and splitting alone.
+ *
+ * @param paths         archives to read
+ * @param extensions    extensions of the tar members to take; empty for all
+ * @param numThreads    threads for multi-frame zstd
+ * @param handler       receives the batches of pages
+ * @return bytes read and decompressed, pages handed over, and time spent
+ */
+ArchiveStats streamArchives(const std::vector<std::string> & paths, const std::vector<std::string> & extensions,
+                            unsigned numThreads, const ArchiveBatchHandler & handler)
+{
+    ArchiveStats stats;
+    for (const std::string & path : paths) {
+        bool isTar = false;
+        std::string pageName;
+        const Compression compression = archiveFormat(path, isTar, pageName);
+
+        std::string error;
+        MappedFile file;
+        if (!file.open(path, error)) {
+            std::cerr << "Cannot read " << path << ": " << error << std::endl;
+            continue;
+        }
+        stats.compressedBytes += file.view().size();
+
+        std::unique_ptr<PageSplitter> splitter;
+        if (isTar)
+            splitter.reset(new TarSplitter(path, extensions));
+        else
+            splitter.reset(new SinglePage(pageName));
+
+        bool ok = false;
+        {
+            ArchiveReader reader(*splitter, handler, stats);
+            switch (compression) {
+            case Compression::None: ok = reader.readStored(file.view(), error); break;
+            case Compression::Gzip: ok = reader.readGzip(file.view(), error); break;
+            case Compression::Zstd: ok = reader.readZstd(file.view(), numThreads, error); break;
+            }
+            // A corrupt archive's complete pages are kept; a partial single
+            // page is not
+            std::string splitError;
+            if ((ok || isTar) && !splitter->finish(splitError) && ok) {
+                ok = false;
+                error = splitError;
+            }
+            reader.deliver(true);
+        }
+        if (!ok)
+            std::cerr << "Cannot read " << path << ": " << error << std::endl;
+    }
+    return stats;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <PageBuffer.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Compressed corpora as input: tar archives (.tar, .tar.gz / .tgz,
+// .tar.zst / .tzst) and single compressed pages (.gz, .zst). Archives are
+// decompressed in memory and their pages handed over in batches of about
+// 64 MB, so nothing is written to disk uncompressed and memory stays
+// around one batch whatever the size of the archive: tar members larger
+// than a batch are skipped and reported on std::cerr. A single compressed
+// page is held whole. gzip needs zlib (HTML_ANALYZER_ZLIB), zstd needs
+// libzstd (HTML_ANALYZER_ZSTD).
+
+// One page out of an archive
+struct ArchiveMember {
+    std::string name;       // "corpus.tar.zst:dir/page.html"
+    PageBuffer data;
+};
+
+struct ArchiveStats {
+    uint64_t compressedBytes = 0;       // of the archives read
+    uint64_t decompressedBytes = 0;     // tar headers and members not taken included
+    uint64_t members = 0;               // pages handed over
+    double decompressSeconds = 0;       // wall-clock, decompressing and splitting
+};
+
+// Receives each batch of pages, in archive order
+typedef std::function<void(std::vector<ArchiveMember> & members)> ArchiveBatchHandler;
+
+// Streams the pages out of the archives, one archive after the other. Of
+// tar archives only the members whose extension is one of extensions
+// (empty for all) are taken. The frames of multi-frame zstd files are
+// decompressed by up to numThreads threads at once; a gzip stream or a
+// single zstd frame is decompressed by one thread. Archives that cannot be
+// read are reported on std::cerr, keeping the pages read before the error.
+ArchiveStats streamArchives(const std::vector<std::string> & paths, const std::vector<std::string> & extensions,
+                            unsigned numThreads, const ArchiveBatchHandler & handler);
@@ -0,0 +1,198 @@
+#include <CertVerifier.hpp>
+
+#include <algorithm>
+#include <memory>
+
+#include <openssl/evp.h>
+#include <openssl/ocsp.h>
+#include <openssl/x509v3.h>
+
+namespace {
+    const std::chrono::hours kChainCacheTtl(1);
+    // Clock skew tolerated when checking an OCSP response's validity window
+    const long kOcspMaxSkewSeconds = 300;
+
+    std::string sha256(const unsigned char * data, size_t size)
+    {
+        unsigned char md[EVP_MAX_MD_SIZE];
+        unsigned int length = 0;
+        EVP_Digest(data, size, md, &length, EVP_sha256(), nullptr);
+        return std::string(reinterpret_cast<const char *>(md), length);
+    }
+
+    std::string fingerprint(X509 * cert)
+    {
+        unsigned char md[EVP_MAX_MD_SIZE];
+        unsigned int length = 0;
+        X509_digest(cert, EVP_sha256(), md, &length);
+        return std::string(reinterpret_cast<const char *>(md), length);
+    }
+
+    std::chrono::system_clock::time_point toTimePoint(const ASN1_TIME * time)
+    {
+        const auto now = std::chrono::system_clock::now();
+        int days = 0;
+        int seconds = 0;
+        if (!time || !ASN1_TIME_diff(&days, &seconds, nullptr, time))
+            return now;
+        return now + std::chrono::hours(24) * days + std::chrono::seconds(seconds);
+    }
+
+    struct OcspResponseFree { void operator()(OCSP_RESPONSE * r) const { OCSP_RESPONSE_free(r); } };
+    struct OcspBasicFree { void operator()(OCSP_BASICRESP * r) const { OCSP_BASICRESP_free(r); } };
+    struct OcspCertIdFree { void operator()(OCSP_CERTID * id) const { OCSP_CERTID_free(id); } };
+}
+
+CertVerifier::CertVerifier(ssl::context & ctx)
+    : m_ctx(ctx.native_handle())
+    , m_verifiedChains(kMaxCachedEntries)
+    , m_ocspResponses(kMaxCachedEntries)
+{
+    ctx.set_verify_mode(ssl::verify_peer);
+    SSL_CTX_set_cert_verify_callback(m_ctx, &CertVerifier::verifyChain, this);
+    SSL_CTX_set_tlsext_status_cb(m_ctx, &CertVerifier::checkOcspStaple);
+    SSL_CTX_set_tlsext_status_arg(m_ctx, this);
+}
+
+/**
+ * Sets the host name the peer certificate must match and requests OCSP
+ * stapling. Must be called before the handshake.
+ *
+ * @param ssl   connection
+ * @param host  host name from the url (also sent as SNI)
+ */
+void CertVerifier::prepare(SSL * ssl, const std::string & host)
+{
+    SSL_set_tlsext_host_name(ssl, host.c_str());
+    SSL_set_hostflags(ssl, X509_CHECK_FLAG_NO_PARTIAL_WILDCARDS);
+    SSL_set1_host(ssl, host.c_str());
+    SSL_set_tlsext_status_type(ssl, TLSEXT_STATUSTYPE_ocsp);
+}
+
+/**
+ * Chain verification callback replacing OpenSSL's default. Consults the
+ * cache of verified (leaf, host) pairs before running X509_verify_cert,
+ * which also checks the host name set by prepare().
+ *
+ * @return 1 if the chain is trusted for the host, otherwise <= 0
+ */
+int CertVerifier::verifyChain(X509_STORE_CTX * storeCtx, void * arg)
+{
+    auto self = static_cast<CertVerifier *>(arg);
+    auto ssl = static_cast<SSL *>(X509_STORE_CTX_get_ex_data(storeCtx, SSL_get_ex_data_X509_STORE_CTX_idx()));
+    const char * host = ssl ? SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name) : nullptr;
+    const std::string key = fingerprint(X509_STORE_CTX_get0_cert(storeCtx)) + '|' + (host ? host : "");
+    const auto now = clock::now();
+    {
+        std::lock_guard<std::mutex> lock(self->m_mutex);
+        if (const clock::time_point * expiry = self->m_verifiedChains.find(key)) {
+            if (now < *expiry) {
+                ++self->m_stats.chainCacheHits;
+                X509_STORE_CTX_set_error(storeCtx, X509_V_OK);
+                return 1;
+            }
+            self->m_verifiedChains.erase(key);
+        }
+    }
+
+    const int ok = X509_verify_cert(storeCtx);
+
+    std::lock_guard<std::mutex> lock(self->m_mutex);
+    if (ok != 1) {
+        ++self->m_stats.chainFailures;
+        return ok;
+    }
+    ++self->m_stats.chainsVerified;
+    auto expiry = now + kChainCacheTtl;
+    STACK_OF(X509) * chain = X509_STORE_CTX_get0_chain(storeCtx);
+    for (int i = 0; i < sk_X509_num(chain); ++i)
+        expiry = std::min(expiry, toTimePoint(X509_get0_notAfter(sk_X509_value(chain, i))));
+    self->m_verifiedChains.insert(key, expiry);
+    return 1;
+}
+
+int CertVerifier::checkOcspStaple(SSL * ssl, void * arg)
+{
+    return static_cast<CertVerifier *>(arg)->checkStaple(ssl);
+}
+
+/**
+ * OCSP status callback, run after chain verification. A response that
+ * cannot be used (missing, malformed, unverifiable, stale) is ignored.
+ *
+ * @return 0 to abort the handshake (revoked), 1 to continue
+ */
+int CertVerifier::checkStaple(SSL * ssl)
+{
+    unsigned char * der = nullptr;
+    const long derLength = SSL_get_tlsext_status_ocsp_resp(ssl, &der);
+    STACK_OF(X509) * peerChain = SSL_get_peer_cert_chain(ssl);
+    if (!der || derLength <= 0 || !peerChain || sk_X509_num(peerChain) == 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.ocspMissing;
+        return 1;
+    }
+
+    X509 * leaf = sk_X509_value(peerChain, 0);
+    const std::string leafKey = fingerprint(leaf);
+    const std::string digest = sha256(der, static_cast<size_t>(derLength));
+    const auto now = clock::now();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (const OcspEntry * entry = m_ocspResponses.find(leafKey)) {
+            if (now >= entry->nextUpdate) {
+                m_ocspResponses.erase(leafKey);
+            } else if (entry->responseDigest == digest) {
+                ++m_stats.ocspCacheHits;
+                return 1;
+            }
+        }
+    }
+
+    auto unusable = [this]() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.ocspMissing;
+        return 1;
+    };
+
+    const unsigned char * p = der;
+    std::unique_ptr<OCSP_RESPONSE, OcspResponseFree> response(d2i_OCSP_RESPONSE(nullptr, &p, derLength));
+    if (!response || OCSP_response_status(response.get()) != OCSP_RESPONSE_STATUS_SUCCESSFUL)
+        return unusable();
+    std::unique_ptr<OCSP_BASICRESP, OcspBasicFree> basic(OCSP_response_get1_basic(response.get()));
+    if (!basic || OCSP_basic_verify(basic.get(), peerChain, SSL_CTX_get_cert_store(m_ctx), 0) <= 0)
+        return unusable();
+
+    X509 * issuer = nullptr;
+    for (int i = 1; i < sk_X509_num(peerChain) && !issuer; ++i)
+        if (X509_check_issued(sk_X509_value(peerChain, i), leaf) == X509_V_OK)
+            issuer = sk_X509_value(peerChain, i);
+    if (!issuer)
+        return unusable();
+
+    std::unique_ptr<OCSP_CERTID, OcspCertIdFree> id(OCSP_cert_to_id(nullptr, leaf, issuer));
+    int status = 0;
+    int reason = 0;
+    ASN1_GENERALIZEDTIME * revokedAt = nullptr;
+    ASN1_GENERALIZEDTIME * thisUpdate = nullptr;
+    ASN1_GENERALIZEDTIME * nextUpdate = nullptr;
+    if (!id || !OCSP_resp_find_status(basic.get(), id.get(), &status, &reason, &revokedAt, &thisUpdate, &nextUpdate)
+        || !OCSP_check_validity(thisUpdate, nextUpdate, kOcspMaxSkewSeconds, -1))
+        return unusable();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (status == V_OCSP_CERTSTATUS_REVOKED) {
+        ++m_stats.ocspRevoked;
+        return 0;
+    }
+    ++m_stats.ocspVerified;
+    if (status == V_OCSP_CERTSTATUS_GOOD && nextUpdate)
+        m_ocspResponses.insert(leafKey, OcspEntry{digest, toTimePoint(nextUpdate)});
+    return 1;
+}
+
+CertVerifier::Stats CertVerifier::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
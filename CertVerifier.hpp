@@ -0,0 +1,118 @@
+#pragma once
+
+#include <GetUrlContent.hpp>
+
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// Map from string keys with a bound on its size: inserting into a full
+// cache evicts the least recently used entry
+template <class Value>
+class LruCache final {
+public:
+    explicit LruCache(size_t capacity) : m_capacity(capacity) {}
+
+    // The entry, now the most recently used, or nullptr
+    Value * find(const std::string & key)
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            return nullptr;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &it->second->second;
+    }
+
+    void insert(const std::string & key, Value value)
+    {
+        if (Value * existing = find(key)) {
+            *existing = std::move(value);
+            return;
+        }
+        if (m_entries.size() >= m_capacity) {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+        m_entries.emplace_front(key, std::move(value));
+        m_index.emplace(key, m_entries.begin());
+    }
+
+    void erase(const std::string & key)
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            return;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+
+    size_t size() const { return m_entries.size(); }
+
+private:
+    typedef std::list<std::pair<std::string, Value>> Entries;
+
+    size_t m_capacity;
+    Entries m_entries;      // most recently used first
+    std::unordered_map<std::string, typename Entries::iterator> m_index;
+};
+
+// Peer certificate verification (chain and hostname) for all connections
+// made with one SSL context, with two caches so that verification costs
+// next to nothing on repeat hosts:
+//  - verified chains, keyed by the SHA-256 fingerprint of the leaf
+//    certificate and the expected host name. A hit skips chain building
+//    and signature checks; the handshake still proves the server holds the
+//    leaf's private key. Entries expire after an hour or when any
+//    certificate of the chain expires, whichever comes first.
+//  - stapled OCSP responses, keyed by leaf fingerprint. A response that is
+//    byte-identical to one already verified and still before its
+//    nextUpdate is accepted without parsing or checking its signature.
+// Expired entries are dropped when found, and each cache keeps at most
+// kMaxCachedEntries, evicting the least recently used, so a crawl over
+// millions of hosts does not grow them without bound.
+// A stapled "revoked" status fails the handshake; no staple is accepted
+// (soft-fail, like browsers).
+class CertVerifier final {
+public:
+    static const size_t kMaxCachedEntries = 16384;
+
+    explicit CertVerifier(ssl::context & ctx);
+    CertVerifier(const CertVerifier &) = delete;
+    CertVerifier & operator=(const CertVerifier &) = delete;
+
+    // Per connection, before the handshake: expected host name, and ask the
+    // server to staple an OCSP response
+    void prepare(SSL * ssl, const std::string & host);
+
+    struct Stats {
+        unsigned chainsVerified = 0;
+        unsigned chainCacheHits = 0;
+        unsigned chainFailures = 0;
+        unsigned ocspVerified = 0;
+        unsigned ocspCacheHits = 0;
+        unsigned ocspMissing = 0;
+        unsigned ocspRevoked = 0;
+    };
+    Stats stats() const;
+
+private:
+    typedef std::chrono::system_clock clock;
+
+    struct OcspEntry {
+        std::string responseDigest;
+        clock::time_point nextUpdate;
+    };
+
+    static int verifyChain(X509_STORE_CTX * storeCtx, void * arg);
+    static int checkOcspStaple(SSL * ssl, void * arg);
+    int checkStaple(SSL * ssl);
+
+    SSL_CTX * m_ctx;
+    mutable std::mutex m_mutex;
+    LruCache<clock::time_point> m_verifiedChains;   // expiry
+    LruCache<OcspEntry> m_ocspResponses;
+    Stats m_stats;
+};
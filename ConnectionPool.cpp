@@ -0,0 +1,273 @@
+#include <ConnectionPool.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    // Servers typically drop idle keep-alive connections after 5-60 seconds
+    const std::chrono::seconds kIdleTimeout(30);
+    const size_t kMaxIdlePerOrigin = 8;
+
+    // asio keeps its verify callbacks in the app data slots of SSL and
+    // SSL_CTX, so the pool uses ex data indices of its own
+    int poolIndex() {
+        static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+        return index;
+    }
+    int originIndex() {
+        static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+        return index;
+    }
+}
+
+SSL * PooledConnection::nativeHandle()
+{
+    return fdStream ? fdStream->native_handle() : sslSocket->native_handle();
+}
+
+std::shared_ptr<ConnectionPool> ConnectionPool::create(const FetchOptions & options)
+{
+    return std::shared_ptr<ConnectionPool>(new ConnectionPool(options));
+}
+
+ConnectionPool::ConnectionPool(const FetchOptions & options)
+    : m_options(options)
+    // The SSL context is required, and holds certificates
+    , m_ctx(ssl::context::sslv23_client)
+{
+    if (!options.proxy.empty()) {
+        auto colon = options.proxy.find_last_of(':');
+        m_proxyHost = options.proxy.substr(0, colon);
+        m_proxyPort = (colon != std::string::npos) ? options.proxy.substr(colon + 1) : "8080";
+        boost::algorithm::split(m_noProxy, options.noProxy, [](char c) { return c == ','; });
+        for (std::string & entry : m_noProxy) {
+            boost::algorithm::trim(entry);
+            boost::algorithm::to_lower(entry);
+            if (!entry.empty() && entry.front() == '.')
+                entry.erase(0, 1);
+        }
+        m_noProxy.erase(std::remove(m_noProxy.begin(), m_noProxy.end(), std::string()), m_noProxy.end());
+    }
+
+    // Create a context that uses the default paths for
+    // finding CA certificates.
+    m_ctx.set_default_verify_paths();
+    if (!options.caFile.empty())
+        m_ctx.load_verify_file(options.caFile);
+
+    if (options.verifyPeer) {
+        // Verify the remote server's certificate and host name
+        m_verifier.reset(new CertVerifier(m_ctx));
+    } else {
+        // WARNING: UNSAFE - accepts any certificate (--insecure)
+        m_ctx.set_verify_mode(ssl::verify_none);
+    }
+
+    // Client-side session cache: OpenSSL hands us each new session (for
+    // TLS 1.3 when the ticket arrives after the handshake) and we keep the
+    // latest one per origin.
+    SSL_CTX * ctx = m_ctx.native_handle();
+    SSL_CTX_set_ex_data(ctx, poolIndex(), this);
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, &ConnectionPool::onNewSession);
+}
+
+ConnectionPool::~ConnectionPool()
+{
+    m_idle.clear();
+    for (auto & entry : m_sessions)
+        SSL_SESSION_free(entry.second);
+}
+
+/**
+ * Takes the most recently used idle connection to the origin, dropping
+ * connections that have been idle long enough for the server to close them
+ *
+ * @param origin    "protocol://host:port", see urlOrigin
+ * @return a connection, or nullptr if none is available
+ */
+std::unique_ptr<PooledConnection> ConnectionPool::acquire(const std::string & origin)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_idle.find(origin);
+    if (it == m_idle.end())
+        return nullptr;
+    auto & idle = it->second;
+    while (!idle.empty()) {
+        auto connection = std::move(idle.back());
+        idle.pop_back();
+        if (now - connection->idleSince < kIdleTimeout) {
+            ++m_stats.reused;
+            return connection;
+        }
+    }
+    return nullptr;
+}
+
+void ConnectionPool::release(std::unique_ptr<PooledConnection> connection)
+{
+    connection->idleSince = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto & idle = m_idle[connection->origin];
+    if (idle.size() < kMaxIdlePerOrigin)
+        idle.push_back(std::move(connection));
+}
+
+/**
+ * Connects to the url's origin, through a CONNECT tunnel when a proxy is
+ * configured, and performs the TLS handshake with the origin (inside the
+ * tunnel), offering the origin's cached session for resumption
+ *
+ * @param url_req   parsed url
+ * @return the connected, handshaken connection
+ */
+std::unique_ptr<PooledConnection> ConnectionPool::connect(const UrlReq & url_req)
+{
+    std::unique_ptr<PooledConnection> connection(new PooledConnection());
+    connection->origin = urlOrigin(url_req);
+
+    tcp::socket socket(m_ioc);
+    if (!m_proxyHost.empty() && !bypassesProxy(url_req)) {
+        socket = openTunnel(url_req);
+        connection->tunneled = true;
+    } else {
+        tcp::resolver resolver(m_ioc);
+        auto const results = resolver.resolve(url_req._domain, url_req._port);
+        boost::asio::connect(socket, results);
+    }
+    socket.set_option(tcp::no_delay(true));
+
+    if (m_options.enableKtls) {
+        // asio's ssl::stream feeds OpenSSL through an in-memory BIO pair,
+        // which rules out kernel TLS. Hand OpenSSL the socket itself.
+        connection->socket.reset(new tcp::socket(std::move(socket)));
+        connection->fdStream.reset(new SslFdStream(m_ctx.native_handle(),
+            connection->socket->native_handle(), url_req._domain, true));
+    } else {
+        connection->sslSocket.reset(new ssl_socket(std::move(socket), m_ctx));
+        SSL_set_tlsext_host_name(connection->sslSocket->native_handle(), url_req._domain.c_str());
+    }
+
+    SSL * ssl = connection->nativeHandle();
+    SSL_set_ex_data(ssl, originIndex(), &connection->origin);
+    if (m_verifier)
+        m_verifier->prepare(ssl, url_req._domain);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sessions.find(connection->origin);
+        if (it != m_sessions.end())
+            SSL_set_session(ssl, it->second);
+    }
+
+    // Perform the SSL handshake
+    if (connection->fdStream)
+        connection->fdStream->handshake();
+    else
+        connection->sslSocket->handshake(ssl::stream_base::client);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.created;
+    if (SSL_session_reused(ssl))
+        ++m_stats.resumedSessions;
+    return connection;
+}
+
+/**
+ * Whether the url's host is in the NO_PROXY list: "*", the host itself or
+ * a parent domain of it, each optionally restricted to a port
+ *
+ * @param url_req   parsed url
+ * @return true to connect directly
+ */
+bool ConnectionPool::bypassesProxy(const UrlReq & url_req) const
+{
+    const std::string host = boost::algorithm::to_lower_copy(url_req._domain);
+    for (const std::string & entry : m_noProxy) {
+        if (entry == "*")
+            return true;
+        std::string name = entry;
+        const auto colon = entry.find_last_of(':');
+        // "host:port", but not a bare IPv6 address
+        if (colon != std::string::npos && entry.find(':') == colon) {
+            if (entry.substr(colon + 1) != url_req._port)
+                continue;
+            name = entry.substr(0, colon);
+        }
+        if (host == name || (host.size() > name.size() && boost::algorithm::ends_with(host, name)
+                             && host[host.size() - name.size() - 1] == '.'))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Asks the proxy to open a TCP tunnel to the url's origin
+ *
+ * @param url_req   parsed url of the target
+ * @return socket connected to the proxy, now relaying to the origin
+ */
+tcp::socket ConnectionPool::openTunnel(const UrlReq & url_req)
+{
+    tcp::resolver resolver(m_ioc);
+    auto const results = resolver.resolve(m_proxyHost, m_proxyPort);
+    tcp::socket socket(m_ioc);
+    boost::asio::connect(socket, results);
+
+    const std::string target = url_req._domain + ":" + url_req._port;
+    http::request<http::empty_body> req{http::verb::connect, target, 11};
+    req.set(http::field::host, target);
+    req.set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
+    http::write(socket, req);
+
+    beast::flat_buffer buffer;
+    http::response_parser<http::empty_body> parser;
+    // A successful reply to CONNECT has no body; the tunnel starts right
+    // after the header
+    parser.skip(true);
+    http::read_header(socket, buffer, parser);
+    if (parser.get().result_int() / 100 != 2)
+        throw std::runtime_error("proxy refused CONNECT " + target + ": "
+                                 + std::to_string(parser.get().result_int()));
+    if (buffer.size() != 0)
+        throw std::runtime_error("proxy sent data before the tunnel was established");
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.tunnels;
+    return socket;
+}
+
+void ConnectionPool::storeSession(const std::string & origin, SSL_SESSION * session)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto & slot = m_sessions[origin];
+    if (slot)
+        SSL_SESSION_free(slot);
+    slot = session;
+}
+
+/**
+ * OpenSSL new-session callback
+ *
+ * @return 1 to keep the reference to session, 0 if it was not taken
+ */
+int ConnectionPool::onNewSession(SSL * ssl, SSL_SESSION * session)
+{
+    auto pool = static_cast<ConnectionPool *>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), poolIndex()));
+    auto origin = static_cast<const std::string *>(SSL_get_ex_data(ssl, originIndex()));
+    if (!pool || !origin)
+        return 0;
+    pool->storeSession(*origin, session);
+    return 1;
+}
+
+ConnectionPool::Stats ConnectionPool::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+CertVerifier::Stats ConnectionPool::verificationStats() const
+{
+    return m_verifier ? m_verifier->stats() : CertVerifier::Stats();
+}
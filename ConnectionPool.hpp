@@ -0,0 +1,82 @@
+#pragma once
+
+#include <GetUrlContent.hpp>
+#include <CertVerifier.hpp>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// An established TLS connection to one origin (urlOrigin), either direct or
+// through an HTTP CONNECT tunnel. Holds exactly one of the two TLS stream
+// flavours: asio's ssl::stream, or SslFdStream when kTLS was requested.
+struct PooledConnection {
+    std::string origin;
+    std::unique_ptr<ssl_socket> sslSocket;
+    std::unique_ptr<tcp::socket> socket;        // underlies fdStream
+    std::unique_ptr<SslFdStream> fdStream;
+    std::chrono::steady_clock::time_point idleSince;
+    bool tunneled = false;
+
+    SSL * nativeHandle();
+};
+
+// Keeps idle keep-alive connections per origin for reuse across requests
+// and workers, and caches the last TLS session per origin so that a new
+// connection (or tunnel) to a known origin resumes instead of doing a full
+// handshake. When a forward proxy is configured every new connection is an
+// HTTP CONNECT tunnel through it; tunnels are pooled like direct connections.
+//
+// Owns the SSL context and the io_context used by all pooled sockets.
+class ConnectionPool final {
+public:
+    static std::shared_ptr<ConnectionPool> create(const FetchOptions & options);
+    ~ConnectionPool();
+    ConnectionPool(const ConnectionPool &) = delete;
+    ConnectionPool & operator=(const ConnectionPool &) = delete;
+
+    // An idle connection to the origin, or nullptr if there is none
+    std::unique_ptr<PooledConnection> acquire(const std::string & origin);
+    // Returns a connection that may carry another request
+    void release(std::unique_ptr<PooledConnection> connection);
+    // Opens a new connection (through the proxy if configured) and performs
+    // the TLS handshake, resuming a cached session when possible
+    std::unique_ptr<PooledConnection> connect(const UrlReq & url_req);
+
+    ssl::context & sslContext() { return m_ctx; }
+
+    struct Stats {
+        unsigned created = 0;
+        unsigned reused = 0;
+        unsigned tunnels = 0;
+        unsigned resumedSessions = 0;
+    };
+    Stats stats() const;
+    // All zero when peer verification is off
+    CertVerifier::Stats verificationStats() const;
+
+private:
+    explicit ConnectionPool(const FetchOptions & options);
+
+    bool bypassesProxy(const UrlReq & url_req) const;
+    tcp::socket openTunnel(const UrlReq & url_req);
+    void storeSession(const std::string & origin, SSL_SESSION * session);
+    static int onNewSession(SSL * ssl, SSL_SESSION * session);
+
+    FetchOptions m_options;
+    std::string m_proxyHost;
+    std::string m_proxyPort;
+    std::vector<std::string> m_noProxy;     // lower-case, without leading '.'
+
+    net::io_context m_ioc;
+    ssl::context m_ctx;
+    std::unique_ptr<CertVerifier> m_verifier;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::vector<std::unique_ptr<PooledConnection>>> m_idle;
+    std::map<std::string, SSL_SESSION *> m_sessions;
+    Stats m_stats;
+};
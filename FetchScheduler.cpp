@@ -0,0 +1,309 @@
+#include <FetchScheduler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <omp.h>
+
+namespace {
+    // A request is retried at most this many times after a 429/503 or a
+    // connection error before its (empty) result is accepted.
+    const unsigned kMaxAttempts = 4;
+    const std::chrono::milliseconds kRetryBackoff(250);
+    // Smoothed latency this many times above the best latency seen for a
+    // host is treated like a dropped packet.
+    const double kLatencyCongestionFactor = 3.0;
+    // The best latency is forgotten after this long, so a host that has
+    // become slower for good gets a new baseline (like BBR's min RTT).
+    const std::chrono::seconds kMinLatencyLifetime(10);
+    // EWMA gain for smoothed latency, same as TCP's SRTT (1/8).
+    const double kLatencyGain = 0.125;
+
+    bool isCongestionStatus(unsigned status) {
+        return status == 0 || status == 429 || status == 503;
+    }
+}
+
+AimdController::AimdController(double initialWindow, double maxWindow)
+    : m_window(std::min(initialWindow, maxWindow))
+    , m_ssthresh(maxWindow)
+    , m_maxWindow(maxWindow)
+{
+}
+
+unsigned AimdController::limit() const
+{
+    return std::max(1u, static_cast<unsigned>(std::floor(m_window)));
+}
+
+/**
+ * Records a successful request and grows the window: by one while in slow
+ * start, by 1/window afterwards. A latency spike counts as congestion.
+ *
+ * @param latency   time from sending the request to receiving the response
+ *                  header, which does not depend on the size of the body
+ * @param now       completion time
+ */
+void AimdController::onSuccess(std::chrono::milliseconds latency, clock::time_point now)
+{
+    const double ms = static_cast<double>(latency.count());
+    if (m_minLatencyMs == 0. || ms < m_minLatencyMs || now - m_minLatencyAt > kMinLatencyLifetime) {
+        m_minLatencyMs = std::max(ms, 1.);
+        m_minLatencyAt = now;
+    }
+    m_smoothedLatencyMs = (m_smoothedLatencyMs == 0.)
+        ? ms
+        : (1. - kLatencyGain) * m_smoothedLatencyMs + kLatencyGain * ms;
+
+    if (m_smoothedLatencyMs > kLatencyCongestionFactor * m_minLatencyMs) {
+        onCongestion(now);
+        return;
+    }
+
+    if (m_window < m_ssthresh)
+        m_window += 1.;
+    else
+        m_window += 1. / m_window;
+    m_window = std::min(m_window, m_maxWindow);
+}
+
+/**
+ * Halves the window. Signals arriving within one smoothed round trip of the
+ * previous decrease belong to the same congestion event and are ignored.
+ *
+ * @param now   time the congestion signal was observed
+ */
+void AimdController::onCongestion(clock::time_point now)
+{
+    const auto sinceDecrease = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastDecrease);
+    if (m_lastDecrease != clock::time_point() && sinceDecrease.count() < m_smoothedLatencyMs)
+        return;
+    m_ssthresh = std::max(m_window / 2., 1.);
+    m_window = m_ssthresh;
+    m_lastDecrease = now;
+}
+
+FetchScheduler::FetchScheduler(unsigned numWorkers, unsigned maxPerHost,
+                               const FetchOptions & options)
+    : m_numWorkers(std::max(1u, numWorkers))
+    , m_maxPerHost(std::max(1u, maxPerHost))
+    , m_options(options)
+    , m_pool(PageBufferPool::create())
+    , m_connectionPool(ConnectionPool::create(options))
+{
+}
+
+/**
+ * Fetches all urls, bounded per host by that host's AIMD window and
+ * globally by the number of workers.
+ *
+ * @param urls  full urls to fetch
+ * @return the response bodies, indexed like urls
+ */
+std::vector<PageBuffer> FetchScheduler::fetchAll(const std::vector<std::string> & urls)
+{
+    std::vector<PageBuffer> bodies(urls.size());
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hosts.clear();
+        m_hostOrder.clear();
+        m_nextHost = 0;
+        m_remaining = urls.size();
+        m_bytesFetched = 0;
+        m_ktlsRecvConnections = 0;
+        m_connections = 0;
+        m_bodyBytesCopied = 0;
+        m_contentTypes.assign(urls.size(), std::string());
+        for (size_t i = 0; i < urls.size(); ++i) {
+            UrlReq req;
+            parseUrl(urls[i], req);
+            // Keyed by origin: a pipelined batch goes out on one connection
+            const std::string origin = urlOrigin(req);
+            auto it = m_hosts.find(origin);
+            if (it == m_hosts.end()) {
+                it = m_hosts.emplace(origin, HostState()).first;
+                it->second.aimd = AimdController(2.0, m_maxPerHost);
+                m_hostOrder.push_back(origin);
+            }
+            it->second.pending.push_back({i, 0, clock::time_point()});
+        }
+    }
+
+    #pragma omp parallel num_threads(m_numWorkers)
+    {
+        UrlContentGetter contentGetter(m_options, m_pool, m_connectionPool);
+        std::vector<Job> batch;
+        std::vector<std::string> batchUrls;
+        std::vector<PageBuffer> batchBodies;
+        std::vector<unsigned> statuses;
+        std::vector<std::string> contentTypes;
+        std::string host;
+        while (acquireJobs(batch, host)) {
+            if (batch.size() == 1) {
+                batchBodies.assign(1, contentGetter.getUrlContent(urls[batch[0].index]));
+                statuses.assign(1, contentGetter.getLastStatus());
+                contentTypes.assign(1, contentGetter.getLastContentType());
+            } else {
+                batchUrls.clear();
+                for (const auto & job : batch)
+                    batchUrls.push_back(urls[job.index]);
+                batchBodies = contentGetter.getUrlContentPipelined(batchUrls, statuses, contentTypes);
+            }
+            const auto latency = contentGetter.getLastTimeToFirstByte();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (const auto & body : batchBodies)
+                    m_bytesFetched += body->size();
+            }
+            // Each job is owned by exactly one worker at a time, so the
+            // slots can be written without locking. A retry overwrites them.
+            for (size_t i = 0; i < batch.size(); ++i) {
+                bodies[batch[i].index] = std::move(batchBodies[i]);
+                m_contentTypes[batch[i].index] = std::move(contentTypes[i]);
+            }
+            releaseJobs(batch, host, statuses, latency);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bodyBytesCopied += contentGetter.bodyBytesCopied();
+        m_connections += contentGetter.connectionsOpened();
+        m_ktlsRecvConnections += contentGetter.ktlsRecvConnections();
+    }
+    return bodies;
+}
+
+/**
+ * Blocks until work may be started without exceeding its host's window.
+ * Hosts are visited round-robin so one large host cannot starve the others.
+ * With pipelining, up to pipelineDepth ready jobs of the host are taken.
+ *
+ * @return false once every job has completed
+ */
+bool FetchScheduler::acquireJobs(std::vector<Job> & batch, std::string & host)
+{
+    const size_t maxBatch = std::max(1u, m_options.pipelineDepth);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        if (m_remaining == 0)
+            return false;
+
+        const auto now = clock::now();
+        auto earliest = clock::time_point::max();
+        const size_t numHosts = m_hostOrder.size();
+        for (size_t k = 0; k < numHosts; ++k) {
+            const size_t h = (m_nextHost + k) % numHosts;
+            HostState & state = m_hosts[m_hostOrder[h]];
+            if (state.pending.empty() || state.inFlight >= state.aimd.limit())
+                continue;
+            if (state.pending.front().notBefore > now) {
+                earliest = std::min(earliest, state.pending.front().notBefore);
+                continue;
+            }
+            batch.clear();
+            while (batch.size() < maxBatch && !state.pending.empty()
+                   && state.pending.front().notBefore <= now) {
+                batch.push_back(state.pending.front());
+                state.pending.pop_front();
+            }
+            state.peakInFlight = std::max(state.peakInFlight, ++state.inFlight);
+            host = m_hostOrder[h];
+            m_nextHost = h + 1;
+            return true;
+        }
+
+        if (earliest != clock::time_point::max())
+            m_cv.wait_until(lock, earliest);
+        else
+            m_cv.wait(lock);
+    }
+}
+
+/**
+ * Feeds the outcome of a batch back into its host's controller and either
+ * retires each job or queues a retry with exponential backoff. A pipelined
+ * batch counts as one sample, the time to the first byte of its first
+ * response.
+ */
+void FetchScheduler::releaseJobs(const std::vector<Job> & batch, const std::string & host,
+                                 const std::vector<unsigned> & statuses,
+                                 std::chrono::milliseconds latency)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto now = clock::now();
+        HostState & state = m_hosts[host];
+        --state.inFlight;
+        bool congested = false;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const Job & job = batch[i];
+            if (isCongestionStatus(statuses[i])) {
+                congested = true;
+                if (job.attempts + 1 < kMaxAttempts) {
+                    Job retry = job;
+                    ++retry.attempts;
+                    retry.notBefore = now + kRetryBackoff * (1 << job.attempts);
+                    state.pending.push_back(retry);
+                } else {
+                    --m_remaining;
+                }
+            } else {
+                ++state.completed;
+                --m_remaining;
+            }
+        }
+        if (congested) {
+            state.aimd.onCongestion(now);
+            ++state.congestionEvents;
+        } else {
+            state.aimd.onSuccess(latency, now);
+        }
+    }
+    m_cv.notify_all();
+}
+
+void FetchScheduler::printHostStats(std::ostream & os) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::endl
+       << std::setw(40) << "Host" << "\t"
+       << std::setw(10) << "Completed" << "\t"
+       << std::setw(10) << "Congested" << "\t"
+       << std::setw(10) << "Peak" << "\t"
+       << std::setw(10) << "Window" << "\t"
+       << std::setw(12) << "SRTT (ms)"
+       << std::endl;
+    for (const auto & host : m_hostOrder) {
+        const HostState & state = m_hosts.at(host);
+        os << std::setw(40) << host.substr(0, 40) << "\t"
+           << std::setw(10) << state.completed << "\t"
+           << std::setw(10) << state.congestionEvents << "\t"
+           << std::setw(10) << state.peakInFlight << "\t"
+           << std::setw(10) << std::fixed << std::setprecision(2) << state.aimd.window() << "\t"
+           << std::setw(12) << state.aimd.smoothedLatencyMs()
+           << std::endl;
+    }
+    const auto pool = m_connectionPool->stats();
+    os << "Connections: " << pool.created << " opened";
+    if (!m_options.proxy.empty())
+        os << " (" << pool.tunnels << " CONNECT tunnels via " << m_options.proxy << ")";
+    os << ", " << pool.reused << " reused from pool, "
+       << pool.resumedSessions << " TLS sessions resumed" << std::endl;
+    if (m_options.verifyPeer) {
+        const auto verification = m_connectionPool->verificationStats();
+        os << "Certificate chains: " << verification.chainsVerified << " verified, "
+           << verification.chainCacheHits << " from cache, "
+           << verification.chainFailures << " rejected; OCSP staples: "
+           << verification.ocspVerified << " verified, "
+           << verification.ocspCacheHits << " from cache, "
+           << verification.ocspMissing << " absent/unusable, "
+           << verification.ocspRevoked << " revoked" << std::endl;
+    } else {
+        os << "WARNING: server certificates were not verified (--insecure)" << std::endl;
+    }
+    if (m_options.enableKtls)
+        os << "kTLS receive offload active on " << m_ktlsRecvConnections
+           << " of " << m_connections << " connections" << std::endl;
+    os.flags(flags);
+    os.precision(precision);
+}
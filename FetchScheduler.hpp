@@ -0,0 +1,115 @@
+#pragma once
+
+#include <GetUrlContent.hpp>
+#include <ConnectionPool.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Per-host additive-increase/multiplicative-decrease controller for the
+// number of requests allowed in flight, modelled on TCP congestion control:
+//  - slow start: the window grows by one per success until it reaches the
+//    slow start threshold
+//  - congestion avoidance: the window grows by 1/window per success, i.e.
+//    roughly one slot per round of successful requests
+//  - congestion (429/503, connection errors, time to first byte well above
+//    the best one seen for the host in the last seconds): the window is
+//    halved, at most once per smoothed round trip so a burst of failures
+//    counts as one event
+class AimdController final {
+public:
+    typedef std::chrono::steady_clock clock;
+
+    AimdController(double initialWindow = 2.0, double maxWindow = 64.0);
+
+    unsigned limit() const;
+    double window() const { return m_window; }
+    double smoothedLatencyMs() const { return m_smoothedLatencyMs; }
+
+    void onSuccess(std::chrono::milliseconds latency, clock::time_point now);
+    void onCongestion(clock::time_point now);
+
+private:
+    double m_window;
+    double m_ssthresh;
+    double m_maxWindow;
+    double m_minLatencyMs = 0.;
+    clock::time_point m_minLatencyAt;
+    double m_smoothedLatencyMs = 0.;
+    clock::time_point m_lastDecrease;
+};
+
+// Fetches a list of urls with a fixed pool of worker threads. How many of
+// those workers may talk to the same host at once is decided per host by an
+// AimdController, so fast origins ramp up while small ones are not flooded.
+// Requests answered with 429/503 or that fail to connect are retried with
+// backoff. A "host" is an origin (urlOrigin: scheme, host name and port).
+// With pipelining enabled a worker takes a batch of same-origin requests,
+// which occupies one slot of the origin's window.
+class FetchScheduler final {
+public:
+    FetchScheduler(unsigned numWorkers, unsigned maxPerHost,
+                   const FetchOptions & options = FetchOptions());
+
+    // Returns the bodies in the same order as urls. Failed fetches yield
+    // an empty body.
+    std::vector<PageBuffer> fetchAll(const std::vector<std::string> & urls);
+    // Content-Type headers of the last fetchAll, indexed like its urls
+    const std::vector<std::string> & contentTypes() const { return m_contentTypes; }
+
+    void printHostStats(std::ostream & os) const;
+
+    // Totals over the last fetchAll
+    uint64_t bytesFetched() const { return m_bytesFetched; }
+    unsigned ktlsRecvConnections() const { return m_ktlsRecvConnections; }
+    unsigned connections() const { return m_connections; }     // opened, retries included
+    uint64_t bodyBytesCopied() const { return m_bodyBytesCopied; }
+
+private:
+    typedef AimdController::clock clock;
+
+    struct Job {
+        size_t index;
+        unsigned attempts;
+        clock::time_point notBefore;
+    };
+
+    struct HostState {
+        AimdController aimd;
+        unsigned inFlight = 0;
+        std::deque<Job> pending;
+        // statistics
+        unsigned completed = 0;
+        unsigned congestionEvents = 0;
+        unsigned peakInFlight = 0;
+    };
+
+    bool acquireJobs(std::vector<Job> & batch, std::string & host);
+    void releaseJobs(const std::vector<Job> & batch, const std::string & host,
+                     const std::vector<unsigned> & statuses, std::chrono::milliseconds latency);
+
+    unsigned m_numWorkers;
+    unsigned m_maxPerHost;
+    FetchOptions m_options;
+    std::shared_ptr<PageBufferPool> m_pool;
+    std::shared_ptr<ConnectionPool> m_connectionPool;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::map<std::string, HostState> m_hosts;   // by origin
+    std::vector<std::string> m_hostOrder;   // round-robin order over hosts
+    size_t m_nextHost = 0;
+    size_t m_remaining = 0;                 // jobs neither done nor abandoned
+    uint64_t m_bytesFetched = 0;
+    unsigned m_ktlsRecvConnections = 0;
+    unsigned m_connections = 0;
+    uint64_t m_bodyBytesCopied = 0;
+    std::vector<std::string> m_contentTypes;
+};
@@ -1,15 +1,15 @@
 #include <GetUrlContent.hpp>
+#include <ConnectionPool.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <string>
 #include <memory>
 
-
-// NOTE : the following root certificates is an example source from Boost.org 
-// and is being used AS-IS, not intended for production/real use.
-#include "root_certificates.hpp"
-
 //#define HTTP_REQ_DEBUG
 
 // overload stream operator
@@ -35,7 +35,6 @@ std::ostream & operator<<(std::ostream & os, const UrlReq & req)
  */
 void parseUrl(const std::string& urlString, UrlReq & req) {
 
-    std::cout << std::endl << "Input URL : " << urlString << std::endl;
     auto protocol_pos = urlString.find_first_of("://");
     // Get protocol name
     req._protocol = urlString.substr(0, protocol_pos);
@@ -44,112 +43,356 @@ void parseUrl(const std::string& urlString, UrlReq & req) {
     req._port = (req._protocol.compare("https") == 0) ? "443" : "80";
     auto resource_pos = remString.find_first_of ('/');
     req._domain = remString.substr(0, resource_pos);
+    // Explicit port e.g. https://localhost:8443/
+    auto port_pos = req._domain.find_last_of(':');
+    if (port_pos != std::string::npos) {
+        req._port = req._domain.substr(port_pos + 1);
+        req._domain = req._domain.substr(0, port_pos);
+    }
     auto query_pos = remString.find_first_of ('?');
     req._resource = (resource_pos != std::string::npos) ? remString.substr(resource_pos, query_pos - resource_pos) : "";
     req._query = (query_pos != std::string::npos) ? remString.substr(query_pos + 1) : "?";
 }
 
+/**
+ * Origin of a parsed url. Urls differing in scheme or port are different
+ * origins even on the same host, and never share a connection.
+ *
+ * @param req   parsed url
+ * @return "protocol://host:port"
+ */
+std::string urlOrigin(const UrlReq & req)
+{
+    return req._protocol + "://" + req._domain + ":" + req._port;
+}
+
+/**
+ * True for the ways a TLS peer may signal the end of an EOF-delimited body
+ */
+bool isEndOfStream(const boost::system::error_code & ec)
+{
+    return ec == net::error::eof || ec == ssl::error::stream_truncated;
+}
+
+/**
+ * Writes a GET request for the url to an established stream
+ *
+ * @param stream      any Beast SyncWriteStream (TLS stream)
+ * @param url_req     parsed url
+ */
+template <class SyncStream>
+void writeGetRequest(SyncStream & stream, const UrlReq & url_req)
+{
+    const auto request_version = 11;    // Always assuming request version 11
+
+    // Set up an HTTP GET request message
+    std::string verb = "GET";
+    
+    http::request<http::string_body> req;        
+    req.method_string(verb);
+    req.target(url_req._resource);
+    req.version(request_version);
+    
+    using http::field;
+    req.set(http::field::host, url_req._domain);
+    req.set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
+
+#ifdef HTTP_REQ_DEBUG
+    std::cout << "Request prepared " << req ;
+#endif
+
+    // Send the HTTP request to the remote host
+    http::write(stream, req);
+}
+
+/**
+ * Reads one response from the stream, with the body going straight into
+ * the caller's buffer.
+ *
+ * Beast parses the header only. Bytes that arrived together with the header
+ * are moved into the body buffer; the remainder of a Content-Length or
+ * EOF-delimited body is then read from the stream directly into the body
+ * buffer, so after decryption the body is not copied again. Chunked bodies
+ * still go through Beast's parser, which de-chunks from its read buffer into
+ * the body buffer (one copy). Bytes beyond the end of this response stay in
+ * buffer for the next one (pipelining).
+ *
+ * @param stream      any Beast SyncReadStream (TLS stream)
+ * @param buffer      read buffer, persisted across responses on a connection
+ * @param bodyLimit   largest accepted body in bytes
+ * @param body        receives the response body
+ * @param contentType receives the Content-Type header, empty if absent
+ * @param bytesCopied incremented by the body bytes copied in user space
+ * @param keepAlive   set to whether the connection may carry another response
+ * @param headerAt    set to when the header had been read
+ * @return the HTTP status of the response
+ */
+template <class SyncStream>
+unsigned readResponse(SyncStream & stream, beast::flat_buffer & buffer, uint64_t bodyLimit,
+                      std::string & body, std::string & contentType, uint64_t & bytesCopied, bool & keepAlive,
+                      std::chrono::steady_clock::time_point & headerAt)
+{
+    http::response_parser<http::string_body> parser;
+    parser.body_limit(bodyLimit);
+    http::read_header(stream, buffer, parser);
+    headerAt = std::chrono::steady_clock::now();
+    const unsigned status = parser.get().result_int();
+    keepAlive = parser.keep_alive();
+    const auto contentTypeField = parser.get()[http::field::content_type];
+    contentType.assign(contentTypeField.data(), contentTypeField.size());
+
+    body.clear();
+    if (parser.is_done())
+        return status;
+
+    if (parser.chunked()) {
+        // Let the parser de-chunk into our (pooled) buffer
+        parser.get().body().swap(body);
+        http::read(stream, buffer, parser);
+        body.swap(parser.get().body());
+        bytesCopied += body.size();
+        return status;
+    }
+
+    const auto contentLength = parser.content_length();
+    if (contentLength) {
+        if (*contentLength > bodyLimit)
+            throw boost::system::system_error{http::error::body_limit};
+        body.resize(static_cast<size_t>(*contentLength));
+        const size_t fromHeader = net::buffer_copy(net::buffer(&body[0], body.size()), buffer.data());
+        buffer.consume(fromHeader);
+        bytesCopied += fromHeader;
+        net::read(stream, net::buffer(&body[0] + fromHeader, body.size() - fromHeader));
+        return status;
+    }
+
+    // No length: the body runs until the server closes the connection
+    keepAlive = false;
+    const size_t kReadChunk = 64 * 1024;
+    size_t filled = buffer.size();
+    body.resize(std::max(body.capacity(), filled + kReadChunk));
+    net::buffer_copy(net::buffer(&body[0], filled), buffer.data());
+    buffer.consume(filled);
+    bytesCopied += filled;
+    for (;;) {
+        if (filled == body.size()) {
+            if (body.size() >= bodyLimit)
+                throw boost::system::system_error{http::error::body_limit};
+            body.resize(std::min<uint64_t>(body.size() * 2, bodyLimit));
+        }
+        boost::system::error_code ec;
+        filled += stream.read_some(net::buffer(&body[0] + filled, body.size() - filled), ec);
+        if (isEndOfStream(ec))
+            break;
+        if (ec)
+            throw boost::system::system_error{ec};
+    }
+    body.resize(filled);
+    return status;
+}
+
+UrlContentGetter::UrlContentGetter(const FetchOptions & options,
+                                   std::shared_ptr<PageBufferPool> pool,
+                                   std::shared_ptr<ConnectionPool> connections)
+    : m_options(options)
+    , m_pool(std::move(pool))
+    , m_connections(std::move(connections))
+{
+    if (!m_connections)
+        m_connections = ConnectionPool::create(options);
+}
+
+/**
+ * Runs exchange on a connection to the url's origin: an idle pooled one if
+ * available, otherwise a new one (tunneled through the proxy if configured).
+ * Afterwards the connection goes back to the pool if exchange reports it
+ * may be kept alive, and is shut down otherwise.
+ *
+ * A pooled connection may have been closed by the server while idle; that
+ * only shows when it is used, so a failure on a reused connection is
+ * retried once on a new one. Exchanges must therefore be restartable.
+ *
+ * @param url_req   parsed url
+ * @param exchange  callable taking the connected stream (either ssl_socket
+ *                  or SslFdStream, so it must be a generic lambda) and
+ *                  returning whether the connection can be kept alive
+ */
+template <class Exchange>
+void UrlContentGetter::withConnection(const UrlReq & url_req, Exchange && exchange)
+{
+    auto connection = m_connections->acquire(urlOrigin(url_req));
+    bool reused = static_cast<bool>(connection);
+    for (;;) {
+        if (!connection) {
+            connection = m_connections->connect(url_req);
+            ++m_connectionsOpened;
+            if (connection->fdStream && connection->fdStream->ktlsRecv())
+                ++m_ktlsRecvConnections;
+        }
+        if (connection->fdStream) {
+            m_ktlsRecv = connection->fdStream->ktlsRecv();
+            m_ktlsSend = connection->fdStream->ktlsSend();
+        }
+
+        bool keepAlive = false;
+        try {
+            keepAlive = connection->fdStream ? exchange(*connection->fdStream)
+                                             : exchange(*connection->sslSocket);
+        }
+        catch (const boost::system::system_error &) {
+            if (!reused)
+                throw;
+            // Stale keep-alive connection, try a fresh one
+            connection.reset();
+            reused = false;
+            continue;
+        }
+
+        if (keepAlive) {
+            m_connections->release(std::move(connection));
+        } else if (connection->fdStream) {
+            boost::system::error_code ec;
+            connection->fdStream->shutdown(ec);
+        } else {
+            // Shut down
+            shutDownConnection(*connection->sslSocket);
+        }
+        return;
+    }
+}
+
 /**
  * Parses a url into constituents for constucting an http request object 
  * 
  * @param urlString full url path from where to fetch content
- * @return a string containing the body/contents of the url GET request response 
+ * @return a buffer containing the body/contents of the url GET request response,
+ *         empty if the request failed
  * 
  */
-std::string UrlContentGetter::getUrlContent(const std::string & urlString)
+PageBuffer UrlContentGetter::getUrlContent(const std::string & urlString)
 {
+    std::cout << std::endl << "Input URL : " << urlString << std::endl;
     UrlReq url_req;
     parseUrl(urlString, url_req);
 #ifdef HTTP_REQ_DEBUG
     std::cout << url_req << std::endl;
 #endif
-    const auto request_version = 11;    // Always assuming request version 11
 
-    std::string retVal;
+    auto retVal = m_pool->acquire();
+    m_status = 0;
+    m_contentType.clear();
+    m_ktlsRecv = false;
+    m_ktlsSend = false;
+    m_timeToFirstByte = std::chrono::milliseconds(0);
     try
     {
-        // The io_context is required for all I/O
-        boost::asio::io_context ioc;
-        // The SSL context is required, and holds certificates
-        ssl::context ctx{ssl::context::sslv23_client};
-
-        // WARNING: UNSAFE - fake certificates in root_certificats.hpp.
-        // are only for illustrative purposes. Please read the comments
-        // there.
-
-        // This holds the root certificate used for verification.
-        // load_root_certificates(ctx);
-
-        // Verify the remote server's certificate
-        // ctx.set_verify_mode(ssl::verify_peer);
-
-        // WARNING: UNSAFE - comment this out for production 
-        ctx.set_verify_mode(ssl::verify_none);
-
-        ///////////////////////////////////
-
-        // Create a context that uses the default paths for
-        // finding CA certificates.
-        ctx.set_default_verify_paths();
-
-        // Open a socket and connect it to the remote host.
-        ssl_socket sock(ioc, ctx);
-
-        tcp::resolver resolver(ioc);
-        tcp::resolver::query query(url_req._domain, url_req._protocol);
-
-        auto const results = resolver.resolve(query);
-        boost::asio::connect(sock.lowest_layer(), results);
-        sock.lowest_layer().set_option(tcp::no_delay(true));
-        
-        // Make the connection on the IP address we get from a lookup
-        boost::asio::connect(sock.next_layer(), results.begin(), results.end());
-
-        // Perform the SSL handshake
-        sock.handshake(ssl::stream_base::client);
-
-        // Set up an HTTP GET request message
-        std::string verb = "GET";
-        
-        http::request<http::string_body> req;        
-        req.method_string(verb);
-        req.target(url_req._resource);
-        req.version(request_version);
-        
-        using http::field;
-        req.set(http::field::host, url_req._domain);
-        req.set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-    
-    #ifdef HTTP_REQ_DEBUG
-        std::cout << "Request prepared " << req ;
-    #endif
-
-        // Send the HTTP request to the remote host
-        http::write(sock, req);
-
-        // This buffer is used for reading and must be persisted
-        boost::beast::flat_buffer buffer;
-
-        // Declare a container to hold the response
-        http::response<http::dynamic_body> res;
-    
-        // Receive the HTTP response
-        http::read(sock, buffer, res);
-
-        retVal = boost::beast::buffers_to_string(res.body().data());
-        std::cout << "Response size = " << retVal.size() << std::endl;
-
-        // Shut down
-        shutDownConnection(sock);
+        withConnection(url_req, [&](auto & stream) {
+            const auto sent = std::chrono::steady_clock::now();
+            writeGetRequest(stream, url_req);
+            beast::flat_buffer buffer;
+            bool keepAlive = false;
+            std::chrono::steady_clock::time_point headerAt;
+            m_status = readResponse(stream, buffer, m_options.bodyLimit, *retVal, m_contentType,
+                                    m_bodyBytesCopied, keepAlive, headerAt);
+            m_timeToFirstByte = std::chrono::duration_cast<std::chrono::milliseconds>(headerAt - sent);
+            std::cout << "Response size = " << retVal->size()
+                      << (m_ktlsRecv ? " (kTLS rx)" : "") << std::endl;
+            return keepAlive;
+        });
     }
     catch(std::exception const& e)
     {
         std::cerr << "Error: " << e.what() << std::endl;
+        // A failed shutdown after a complete response keeps the body
+        if (m_status == 0)
+            retVal->clear();
     }
 
     return retVal;
 }
 
+/**
+ * Fetches several urls of the same origin over one keep-alive connection
+ * using HTTP/1.1 pipelining: all requests are written back to back, then
+ * the responses are read in order.
+ *
+ * If the connection breaks or the server announces it is closing (no
+ * keep-alive, or an EOF-delimited body), the responses received so far are
+ * kept and the unanswered requests are sent again on a fresh connection,
+ * which is safe because GET is idempotent. Once kMaxPipelineConnections
+ * connections in a row produced no response, the remaining urls are
+ * reported with status 0.
+ *
+ * @param urlStrings    urls that all share one origin (protocol, host and
+ *                      port), as they are all written to one connection
+ * @param statuses      resized to match, HTTP status per url (0 if none)
+ * @param contentTypes  resized to match, Content-Type header per url
+ * @return bodies in the same order as urlStrings (empty if failed)
+ */
+std::vector<PageBuffer> UrlContentGetter::getUrlContentPipelined(
+    const std::vector<std::string> & urlStrings, std::vector<unsigned> & statuses,
+    std::vector<std::string> & contentTypes)
+{
+    const unsigned kMaxPipelineConnections = 3;
+
+    std::vector<UrlReq> url_reqs(urlStrings.size());
+    std::vector<PageBuffer> bodies(urlStrings.size());
+    statuses.assign(urlStrings.size(), 0);
+    contentTypes.assign(urlStrings.size(), std::string());
+    for (size_t i = 0; i < urlStrings.size(); ++i) {
+        parseUrl(urlStrings[i], url_reqs[i]);
+        assert(urlOrigin(url_reqs[i]) == urlOrigin(url_reqs[0]));
+    }
+    m_ktlsRecv = false;
+    m_ktlsSend = false;
+    m_timeToFirstByte = std::chrono::milliseconds(0);
+
+    size_t next = 0;    // first url without a complete response
+    unsigned failures = 0;
+    while (next < urlStrings.size() && failures < kMaxPipelineConnections)
+    {
+        const size_t answered = next;
+        try
+        {
+            withConnection(url_reqs[next], [&](auto & stream) {
+                const auto sent = std::chrono::steady_clock::now();
+                for (size_t i = next; i < url_reqs.size(); ++i)
+                    writeGetRequest(stream, url_reqs[i]);
+
+                beast::flat_buffer buffer;
+                bool keepAlive = true;
+                const size_t first = next;
+                while (keepAlive && next < url_reqs.size()) {
+                    auto body = m_pool->acquire();
+                    std::chrono::steady_clock::time_point headerAt;
+                    statuses[next] = readResponse(stream, buffer, m_options.bodyLimit, *body,
+                                                  contentTypes[next], m_bodyBytesCopied, keepAlive, headerAt);
+                    // Later headers wait behind the earlier bodies
+                    if (next == first)
+                        m_timeToFirstByte = std::chrono::duration_cast<std::chrono::milliseconds>(headerAt - sent);
+                    std::cout << "Response size = " << body->size() << " (" << urlStrings[next] << ")" << std::endl;
+                    bodies[next++] = std::move(body);
+                }
+                return keepAlive;
+            });
+        }
+        catch(std::exception const& e)
+        {
+            std::cerr << "Error: " << e.what() << " after " << next << " of "
+                      << urlStrings.size() << " pipelined responses" << std::endl;
+        }
+        if (next == answered)
+            ++failures;
+    }
+
+    for (auto & body : bodies)
+        if (!body)
+            body = m_pool->acquire();
+    m_status = statuses.empty() ? 0 : statuses.back();
+    m_contentType = contentTypes.empty() ? std::string() : contentTypes.back();
+    return bodies;
+}
+
 /**
  * Gracefully shutdown communication sockets
  * 
@@ -186,3 +429,94 @@ void UrlContentGetter::shutDownConnection (ssl_socket & sock) {
     }
     
 }
+
+SslFdStream::SslFdStream(SSL_CTX * ctx, tcp::socket::native_handle_type fd,
+                         const std::string & serverName, bool enableKtls)
+    : m_ssl(SSL_new(ctx))
+{
+    if (!m_ssl)
+        throw boost::system::system_error{lastError(0)};
+#ifdef SSL_OP_ENABLE_KTLS
+    if (enableKtls)
+        SSL_set_options(m_ssl, SSL_OP_ENABLE_KTLS);
+#else
+    (void)enableKtls;
+#endif
+#ifdef SSL_OP_IGNORE_UNEXPECTED_EOF
+    // Many servers close without close_notify; treat that as end of stream
+    // like the Beast path does.
+    SSL_set_options(m_ssl, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+    SSL_set_fd(m_ssl, static_cast<int>(fd));
+    SSL_set_tlsext_host_name(m_ssl, serverName.c_str());
+}
+
+SslFdStream::~SslFdStream()
+{
+    SSL_free(m_ssl);
+}
+
+void SslFdStream::handshake()
+{
+    int ret = SSL_connect(m_ssl);
+    if (ret != 1)
+        throw boost::system::system_error{lastError(ret), "handshake"};
+}
+
+void SslFdStream::shutdown(boost::system::error_code & ec)
+{
+    int ret = SSL_shutdown(m_ssl);
+    ec = (ret < 0) ? lastError(ret) : boost::system::error_code();
+}
+
+// Before OpenSSL 3 (or in builds without kTLS) the BIO_get_ktls_* macros
+// do not exist and kTLS is never active
+bool SslFdStream::ktlsRecv() const
+{
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    return BIO_get_ktls_recv(SSL_get_rbio(m_ssl)) > 0;
+#else
+    return false;
+#endif
+}
+
+bool SslFdStream::ktlsSend() const
+{
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    return BIO_get_ktls_send(SSL_get_wbio(m_ssl)) > 0;
+#else
+    return false;
+#endif
+}
+
+std::size_t SslFdStream::read(void * data, std::size_t size, boost::system::error_code & ec)
+{
+    std::size_t bytes = 0;
+    int ret = SSL_read_ex(m_ssl, data, size, &bytes);
+    ec = (ret == 1) ? boost::system::error_code() : lastError(ret);
+    return bytes;
+}
+
+std::size_t SslFdStream::write(const void * data, std::size_t size, boost::system::error_code & ec)
+{
+    std::size_t bytes = 0;
+    int ret = SSL_write_ex(m_ssl, data, size, &bytes);
+    ec = (ret == 1) ? boost::system::error_code() : lastError(ret);
+    return bytes;
+}
+
+/**
+ * Maps the OpenSSL error state after a failed call onto an error code.
+ * A clean close (close_notify or EOF) maps to net::error::eof, which is
+ * what Beast expects at the end of a response without Content-Length.
+ */
+boost::system::error_code SslFdStream::lastError(int ret) const
+{
+    const int err = m_ssl ? SSL_get_error(m_ssl, ret) : SSL_ERROR_SSL;
+    const unsigned long queued = ERR_get_error();
+    if (err == SSL_ERROR_ZERO_RETURN || (err == SSL_ERROR_SYSCALL && queued == 0 && ret == 0))
+        return net::error::eof;
+    if (err == SSL_ERROR_SYSCALL && queued == 0)
+        return boost::system::error_code(errno, boost::system::system_category());
+    return boost::system::error_code(static_cast<int>(queued), net::error::get_ssl_category());
+}
@@ -2,11 +2,17 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+#include <PageBuffer.hpp>
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/beast/version.hpp>
 #include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/asio/ssl/error.hpp>
@@ -30,15 +36,151 @@ using boost::asio::ip::tcp;
 namespace ssl = boost::asio::ssl;
 typedef ssl::stream<tcp::socket> ssl_socket;
 
+void parseUrl(const std::string& urlString, UrlReq & req);
+// "protocol://host:port", the key under which connections, TLS sessions and
+// per-host scheduling state are kept
+std::string urlOrigin(const UrlReq & req);
+
+// Transport settings shared by all fetches
+struct FetchOptions {
+    // Let OpenSSL 3 install kernel TLS (Linux kTLS) after the handshake so
+    // the kernel decrypts records straight into our receive buffers. Falls
+    // back to userspace TLS when the kernel, the OpenSSL build or the
+    // negotiated cipher does not support it.
+    bool enableKtls = false;
+    // Responses with larger bodies are rejected
+    uint64_t bodyLimit = 64 * 1024 * 1024;
+    // Opt-in HTTP/1.1 pipelining: up to this many GET requests for the same
+    // host are written back to back on one keep-alive connection. 0 or 1
+    // sends one request per connection.
+    unsigned pipelineDepth = 0;
+    // Forward proxy as "host:port". When set, every connection is an HTTP
+    // CONNECT tunnel through it, except to the hosts in noProxy.
+    std::string proxy;
+    // Hosts reached directly, as in NO_PROXY: comma-separated host names
+    // (also matching their subdomains, with or without a leading '.'),
+    // optionally with ":port", or "*" for all
+    std::string noProxy;
+    // Verify the server certificate chain and host name. Turning this off
+    // restores the old (unsafe) behaviour of accepting any certificate.
+    bool verifyPeer = true;
+    // Extra trust anchors (PEM) on top of the system's default CA paths
+    std::string caFile;
+};
+
+// Blocking TLS stream in which OpenSSL owns the socket file descriptor.
+// ssl::stream shuttles every record through an in-memory BIO pair, which
+// costs an extra copy and rules out kTLS; this stream does neither.
+// Satisfies Beast's SyncReadStream and SyncWriteStream requirements.
+class SslFdStream final {
+public:
+    SslFdStream(SSL_CTX * ctx, tcp::socket::native_handle_type fd,
+                const std::string & serverName, bool enableKtls);
+    ~SslFdStream();
+    SslFdStream(const SslFdStream &) = delete;
+    SslFdStream & operator=(const SslFdStream &) = delete;
+
+    void handshake();
+    void shutdown(boost::system::error_code & ec);
+    bool ktlsRecv() const;
+    bool ktlsSend() const;
+    SSL * native_handle() { return m_ssl; }
+
+    template <class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence & buffers, boost::system::error_code & ec) {
+        for (auto it = net::buffer_sequence_begin(buffers); it != net::buffer_sequence_end(buffers); ++it) {
+            net::mutable_buffer b = *it;
+            if (b.size() != 0)
+                return read(b.data(), b.size(), ec);
+        }
+        ec = {};
+        return 0;
+    }
+    template <class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence & buffers) {
+        boost::system::error_code ec;
+        auto n = read_some(buffers, ec);
+        if (ec)
+            throw boost::system::system_error{ec};
+        return n;
+    }
+    template <class ConstBufferSequence>
+    std::size_t write_some(const ConstBufferSequence & buffers, boost::system::error_code & ec) {
+        for (auto it = net::buffer_sequence_begin(buffers); it != net::buffer_sequence_end(buffers); ++it) {
+            net::const_buffer b = *it;
+            if (b.size() != 0)
+                return write(b.data(), b.size(), ec);
+        }
+        ec = {};
+        return 0;
+    }
+    template <class ConstBufferSequence>
+    std::size_t write_some(const ConstBufferSequence & buffers) {
+        boost::system::error_code ec;
+        auto n = write_some(buffers, ec);
+        if (ec)
+            throw boost::system::system_error{ec};
+        return n;
+    }
+
+private:
+    std::size_t read(void * data, std::size_t size, boost::system::error_code & ec);
+    std::size_t write(const void * data, std::size_t size, boost::system::error_code & ec);
+    boost::system::error_code lastError(int ret) const;
+
+    SSL * m_ssl;
+};
+
+class ConnectionPool;
+
 class UrlContentGetter final {
 public:
-    UrlContentGetter() {}
+    // Without a connection pool the getter creates one of its own
+    UrlContentGetter(const FetchOptions & options = FetchOptions(),
+                     std::shared_ptr<PageBufferPool> pool = PageBufferPool::create(),
+                     std::shared_ptr<ConnectionPool> connections = nullptr);
     virtual ~UrlContentGetter() {}
-    std::string getUrlContent(const std::string & urlString);
+    PageBuffer getUrlContent(const std::string & urlString);
+    std::vector<PageBuffer> getUrlContentPipelined(const std::vector<std::string> & urlStrings,
+                                                   std::vector<unsigned> & statuses,
+                                                   std::vector<std::string> & contentTypes);
     std::string getContent() const { return m_content;}
+    // Outcome of the last getUrlContent call. Status is 0 when no HTTP
+    // response was received (resolve, connect, handshake or read failure).
+    unsigned getLastStatus() const { return m_status; }
+    bool lastRequestFailed() const { return m_status == 0; }
+    // Content-Type header of the last response, empty if it had none
+    const std::string & getLastContentType() const { return m_contentType; }
+    // From writing the last request (the first of a pipelined batch) to
+    // reading its response header; unlike the full exchange it does not
+    // grow with the body size
+    std::chrono::milliseconds getLastTimeToFirstByte() const { return m_timeToFirstByte; }
+    // Whether kernel TLS was active for the last request's connection
+    bool lastUsedKtlsRecv() const { return m_ktlsRecv; }
+    bool lastUsedKtlsSend() const { return m_ktlsSend; }
+    // Body bytes copied in user space after decryption, over all requests
+    uint64_t bodyBytesCopied() const { return m_bodyBytesCopied; }
+    // Connections opened over all requests (including stale-connection
+    // retries and pipeline reconnects), and how many of them got kTLS rx
+    unsigned connectionsOpened() const { return m_connectionsOpened; }
+    unsigned ktlsRecvConnections() const { return m_ktlsRecvConnections; }
     void shutDownConnection (ssl_socket & sock);
     
 private:
+    template <class Exchange>
+    void withConnection(const UrlReq & url_req, Exchange && exchange);
+
+    FetchOptions m_options;
+    std::shared_ptr<PageBufferPool> m_pool;
+    std::shared_ptr<ConnectionPool> m_connections;
     UrlReq m_url_req;
     std::string m_content;
+    unsigned m_status = 0;
+    std::string m_contentType;
+    std::chrono::milliseconds m_timeToFirstByte{0};
+    bool m_ktlsRecv = false;
+    bool m_ktlsSend = false;
+    uint64_t m_bodyBytesCopied = 0;
+    unsigned m_connectionsOpened = 0;
+    unsigned m_ktlsRecvConnections = 0;
 };
@@ -0,0 +1,95 @@
+#include <HtmlAnalyzer.hpp>
+#include <HtmlDom.hpp>
+#include <HtmlParser.hpp>
+#include <HtmlTokenizer.hpp>
+
+namespace {
+    // The single-pass tokenizer (HtmlTokenizer.cpp)
+    class TokenizerAnalyzer final : public HtmlAnalyzer {
+    public:
+        PageCounts analyze(boost::string_view page) override
+        {
+            return countDomNodes(page.data(), page.size());
+        }
+    };
+
+    // Nesting alone (countNestedDomNodes): one bit and one tag key per open
+    // element, for pages whose tree is too large to keep
+    class BitstackAnalyzer final : public HtmlAnalyzer {
+    public:
+        PageCounts analyze(boost::string_view page) override
+        {
+            return countNestedDomNodes(page.data(), page.size());
+        }
+    };
+
+    // The element tree (HtmlDom.cpp), built in an arena that is reused for
+    // every page
+    class DomAnalyzer final : public HtmlAnalyzer {
+    public:
+        PageCounts analyze(boost::string_view page) override
+        {
+            m_dom.build(page);
+            const HtmlDom::Metrics metrics = m_dom.metrics();
+            return PageCounts(metrics.nodes, metrics.leaves, metrics.divs);
+        }
+
+    private:
+        HtmlDom m_dom;
+    };
+
+    // The four-stage regex pipeline (getCleanDomTree); it needs the page as
+    // a string, copied into a buffer kept between pages
+    class RegexAnalyzer final : public HtmlAnalyzer {
+    public:
+        PageCounts analyze(boost::string_view page) override
+        {
+            m_page.assign(page.data(), page.size());
+            auto stats = getCleanDomTree(m_page);
+            return PageCounts(std::get<0>(stats), std::get<1>(stats), std::get<2>(stats));
+        }
+
+    private:
+        std::string m_page;
+    };
+
+    // The Boost.Spirit grammar (parseHtml), from a copy like the regex one
+    class SpiritAnalyzer final : public HtmlAnalyzer {
+    public:
+        PageCounts analyze(boost::string_view page) override
+        {
+            m_page.assign(page.data(), page.size());
+            return parseHtml(m_page);
+        }
+
+    private:
+        std::string m_page;
+    };
+}
+
+/**
+ * Makes an analyzer backend by name
+ *
+ * @param name  "fast" (the tokenizer), "bitstack", "dom", "regex" or "spirit"
+ * @return a new analyzer, or nullptr if name is not one of them
+ */
+std::unique_ptr<HtmlAnalyzer> makeHtmlAnalyzer(const std::string & name)
+{
+    if (name == "fast")
+        return std::unique_ptr<HtmlAnalyzer>(new TokenizerAnalyzer);
+    if (name == "bitstack")
+        return std::unique_ptr<HtmlAnalyzer>(new BitstackAnalyzer);
+    if (name == "dom")
+        return std::unique_ptr<HtmlAnalyzer>(new DomAnalyzer);
+    if (name == "regex")
+        return std::unique_ptr<HtmlAnalyzer>(new RegexAnalyzer);
+    if (name == "spirit")
+        return std::unique_ptr<HtmlAnalyzer>(new SpiritAnalyzer);
+    return nullptr;
+}
+
+const std::vector<std::string> & htmlAnalyzerNames()
+{
+    static const std::vector<std::string> names = { "fast", "bitstack", "dom", "regex", "spirit" };
+    return names;
+}
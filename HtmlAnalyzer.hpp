@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+// Nodes, leaf nodes and div nodes of a page
+typedef std::tuple<uint64_t, uint64_t, uint64_t> PageCounts;
+
+// One way of counting the elements of a page. The backends are selected by
+// name (--parser=...) and all take the page as UTF-8, so they can be run on
+// the same pages and their counts and throughput compared. An analyzer may
+// keep buffers from page to page and is used by one thread at a time; each
+// thread makes its own.
+class HtmlAnalyzer {
+public:
+    virtual ~HtmlAnalyzer() {}
+
+    virtual PageCounts analyze(boost::string_view page) = 0;
+};
+
+// The analyzer called name, nullptr if there is none
+std::unique_ptr<HtmlAnalyzer> makeHtmlAnalyzer(const std::string & name);
+
+// Names of the analyzers, the default first
+const std::vector<std::string> & htmlAnalyzerNames();
@@ -0,0 +1,273 @@
+#include <HtmlCharset.hpp>
+#include <HtmlVisitor.hpp>
+#include <SimdScan.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/locale/encoding.hpp>
+
+namespace {
+    struct CharsetLabel {
+        const char * label;
+        const char * name;
+    };
+
+    // Labels of the WHATWG Encoding Standard for the encodings iconv knows,
+    // canonical names included. ISO-8859-1 and US-ASCII are windows-1252 to
+    // browsers, and so are they here.
+    const CharsetLabel kCharsetLabels[] = {
+        {"utf-8", "utf-8"}, {"utf8", "utf-8"}, {"unicode-1-1-utf-8", "utf-8"},
+        {"unicode11utf8", "utf-8"}, {"unicode20utf8", "utf-8"}, {"x-unicode20utf8", "utf-8"},
+        {"windows-1252", "windows-1252"}, {"cp1252", "windows-1252"}, {"x-cp1252", "windows-1252"},
+        {"iso-8859-1", "windows-1252"}, {"iso8859-1", "windows-1252"}, {"iso88591", "windows-1252"},
+        {"iso_8859-1", "windows-1252"}, {"iso_8859-1:1987", "windows-1252"}, {"latin1", "windows-1252"},
+        {"l1", "windows-1252"}, {"cp819", "windows-1252"}, {"ibm819", "windows-1252"},
+        {"csisolatin1", "windows-1252"}, {"iso-ir-100", "windows-1252"},
+        {"us-ascii", "windows-1252"}, {"ascii", "windows-1252"}, {"ansi_x3.4-1968", "windows-1252"},
+        {"windows-1250", "windows-1250"}, {"cp1250", "windows-1250"}, {"x-cp1250", "windows-1250"},
+        {"windows-1251", "windows-1251"}, {"cp1251", "windows-1251"}, {"x-cp1251", "windows-1251"},
+        {"windows-1253", "windows-1253"}, {"cp1253", "windows-1253"},
+        {"windows-1254", "windows-1254"}, {"cp1254", "windows-1254"}, {"iso-8859-9", "windows-1254"},
+        {"latin5", "windows-1254"},
+        {"windows-1255", "windows-1255"}, {"cp1255", "windows-1255"},
+        {"windows-1256", "windows-1256"}, {"cp1256", "windows-1256"},
+        {"windows-1257", "windows-1257"}, {"cp1257", "windows-1257"},
+        {"windows-1258", "windows-1258"}, {"cp1258", "windows-1258"},
+        {"windows-874", "windows-874"}, {"tis-620", "windows-874"}, {"iso-8859-11", "windows-874"},
+        {"iso-8859-2", "iso-8859-2"}, {"latin2", "iso-8859-2"},
+        {"iso-8859-3", "iso-8859-3"}, {"iso-8859-4", "iso-8859-4"},
+        {"iso-8859-5", "iso-8859-5"}, {"cyrillic", "iso-8859-5"},
+        {"iso-8859-6", "iso-8859-6"}, {"arabic", "iso-8859-6"},
+        {"iso-8859-7", "iso-8859-7"}, {"greek", "iso-8859-7"},
+        {"iso-8859-8", "iso-8859-8"}, {"hebrew", "iso-8859-8"}, {"iso-8859-8-i", "iso-8859-8"},
+        {"iso-8859-10", "iso-8859-10"}, {"iso-8859-13", "iso-8859-13"}, {"iso-8859-14", "iso-8859-14"},
+        {"iso-8859-15", "iso-8859-15"}, {"latin9", "iso-8859-15"}, {"iso-8859-16", "iso-8859-16"},
+        {"koi8-r", "koi8-r"}, {"koi8", "koi8-r"}, {"koi8-u", "koi8-u"}, {"ibm866", "ibm866"},
+        {"macintosh", "macintosh"}, {"mac", "macintosh"},
+        {"shift_jis", "shift_jis"}, {"shift-jis", "shift_jis"}, {"sjis", "shift_jis"},
+        {"ms_kanji", "shift_jis"}, {"x-sjis", "shift_jis"}, {"windows-31j", "shift_jis"},
+        {"csshiftjis", "shift_jis"}, {"ms932", "shift_jis"},
+        {"euc-jp", "euc-jp"}, {"x-euc-jp", "euc-jp"}, {"cseucpkdfmtjapanese", "euc-jp"},
+        {"iso-2022-jp", "iso-2022-jp"}, {"csiso2022jp", "iso-2022-jp"},
+        {"euc-kr", "euc-kr"}, {"ks_c_5601-1987", "euc-kr"}, {"korean", "euc-kr"},
+        {"windows-949", "euc-kr"}, {"cseuckr", "euc-kr"}, {"ksc5601", "euc-kr"},
+        {"gbk", "gbk"}, {"gb2312", "gbk"}, {"gb_2312", "gbk"}, {"gb_2312-80", "gbk"},
+        {"chinese", "gbk"}, {"csgb2312", "gbk"}, {"x-gbk", "gbk"}, {"cp936", "gbk"},
+        {"gb18030", "gb18030"},
+        {"big5", "big5"}, {"big5-hkscs", "big5"}, {"cn-big5", "big5"}, {"csbig5", "big5"},
+        {"x-x-big5", "big5"},
+        {"utf-16le", "utf-16le"}, {"utf-16", "utf-16le"}, {"unicode", "utf-16le"},
+        {"ucs-2", "utf-16le"}, {"csunicode", "utf-16le"}, {"iso-10646-ucs-2", "utf-16le"},
+        {"utf-16be", "utf-16be"},
+    };
+
+    bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    }
+
+    // Charsets in which ASCII bytes may mean something else
+    bool isAsciiCompatible(const std::string & name)
+    {
+        return name != "utf-16le" && name != "utf-16be" && name != "iso-2022-jp";
+    }
+
+    // Finds the charset of a <meta> tag while the prefix is tokenized
+    struct MetaCharsetVisitor : HtmlVisitor {
+        bool inMeta = false;
+        bool contentTypeEquiv = false;
+        boost::string_view charset;
+        boost::string_view content;
+        std::string found;
+
+        void onStartTag(Tag tag, boost::string_view)
+        {
+            inMeta = tag == Tag::Meta && found.empty();
+            contentTypeEquiv = false;
+            charset = content = boost::string_view();
+        }
+
+        void onAttribute(boost::string_view name, boost::string_view value)
+        {
+            if (!inMeta)
+                return;
+            if (boost::algorithm::iequals(name, "charset") && charset.empty())
+                charset = value;
+            else if (boost::algorithm::iequals(name, "http-equiv"))
+                contentTypeEquiv = boost::algorithm::iequals(value, "content-type");
+            else if (boost::algorithm::iequals(name, "content") && content.empty())
+                content = value;
+        }
+
+        void onStartTagEnd(bool)
+        {
+            if (!inMeta)
+                return;
+            inMeta = false;
+            if (!charset.empty())
+                found = canonicalCharset(charset);
+            else if (contentTypeEquiv)
+                found = canonicalCharset(charsetParameter(content));
+            // A page cannot declare itself UTF-16: the declaration was read as ASCII
+            if (found == "utf-16le" || found == "utf-16be")
+                found = "utf-8";
+        }
+    };
+}
+
+/**
+ * Looks up a charset label, ignoring case and surrounding whitespace
+ *
+ * @param label     as found in a header or a meta tag
+ * @return canonical name, or empty for labels that are not known
+ */
+std::string canonicalCharset(boost::string_view label)
+{
+    while (!label.empty() && isSpace(label.front()))
+        label.remove_prefix(1);
+    while (!label.empty() && isSpace(label.back()))
+        label.remove_suffix(1);
+    for (const CharsetLabel & entry : kCharsetLabels)
+        if (boost::algorithm::iequals(label, boost::string_view(entry.label)))
+            return entry.name;
+    return std::string();
+}
+
+/**
+ * Extracts the charset from a Content-Type value, as the HTML standard's
+ * "algorithm for extracting a character encoding from a meta element":
+ * "charset" followed by '=' (with optional whitespace), then a quoted value
+ * or one ending at whitespace or ';'
+ *
+ * @param contentType   header or content attribute value
+ * @return the label as written, empty if there is none
+ */
+boost::string_view charsetParameter(boost::string_view contentType)
+{
+    const size_t kNameLength = 7;   // "charset"
+    for (size_t at = 0; at + kNameLength <= contentType.size(); ++at) {
+        if (!boost::algorithm::iequals(contentType.substr(at, kNameLength), "charset"))
+            continue;
+        size_t p = at + kNameLength;
+        while (p < contentType.size() && isSpace(contentType[p]))
+            ++p;
+        if (p == contentType.size() || contentType[p] != '=')
+            continue;
+        ++p;
+        while (p < contentType.size() && isSpace(contentType[p]))
+            ++p;
+        if (p == contentType.size())
+            return boost::string_view();
+        const char quote = contentType[p];
+        if (quote == '"' || quote == '\'') {
+            const size_t close = contentType.find(quote, p + 1);
+            if (close == boost::string_view::npos)
+                return boost::string_view();
+            return contentType.substr(p + 1, close - p - 1);
+        }
+        size_t end = p;
+        while (end < contentType.size() && !isSpace(contentType[end]) && contentType[end] != ';')
+            ++end;
+        return contentType.substr(p, end - p);
+    }
+    return boost::string_view();
+}
+
+/**
+ * Tokenizes the first 1024 bytes of a page for a <meta> tag declaring its
+ * charset. Comments and scripts are skipped like everywhere else; the first
+ * meta tag with a known charset wins.
+ *
+ * @param html  page
+ * @return canonical charset, empty if none is declared
+ */
+std::string prescanMetaCharset(boost::string_view html)
+{
+    const size_t kPrescanBytes = 1024;
+    MetaCharsetVisitor visitor;
+    visitHtml(html.substr(0, kPrescanBytes), visitor);
+    return visitor.found;
+}
+
+const char * charsetSourceName(CharsetSource source)
+{
+    switch (source) {
+    case CharsetSource::ByteOrderMark:  return "byte order mark";
+    case CharsetSource::ContentType:    return "Content-Type";
+    case CharsetSource::MetaTag:        return "meta tag";
+    case CharsetSource::Sniffed:        return "sniffed";
+    }
+    return "";
+}
+
+/**
+ * Finds the charset of a page and makes it UTF-8 where it is not already.
+ * For UTF-8 and ASCII pages this is one validation pass and no copy.
+ *
+ * @param page          raw response body
+ * @param contentType   Content-Type header of the response, may be empty
+ * @return the page as UTF-8, see charset() for how it was obtained
+ */
+boost::string_view PageDecoder::decode(boost::string_view page, boost::string_view contentType)
+{
+    m_charset = PageCharset();
+    if (page.size() >= 3 && std::memcmp(page.data(), "\xEF\xBB\xBF", 3) == 0) {
+        m_charset.source = CharsetSource::ByteOrderMark;
+        page.remove_prefix(3);
+    } else if (page.size() >= 2 && (std::memcmp(page.data(), "\xFF\xFE", 2) == 0
+                                    || std::memcmp(page.data(), "\xFE\xFF", 2) == 0)) {
+        m_charset.name = page[0] == '\xFF' ? "utf-16le" : "utf-16be";
+        m_charset.source = CharsetSource::ByteOrderMark;
+        page.remove_prefix(2);
+    } else {
+        std::string declared = canonicalCharset(charsetParameter(contentType));
+        if (!declared.empty()) {
+            m_charset.source = CharsetSource::ContentType;
+        } else if (!(declared = prescanMetaCharset(page)).empty()) {
+            m_charset.source = CharsetSource::MetaTag;
+        }
+        if (!declared.empty())
+            m_charset.name = declared;
+    }
+
+    if (!isAsciiCompatible(m_charset.name))
+        return transcode(page, m_charset.name) ? boost::string_view(m_buffer) : page;
+
+    const simd::Utf8Status status = simd::validateUtf8(page.data(), page.data() + page.size());
+    if (m_charset.source == CharsetSource::Sniffed && status == simd::Utf8Status::Invalid)
+        m_charset.name = "windows-1252";
+    if (m_charset.name == "utf-8") {
+        m_charset.validUtf8 = status != simd::Utf8Status::Invalid;
+        return page;
+    }
+    // ASCII means the same in every ASCII-compatible charset
+    if (status == simd::Utf8Status::Ascii)
+        return page;
+    return transcode(page, m_charset.name) ? boost::string_view(m_buffer) : page;
+}
+
+/**
+ * Converts a page to UTF-8 into the buffer; bytes that are invalid in the
+ * source charset are dropped. When iconv does not know the charset the page
+ * is left as it is, and marked invalid UTF-8 unless it validates.
+ *
+ * @param page  bytes in charset from
+ * @param from  canonical charset name
+ * @return whether the buffer holds the converted page
+ */
+bool PageDecoder::transcode(boost::string_view page, const std::string & from)
+{
+    try {
+        m_buffer = boost::locale::conv::to_utf<char>(page.data(), page.data() + page.size(), from);
+        m_charset.transcoded = true;
+        return true;
+    }
+    catch (const boost::locale::conv::conversion_error &) {
+    }
+    catch (const boost::locale::conv::invalid_charset_error &) {
+    }
+    m_charset.validUtf8 = simd::validateUtf8(page.data(), page.data() + page.size()) != simd::Utf8Status::Invalid;
+    return false;
+}
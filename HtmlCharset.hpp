@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include <boost/utility/string_view.hpp>
+
+// Character encoding of fetched pages. The analyzers work on UTF-8 (or
+// ASCII-compatible bytes), so a page is checked once before it is parsed:
+// its charset is taken from a byte order mark, the Content-Type header or a
+// <meta> tag in its first 1024 bytes, in that order (as browsers do), else
+// UTF-8 if the page validates as such and windows-1252 if not. Only pages
+// that are neither ASCII nor UTF-8 are transcoded; for the others the check
+// is a single SIMD validation pass and the page is parsed in place.
+
+// Where the charset of a page came from
+enum class CharsetSource { ByteOrderMark, ContentType, MetaTag, Sniffed };
+
+struct PageCharset {
+    std::string name = "utf-8";     // canonical, lower case
+    CharsetSource source = CharsetSource::Sniffed;
+    bool transcoded = false;        // the bytes parsed are a UTF-8 copy
+    bool validUtf8 = true;          // of the bytes parsed
+};
+
+// Canonical name of a charset label ("Latin1" -> "windows-1252", "utf8" ->
+// "utf-8"), following the WHATWG encoding labels; empty if not known
+std::string canonicalCharset(boost::string_view label);
+
+// Value of the charset parameter in a Content-Type header or a meta content
+// attribute ("text/html; charset=ISO-8859-1"), empty if there is none
+boost::string_view charsetParameter(boost::string_view contentType);
+
+// Canonical charset declared by a <meta charset> or <meta http-equiv=
+// "Content-Type"> tag in the first 1024 bytes, empty if there is none
+std::string prescanMetaCharset(boost::string_view html);
+
+const char * charsetSourceName(CharsetSource source);
+
+// Turns pages into UTF-8 for parsing. Each transcoded page is a new string,
+// held by the decoder until the next call unless taken over with
+// takeTranscoded(). One decoder per thread.
+class PageDecoder final {
+public:
+    // The page as UTF-8: the page itself (without a UTF-8 byte order mark)
+    // if it is UTF-8 or ASCII in an ASCII-compatible charset, else a copy
+    // valid until the next call. Pages labelled UTF-8 that do not validate
+    // are passed through as they are, with charset().validUtf8 false.
+    boost::string_view decode(boost::string_view page, boost::string_view contentType);
+
+    // Of the last page decoded
+    const PageCharset & charset() const { return m_charset; }
+
+    // Moves out the UTF-8 copy of the last page decoded, when it was
+    // transcoded, so it can outlive the next call
+    std::string takeTranscoded() { return std::move(m_buffer); }
+
+private:
+    bool transcode(boost::string_view page, const std::string & from);
+
+    PageCharset m_charset;
+    std::string m_buffer;
+};
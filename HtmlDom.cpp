@@ -0,0 +1,316 @@
+#include <HtmlDom.hpp>
+#include <HtmlTokenizer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * Allocates from the current block, moving on to the next retained block or
+ * a new one when it does not fit
+ *
+ * @param bytes     size of the allocation
+ * @param alignment power of two
+ * @return uninitialized memory, valid until reset() or release()
+ */
+void * DomArena::allocate(size_t bytes, size_t alignment)
+{
+    while (m_current < m_blocks.size()) {
+        Block & block = m_blocks[m_current];
+        const size_t offset = (m_used + alignment - 1) & ~(alignment - 1);
+        if (offset + bytes <= block.size) {
+            m_used = offset + bytes;
+            return block.data.get() + offset;
+        }
+        ++m_current;
+        m_used = 0;
+    }
+    const size_t size = std::max(m_blockSize, bytes + alignment);
+    m_blocks.push_back(Block{std::unique_ptr<char[]>(new char[size]), size});
+    m_current = m_blocks.size() - 1;
+    m_used = 0;
+    return allocate(bytes, alignment);
+}
+
+void DomArena::reset()
+{
+    m_current = 0;
+    m_used = 0;
+}
+
+void DomArena::release()
+{
+    m_blocks.clear();
+    reset();
+}
+
+size_t DomArena::bytesReserved() const
+{
+    size_t total = 0;
+    for (const Block & block : m_blocks)
+        total += block.size;
+    return total;
+}
+
+const HtmlDom::NodeId HtmlDom::kNone;
+
+// Receives the elements from the tree builder
+struct HtmlDom::Sink {
+    HtmlDom & dom;
+    const char * const base;
+    uint32_t depth = 0;
+
+    uint32_t offset(const char * p) const { return static_cast<uint32_t>(p - base); }
+
+    uint32_t openElement(Tag tag, const char *, size_t, uint32_t parent, const char * at)
+    {
+        dom.m_maxDepth = std::max(dom.m_maxDepth, ++depth);
+        return dom.appendNode(tag, parent, offset(at));
+    }
+
+    void closeElement(uint32_t node, const char * at)
+    {
+        dom.m_spanEnd[node] = offset(at);
+        --depth;
+    }
+};
+
+/**
+ * Builds the tree of a document, replacing the previous one
+ *
+ * @param html  document; must outlive the tree and be smaller than 4 GB
+ */
+void HtmlDom::build(boost::string_view html)
+{
+    if (html.size() >= std::numeric_limits<uint32_t>::max())
+        throw std::length_error("html document too large for 32-bit node offsets");
+    clear();
+    m_html = html;
+    // Typical pages have an element every 30 to 100 bytes
+    grow(html.size() / 64 + 64);
+    appendNode(Tag::Unknown, kNone, 0);
+    m_spanEnd[0] = static_cast<uint32_t>(html.size());
+
+    Sink sink{*this, html.data()};
+    HtmlTreeBuilder<Sink> builder(sink, m_openElements, 0);
+    html_detail::tokenize(html.data(), html.size(), builder);
+    builder.finish(html.data() + html.size());
+}
+
+void HtmlDom::clear()
+{
+    m_arena.reset();
+    m_html = boost::string_view();
+    m_size = 0;
+    m_capacity = 0;
+    m_maxDepth = 0;
+    m_attributeLists = nullptr;
+    m_depths = nullptr;
+    m_subtreeSizes = nullptr;
+}
+
+HtmlDom::NodeId HtmlDom::appendNode(Tag tag, NodeId parent, uint32_t spanBegin)
+{
+    if (m_size == m_capacity)
+        grow(static_cast<size_t>(m_capacity) * 2);
+    const NodeId node = m_size++;
+    m_tag[node] = tag;
+    m_parent[node] = parent;
+    m_firstChild[node] = kNone;
+    m_nextSibling[node] = kNone;
+    m_lastChild[node] = kNone;
+    m_spanBegin[node] = spanBegin;
+    m_spanEnd[node] = spanBegin;
+    if (parent != kNone) {
+        if (m_lastChild[parent] == kNone)
+            m_firstChild[parent] = node;
+        else
+            m_nextSibling[m_lastChild[parent]] = node;
+        m_lastChild[parent] = node;
+    }
+    return node;
+}
+
+namespace {
+    template <class T>
+    void growArray(DomArena & arena, T *& array, size_t size, size_t capacity)
+    {
+        T * grown = arena.allocateArray<T>(capacity);
+        if (size)
+            std::memcpy(grown, array, size * sizeof(T));
+        array = grown;
+    }
+}
+
+/**
+ * Moves every array to a larger allocation of the arena. The old arrays
+ * stay in the arena until it is reset; with doubling that wastes at most
+ * as much as the final arrays take.
+ *
+ * @param capacity  new number of nodes
+ */
+void HtmlDom::grow(size_t capacity)
+{
+    if (capacity >= kNone)
+        throw std::length_error("too many html elements");
+    growArray(m_arena, m_tag, m_size, capacity);
+    growArray(m_arena, m_parent, m_size, capacity);
+    growArray(m_arena, m_firstChild, m_size, capacity);
+    growArray(m_arena, m_nextSibling, m_size, capacity);
+    growArray(m_arena, m_lastChild, m_size, capacity);
+    growArray(m_arena, m_spanBegin, m_size, capacity);
+    growArray(m_arena, m_spanEnd, m_size, capacity);
+    m_capacity = static_cast<uint32_t>(capacity);
+}
+
+/**
+ * Counts of the tree, from one linear scan of the tag and first-child
+ * arrays; the maximum depth is recorded while building
+ *
+ * @return element, leaf and div counts and the maximum depth
+ */
+HtmlDom::Metrics HtmlDom::metrics() const
+{
+    Metrics metrics;
+    if (m_size == 0)
+        return metrics;
+    metrics.nodes = m_size - 1;
+    for (NodeId node = 1; node < m_size; ++node) {
+        metrics.leaves += m_firstChild[node] == kNone;
+        metrics.divs += m_tag[node] == Tag::Div;
+    }
+    metrics.maxDepth = m_maxDepth;
+    return metrics;
+}
+
+// Receives the attributes of one start tag
+struct HtmlDom::AttributeCollector {
+    std::vector<HtmlAttribute> & attributes;
+    const char * const base;
+
+    uint32_t offset(const char * p) const { return static_cast<uint32_t>(p - base); }
+
+    // value is nullptr for an attribute without '='
+    void attribute(const char * name, size_t nameLength, const char * value, size_t valueLength)
+    {
+        const char * valueStart = value ? value : name + nameLength;
+        attributes.push_back(HtmlAttribute{offset(name), static_cast<uint32_t>(nameLength),
+                                           offset(valueStart), static_cast<uint32_t>(valueLength)});
+    }
+};
+
+/**
+ * Attribute table of an element, parsed from its start tag if this is the
+ * first time it is asked for. The table of all nodes is allocated on the
+ * first call after a build, so trees whose attributes are never read do
+ * not have one.
+ *
+ * @param node  element
+ * @return the attributes, in source order
+ */
+HtmlDom::Attributes HtmlDom::attributes(NodeId node)
+{
+    if (!m_attributeLists) {
+        m_attributeLists = m_arena.allocateArray<AttributeList>(std::max<uint32_t>(m_size, 1));
+        std::fill(m_attributeLists, m_attributeLists + m_size, AttributeList{nullptr, 0});
+    }
+    AttributeList & list = m_attributeLists[node];
+    if (!list.first)
+        parseAttributes(node, list);
+    return Attributes{list.first, list.first + list.count};
+}
+
+/**
+ * Looks up an attribute by name, parsing the start tag if needed
+ *
+ * @param node  element
+ * @param name  attribute name, any case
+ * @param value receives the value if found
+ * @return whether the element has the attribute
+ */
+bool HtmlDom::findAttribute(NodeId node, boost::string_view name, boost::string_view & value)
+{
+    for (const HtmlAttribute & attribute : attributes(node)) {
+        const boost::string_view attributeName = this->attributeName(attribute);
+        if (html_detail::equalsIgnoreCase(attributeName.data(), attributeName.size(), name.data(), name.size())) {
+            value = attributeValue(attribute);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reads the attributes of the start tag at the beginning of a node's span
+ * into the arena. An implied element begins at the tag that implied it,
+ * which is another tag (or an end tag), so it gets none.
+ *
+ * @param node  element
+ * @param list  receives the table
+ */
+void HtmlDom::parseAttributes(NodeId node, AttributeList & list)
+{
+    using namespace html_detail;
+    static const HtmlAttribute kNoAttributes[1] = {};
+    list = AttributeList{kNoAttributes, 0};
+
+    const char * const end = m_html.data() + m_html.size();
+    const char * p = m_html.data() + m_spanBegin[node];
+    if (node == 0 || end - p < 2 || *p != '<' || !isAlpha(p[1]))
+        return;
+    const char * name = p + 1;
+    p = scanTagName(name, end);
+    if (m_tag[node] != Tag::Unknown && lookupTag(name, p - name) != m_tag[node])
+        return;
+
+    m_attributeScratch.clear();
+    AttributeCollector collector{m_attributeScratch, m_html.data()};
+    bool selfClosing = false;
+    readAttributes(p, end, collector, selfClosing);
+    if (m_attributeScratch.empty())
+        return;
+    HtmlAttribute * table = m_arena.allocateArray<HtmlAttribute>(m_attributeScratch.size());
+    std::copy(m_attributeScratch.begin(), m_attributeScratch.end(), table);
+    list = AttributeList{table, static_cast<uint32_t>(m_attributeScratch.size())};
+}
+
+/**
+ * Depth of every node (the document is 0): one forward pass, since a
+ * parent's id is smaller than its children's. Computed on the first call
+ * after a build, later calls return the same array.
+ *
+ * @return array of size() depths in the arena
+ */
+const uint32_t * HtmlDom::depths()
+{
+    if (m_depths)
+        return m_depths;
+    uint32_t * depth = m_arena.allocateArray<uint32_t>(std::max<uint32_t>(m_size, 1));
+    depth[0] = 0;
+    for (NodeId node = 1; node < m_size; ++node)
+        depth[node] = depth[m_parent[node]] + 1;
+    m_depths = depth;
+    return depth;
+}
+
+/**
+ * Number of elements in every subtree: one backward pass adding each
+ * node's count to its parent's. Computed on the first call after a build,
+ * later calls return the same array.
+ *
+ * @return array of size() counts in the arena
+ */
+const uint32_t * HtmlDom::subtreeSizes()
+{
+    if (m_subtreeSizes)
+        return m_subtreeSizes;
+    uint32_t * sizes = m_arena.allocateArray<uint32_t>(std::max<uint32_t>(m_size, 1));
+    std::fill(sizes, sizes + m_size, 1u);
+    for (NodeId node = m_size; node-- > 1; )
+        sizes[m_parent[node]] += sizes[node];
+    if (m_size)
+        sizes[0] -= 1;  // the document node is not an element
+    m_subtreeSizes = sizes;
+    return sizes;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <HtmlTags.hpp>
+#include <HtmlTreeBuilder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+// Bump allocator for the data of one document. Memory is handed out from
+// large blocks and given back all at once by reset(), which keeps the
+// blocks for the next document, so a reused arena stops allocating once it
+// has seen the largest document.
+class DomArena final {
+public:
+    explicit DomArena(size_t blockSize = 1 << 20) : m_blockSize(blockSize) {}
+    DomArena(const DomArena &) = delete;
+    DomArena & operator=(const DomArena &) = delete;
+
+    void * allocate(size_t bytes, size_t alignment);
+
+    template <class T>
+    T * allocateArray(size_t count)
+    {
+        return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void reset();
+    // Frees the blocks too
+    void release();
+    size_t bytesReserved() const;
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> m_blocks;
+    size_t m_blockSize;
+    size_t m_current = 0;   // block being filled
+    size_t m_used = 0;      // bytes used in it
+};
+
+// An attribute of an element, as offsets into the document. The value has
+// no quotes and is not entity-decoded (decodeHtml); it is empty for an
+// attribute without '='.
+struct HtmlAttribute {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t valueOffset;
+    uint32_t valueLength;
+};
+
+// Element tree of one document in structure-of-arrays form: one array per
+// field (tag id, parent, first child, next sibling, source span), indexed by
+// node id, all in one arena. Node 0 is the document; elements are numbered
+// in document order, so a parent always comes before its children and tree
+// metrics are single linear scans. build() and clear() reset the arena:
+// freeing a document costs nothing.
+//
+// The tree is the one a browser builds (HtmlTreeBuilder.hpp): implied end
+// tags close paragraphs, list items and cells, and the html, head and body
+// elements always exist.
+//
+// Building records nothing about attributes. An element's start tag is
+// parsed into an attribute table the first time its attributes are asked
+// for, so structural analyses never pay for attribute parsing.
+class HtmlDom final {
+public:
+    typedef uint32_t NodeId;
+    static const NodeId kNone = 0xffffffffu;
+
+    HtmlDom() = default;
+    HtmlDom(const HtmlDom &) = delete;
+    HtmlDom & operator=(const HtmlDom &) = delete;
+
+    // The document must outlive the tree and be smaller than 4 GB
+    void build(boost::string_view html);
+    void clear();
+
+    // Number of nodes, including the document node
+    uint32_t size() const { return m_size; }
+    Tag tag(NodeId node) const { return m_tag[node]; }
+    NodeId parent(NodeId node) const { return m_parent[node]; }
+    NodeId firstChild(NodeId node) const { return m_firstChild[node]; }
+    NodeId nextSibling(NodeId node) const { return m_nextSibling[node]; }
+    // From the '<' of the start tag to the '>' of the end tag, or to where
+    // the element was implicitly closed
+    boost::string_view source(NodeId node) const
+    {
+        return m_html.substr(m_spanBegin[node], m_spanEnd[node] - m_spanBegin[node]);
+    }
+
+    struct Attributes {
+        const HtmlAttribute * first;
+        const HtmlAttribute * last;
+
+        const HtmlAttribute * begin() const { return first; }
+        const HtmlAttribute * end() const { return last; }
+        size_t size() const { return last - first; }
+    };
+    // Attributes of an element in source order (none for implied elements
+    // and the document), in the arena: valid until the next build or clear
+    Attributes attributes(NodeId node);
+    // Value of the element's first attribute of that name (compared without
+    // case); false if it has none
+    bool findAttribute(NodeId node, boost::string_view name, boost::string_view & value);
+    boost::string_view attributeName(const HtmlAttribute & attribute) const
+    {
+        return m_html.substr(attribute.nameOffset, attribute.nameLength);
+    }
+    boost::string_view attributeValue(const HtmlAttribute & attribute) const
+    {
+        return m_html.substr(attribute.valueOffset, attribute.valueLength);
+    }
+
+    struct Metrics {
+        uint64_t nodes = 0;     // elements
+        uint64_t leaves = 0;    // elements without child elements
+        uint64_t divs = 0;
+        uint32_t maxDepth = 0;  // children of the document have depth 1
+    };
+    Metrics metrics() const;
+
+    // Per node, in arrays taken from the arena on first use and kept until
+    // the next build or clear
+    const uint32_t * depths();
+    const uint32_t * subtreeSizes();    // elements in the subtree, itself included
+
+    size_t arenaBytes() const { return m_arena.bytesReserved(); }
+
+private:
+    struct Sink;
+    struct AttributeCollector;
+
+    // Attribute table of a node; first is null until it is parsed
+    struct AttributeList {
+        const HtmlAttribute * first;
+        uint32_t count;
+    };
+
+    NodeId appendNode(Tag tag, NodeId parent, uint32_t spanBegin);
+    void grow(size_t capacity);
+    void parseAttributes(NodeId node, AttributeList & list);
+
+    DomArena m_arena;
+    boost::string_view m_html;
+    uint32_t m_size = 0;
+    uint32_t m_capacity = 0;
+    Tag * m_tag = nullptr;
+    NodeId * m_parent = nullptr;
+    NodeId * m_firstChild = nullptr;
+    NodeId * m_nextSibling = nullptr;
+    NodeId * m_lastChild = nullptr;     // for appending, used while building
+    uint32_t * m_spanBegin = nullptr;
+    uint32_t * m_spanEnd = nullptr;
+    uint32_t m_maxDepth = 0;
+    AttributeList * m_attributeLists = nullptr;     // allocated on first use
+    uint32_t * m_depths = nullptr;                  // computed on first use
+    uint32_t * m_subtreeSizes = nullptr;            // computed on first use
+    std::vector<HtmlAttribute> m_attributeScratch;  // reused across parses
+    OpenElementStack m_openElements;    // reused across builds
+};
@@ -0,0 +1,181 @@
+#include <HtmlEntities.hpp>
+#include <HtmlEntityTrie.hpp>
+#include <SimdScan.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+    using html_detail::EntityNode;
+    using html_detail::kEntityNodes;
+    using html_detail::kEntityValues;
+
+    const uint32_t kReplacementCharacter = 0xfffd;
+
+    // What numeric references to 0x80-0x9F mean: those bytes in windows-1252
+    const uint16_t kC1Replacements[32] = {
+        0x20ac, 0x0081, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+        0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008d, 0x017d, 0x008f,
+        0x0090, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+        0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x009d, 0x017e, 0x0178
+    };
+
+    bool isDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    bool isAlphanumeric(char c)
+    {
+        return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    int hexValue(char c)
+    {
+        if (isDigit(c))
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    }
+
+    void appendUtf8(std::string & out, uint32_t codePoint)
+    {
+        if (codePoint < 0x80) {
+            out += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            out += static_cast<char>(0xc0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3f));
+        } else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xe0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (codePoint & 0x3f));
+        } else {
+            out += static_cast<char>(0xf0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (codePoint & 0x3f));
+        }
+    }
+
+    /**
+     * Decodes "&#123;" or "&#x7B;"; the ';' is optional
+     *
+     * @param p     first character after "&#"
+     * @param end   end of the text
+     * @param out   receives the character
+     * @return position after the reference, or nullptr if there are no digits
+     */
+    const char * decodeNumeric(const char * p, const char * end, std::string & out)
+    {
+        const bool hex = p < end && (*p == 'x' || *p == 'X');
+        const char * digits = p += hex;
+        uint32_t codePoint = 0;
+        for (; p < end; ++p) {
+            const int digit = hex ? hexValue(*p) : (isDigit(*p) ? *p - '0' : -1);
+            if (digit < 0)
+                break;
+            // Saturates: anything above U+10FFFF is replaced anyway
+            codePoint = std::min<uint32_t>(codePoint * (hex ? 16 : 10) + digit, 0x110000);
+        }
+        if (p == digits)
+            return nullptr;
+        if (p < end && *p == ';')
+            ++p;
+
+        if (codePoint == 0 || codePoint > 0x10ffff || (codePoint >= 0xd800 && codePoint <= 0xdfff))
+            codePoint = kReplacementCharacter;
+        else if (codePoint >= 0x80 && codePoint <= 0x9f)
+            codePoint = kC1Replacements[codePoint - 0x80];
+        appendUtf8(out, codePoint);
+        return p;
+    }
+
+    /**
+     * Walks the entity trie along the text for the longest name that ends
+     * in a node with a value
+     *
+     * @param p         first character after '&'
+     * @param end       end of the text
+     * @param match     receives the node of the longest name
+     * @return position after the longest name, or nullptr if none matches
+     */
+    const char * longestEntity(const char * p, const char * end, const EntityNode *& match)
+    {
+        const char * matchEnd = nullptr;
+        const EntityNode * node = &kEntityNodes[0];
+        for (; p < end && node->childCount; ++p) {
+            const EntityNode * first = &kEntityNodes[node->firstChild];
+            const EntityNode * last = first + node->childCount;
+            const char c = *p;
+            node = std::lower_bound(first, last, c, [](const EntityNode & n, char key) { return n.c < key; });
+            if (node == last || node->c != c)
+                break;
+            if (node->valueLength) {
+                match = node;
+                matchEnd = p + 1;
+            }
+        }
+        return matchEnd;
+    }
+}
+
+/**
+ * Copies text, decoding the character references in it. Runs between
+ * references are found with the SIMD scanner and appended whole.
+ *
+ * @param raw           text or attribute value as it is in the page
+ * @param out           receives the decoded text (appended)
+ * @param inAttribute   apply the attribute value rule for legacy names
+ */
+void decodeCharacterReferences(boost::string_view raw, std::string & out, bool inAttribute)
+{
+    const char * p = raw.data();
+    const char * const end = p + raw.size();
+    while (p < end) {
+        const char * amp = simd::find(p, end, '&');
+        out.append(p, amp);
+        if (amp == end)
+            return;
+        p = amp + 1;
+
+        if (p < end && *p == '#') {
+            if (const char * next = decodeNumeric(p + 1, end, out)) {
+                p = next;
+                continue;
+            }
+        } else {
+            const EntityNode * match = nullptr;
+            const char * nameEnd = longestEntity(p, end, match);
+            const bool legacyInAttribute = inAttribute && nameEnd && nameEnd[-1] != ';'
+                                           && nameEnd < end && (*nameEnd == '=' || isAlphanumeric(*nameEnd));
+            if (nameEnd && !legacyInAttribute) {
+                out.append(kEntityValues + match->valueOffset, match->valueLength);
+                p = nameEnd;
+                continue;
+            }
+        }
+        // Not a reference: the '&' is text
+        out += '&';
+    }
+}
+
+/**
+ * Decoded text for a consumer that may not need a copy
+ *
+ * @param raw           text or attribute value as it is in the page
+ * @param scratch       buffer for the decoded text, overwritten
+ * @param inAttribute   apply the attribute value rule for legacy names
+ * @return raw when it has no '&', else a view of scratch
+ */
+boost::string_view decodeHtml(boost::string_view raw, std::string & scratch, bool inAttribute)
+{
+    const char * amp = simd::find(raw.data(), raw.data() + raw.size(), '&');
+    if (amp == raw.data() + raw.size())
+        return raw;
+    scratch.assign(raw.data(), amp);
+    decodeCharacterReferences(raw.substr(amp - raw.data()), scratch, inAttribute);
+    return scratch;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include <boost/utility/string_view.hpp>
+
+// Character references ("&amp;", "&#x27;", "&eacute;" and the other named
+// ones) in text and attribute values. The tokenizer leaves them as they are;
+// a consumer that needs the decoded text asks for it, so pages whose text is
+// never looked at pay nothing, and text without '&' is found with one SIMD
+// scan and returned without a copy.
+//
+// Decoding follows the HTML tokenizer: the longest name in the table wins,
+// also without its ';' for the legacy names ("&copy 2021"); numeric
+// references are decoded without ';' too, and invalid code points become
+// U+FFFD. In attribute values a legacy name followed by '=' or an
+// alphanumeric character is left alone ("?a=1&copy=2").
+
+// Appends raw to out with its character references decoded
+void decodeCharacterReferences(boost::string_view raw, std::string & out, bool inAttribute = false);
+
+// raw itself if it has no '&', else raw decoded into scratch
+boost::string_view decodeHtml(boost::string_view raw, std::string & scratch, bool inAttribute = false);
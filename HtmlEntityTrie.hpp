@@ -0,0 +1,1866 @@
+#pragma once
+
+// Generated by tools/gen_entity_trie.py from the WHATWG entities.json; do
+// not edit.
+
+#include <cstddef>
+#include <cstdint>
+
+// The named character references of HTML (2231 names, with and without the
+// trailing ';' for the legacy ones), from the WHATWG entities.json, as a trie
+// laid out breadth-first: the children of a node are consecutive and sorted
+// by character, so a lookup is one binary search per input character. Node 0
+// is the root. The replacement text of a name is the valueLength bytes of
+// UTF-8 at valueOffset in kEntityValues; identical values are stored once.
+namespace html_detail {
+    struct EntityNode {
+        char c;                 // character that leads to this node
+        uint8_t childCount;
+        uint16_t firstChild;
+        uint16_t valueOffset;
+        uint8_t valueLength;    // 0 if no name ends here
+    };
+
+    constexpr EntityNode kEntityNodes[] = {
+    {'\0',52,1,0,0}, {'A',16,53,0,0}, {'B',8,69,0,0}, {'C',14,77,0,0}, {'D',11,91,0,0}, {'E',16,102,0,0},
+    {'F',5,118,0,0}, {'G',12,123,0,0}, {'H',8,135,0,0}, {'I',14,143,0,0}, {'J',5,157,0,0}, {'K',7,162,0,0},
+    {'L',11,169,0,0}, {'M',8,180,0,0}, {'N',9,188,0,0}, {'O',14,197,0,0}, {'P',9,211,0,0}, {'Q',4,220,0,0},
+    {'R',12,224,0,0}, {'S',13,236,0,0}, {'T',11,249,0,0}, {'U',14,260,0,0}, {'V',9,274,0,0}, {'W',5,283,0,0},
+    {'X',4,288,0,0}, {'Y',9,292,0,0}, {'Z',8,301,0,0}, {'a',16,309,0,0}, {'b',16,325,0,0}, {'c',15,341,0,0},
+    {'d',19,356,0,0}, {'e',18,375,0,0}, {'f',12,393,0,0}, {'g',17,405,0,0}, {'h',10,422,0,0}, {'i',15,432,0,0},
+    {'j',6,447,0,0}, {'k',8,453,0,0}, {'l',23,461,0,0}, {'m',14,484,0,0}, {'n',24,498,0,0}, {'o',18,522,0,0},
+    {'p',12,540,0,0}, {'q',6,552,0,0}, {'r',21,558,0,0}, {'s',19,579,0,0}, {'t',13,598,0,0}, {'u',18,611,0,0},
+    {'v',15,629,0,0}, {'w',7,644,0,0}, {'x',14,651,0,0}, {'y',8,665,0,0}, {'z',10,673,0,0}, {'E',1,683,0,0},
+    {'M',1,684,0,0}, {'a',1,685,0,0}, {'b',1,686,0,0}, {'c',2,687,0,0}, {'f',1,689,0,0}, {'g',1,690,0,0},
+    {'l',1,691,0,0}, {'m',1,692,0,0}, {'n',1,693,0,0}, {'o',2,694,0,0}, {'p',1,696,0,0}, {'r',1,697,0,0},
+    {'s',2,698,0,0}, {'t',1,700,0,0}, {'u',1,701,0,0}, {'a',2,702,0,0}, {'c',1,704,0,0}, {'e',3,705,0,0},
+    {'f',1,708,0,0}, {'o',1,709,0,0}, {'r',1,710,0,0}, {'s',1,711,0,0}, {'u',1,712,0,0}, {'H',1,713,0,0},
+    {'O',1,714,0,0}, {'a',3,715,0,0}, {'c',4,718,0,0}, {'d',1,722,0,0}, {'e',2,723,0,0}, {'f',1,725,0,0},
+    {'h',1,726,0,0}, {'i',1,727,0,0}, {'l',1,728,0,0}, {'o',4,729,0,0}, {'r',1,733,0,0}, {'s',1,734,0,0},
+    {'u',1,735,0,0}, {'D',2,736,0,0}, {'J',1,738,0,0}, {'S',1,739,0,0}, {'Z',1,740,0,0}, {'a',3,741,0,0},
+    {'c',2,744,0,0}, {'e',1,746,0,0}, {'f',1,747,0,0}, {'i',2,748,0,0}, {'o',4,750,0,0}, {'s',2,754,0,0},
+    {'N',1,756,0,0}, {'T',1,757,0,0}, {'a',1,758,0,0}, {'c',3,759,0,0}, {'d',1,762,0,0}, {'f',1,763,0,0},
+    {'g',1,764,0,0}, {'l',1,765,0,0}, {'m',2,766,0,0}, {'o',2,768,0,0}, {'p',1,770,0,0}, {'q',1,771,0,0},
+    {'s',2,772,0,0}, {'t',1,774,0,0}, {'u',1,775,0,0}, {'x',2,776,0,0}, {'c',1,778,0,0}, {'f',1,779,0,0},
+    {'i',1,780,0,0}, {'o',3,781,0,0}, {'s',1,784,0,0}, {'J',1,785,0,0}, {'T',1,786,0,1}, {'a',1,787,0,0},
+    {'b',1,788,0,0}, {'c',3,789,0,0}, {'d',1,792,0,0}, {'f',1,793,0,0}, {'g',1,794,0,0}, {'o',1,795,0,0},
+    {'r',1,796,0,0}, {'s',1,797,0,0}, {'t',1,798,0,0}, {'A',1,799,0,0}, {'a',2,800,0,0}, {'c',1,802,0,0},
+    {'f',1,803,0,0}, {'i',1,804,0,0}, {'o',2,805,0,0}, {'s',2,807,0,0}, {'u',1,809,0,0}, {'E',1,810,0,0},
+    {'J',1,811,0,0}, {'O',1,812,0,0}, {'a',1,813,0,0}, {'c',2,814,0,0}, {'d',1,816,0,0}, {'f',1,817,0,0},
+    {'g',1,818,0,0}, {'m',3,819,0,0}, {'n',2,822,0,0}, {'o',3,824,0,0}, {'s',1,827,0,0}, {'t',1,828,0,0},
+    {'u',2,829,0,0}, {'c',2,831,0,0}, {'f',1,833,0,0}, {'o',1,834,0,0}, {'s',2,835,0,0}, {'u',1,837,0,0},
+    {'H',1,838,0,0}, {'J',1,839,0,0}, {'a',1,840,0,0}, {'c',2,841,0,0}, {'f',1,843,0,0}, {'o',1,844,0,0},
+    {'s',1,845,0,0}, {'J',1,846,0,0}, {'T',1,847,1,1}, {'a',5,848,0,0}, {'c',3,853,0,0}, {'e',2,856,0,0},
+    {'f',1,858,0,0}, {'l',2,859,0,0}, {'m',1,861,0,0}, {'o',3,862,0,0}, {'s',3,865,0,0}, {'t',1,868,0,0},
+    {'a',1,869,0,0}, {'c',1,870,0,0}, {'e',2,871,0,0}, {'f',1,873,0,0}, {'i',1,874,0,0}, {'o',1,875,0,0},
+    {'s',1,876,0,0}, {'u',1,877,0,0}, {'J',1,878,0,0}, {'a',1,879,0,0}, {'c',3,880,0,0}, {'e',3,883,0,0},
+    {'f',1,886,0,0}, {'o',4,887,0,0}, {'s',1,891,0,0}, {'t',1,892,0,0}, {'u',1,893,0,0}, {'E',1,894,0,0},
+    {'a',1,895,0,0}, {'c',2,896,0,0}, {'d',1,898,0,0}, {'f',1,899,0,0}, {'g',1,900,0,0}, {'m',3,901,0,0},
+    {'o',1,904,0,0}, {'p',1,905,0,0}, {'r',1,906,0,0}, {'s',2,907,0,0}, {'t',1,909,0,0}, {'u',1,910,0,0},
+    {'v',1,911,0,0}, {'a',1,912,0,0}, {'c',1,913,0,0}, {'f',1,914,0,0}, {'h',1,915,0,0}, {'i',1,916,0,0},
+    {'l',1,917,0,0}, {'o',2,918,0,0}, {'r',4,920,0,0}, {'s',2,924,0,0}, {'U',1,926,0,0}, {'f',1,927,0,0},
+    {'o',1,928,0,0}, {'s',1,929,0,0}, {'B',1,930,0,0}, {'E',1,931,0,0}, {'a',3,932,0,0}, {'c',3,935,0,0},
+    {'e',2,938,0,0}, {'f',1,940,0,0}, {'h',1,941,0,0}, {'i',1,942,0,0}, {'o',2,943,0,0}, {'r',1,945,0,0},
+    {'s',2,946,0,0}, {'u',1,948,0,0}, {'H',2,949,0,0}, {'O',1,951,0,0}, {'a',1,952,0,0}, {'c',5,953,0,0},
+    {'f',1,958,0,0}, {'h',1,959,0,0}, {'i',1,960,0,0}, {'m',1,961,0,0}, {'o',1,962,0,0}, {'q',2,963,0,0},
+    {'s',1,965,0,0}, {'t',1,966,0,0}, {'u',4,967,0,0}, {'H',1,971,0,0}, {'R',1,972,0,0}, {'S',2,973,0,0},
+    {'a',2,975,0,0}, {'c',3,977,0,0}, {'f',1,980,0,0}, {'h',2,981,0,0}, {'i',1,983,0,0}, {'o',1,984,0,0},
+    {'r',1,985,0,0}, {'s',2,986,0,0}, {'a',2,988,0,0}, {'b',1,990,0,0}, {'c',2,991,0,0}, {'d',1,993,0,0},
+    {'f',1,994,0,0}, {'g',1,995,0,0}, {'m',1,996,0,0}, {'n',2,997,0,0}, {'o',2,999,0,0}, {'p',8,1001,0,0},
+    {'r',1,1009,0,0}, {'s',1,1010,0,0}, {'t',1,1011,0,0}, {'u',1,1012,0,0}, {'D',1,1013,0,0}, {'b',1,1014,0,0},
+    {'c',1,1015,0,0}, {'d',1,1016,0,0}, {'e',2,1017,0,0}, {'f',1,1019,0,0}, {'o',1,1020,0,0}, {'s',1,1021,0,0},
+    {'v',1,1022,0,0}, {'c',1,1023,0,0}, {'e',1,1024,0,0}, {'f',1,1025,0,0}, {'o',1,1026,0,0}, {'s',1,1027,0,0},
+    {'f',1,1028,0,0}, {'i',1,1029,0,0}, {'o',1,1030,0,0}, {'s',1,1031,0,0}, {'A',1,1032,0,0}, {'I',1,1033,0,0},
+    {'U',1,1034,0,0}, {'a',1,1035,0,0}, {'c',2,1036,0,0}, {'f',1,1038,0,0}, {'o',1,1039,0,0}, {'s',1,1040,0,0},
+    {'u',1,1041,0,0}, {'H',1,1042,0,0}, {'a',1,1043,0,0}, {'c',2,1044,0,0}, {'d',1,1046,0,0}, {'e',2,1047,0,0},
+    {'f',1,1049,0,0}, {'o',1,1050,0,0}, {'s',1,1051,0,0}, {'a',1,1052,0,0}, {'b',1,1053,0,0}, {'c',6,1054,0,0},
+    {'e',1,1060,0,0}, {'f',2,1061,0,0}, {'g',1,1063,0,0}, {'l',2,1064,0,0}, {'m',2,1066,0,0}, {'n',2,1068,0,0},
+    {'o',2,1070,0,0}, {'p',7,1072,0,0}, {'r',1,1079,0,0}, {'s',3,1080,0,0}, {'t',1,1083,0,0}, {'u',1,1084,0,0},
+    {'w',2,1085,0,0}, {'N',1,1087,0,0}, {'a',2,1088,0,0}, {'b',1,1090,0,0}, {'c',2,1091,0,0}, {'d',1,1093,0,0},
+    {'e',5,1094,0,0}, {'f',1,1099,0,0}, {'i',1,1100,0,0}, {'k',1,1101,0,0}, {'l',3,1102,0,0}, {'n',2,1105,0,0},
+    {'o',4,1107,0,0}, {'p',1,1111,0,0}, {'r',2,1112,0,0}, {'s',4,1114,0,0}, {'u',2,1118,0,0}, {'a',3,1120,0,0},
+    {'c',4,1123,0,0}, {'d',1,1127,0,0}, {'e',3,1128,0,0}, {'f',1,1131,0,0}, {'h',3,1132,0,0}, {'i',1,1135,0,0},
+    {'l',1,1136,0,0}, {'o',4,1137,0,0}, {'r',2,1141,0,0}, {'s',2,1143,0,0}, {'t',1,1145,0,0}, {'u',7,1146,0,0},
+    {'w',2,1153,0,0}, {'y',1,1155,0,0}, {'A',1,1156,0,0}, {'H',1,1157,0,0}, {'a',4,1158,0,0}, {'b',2,1162,0,0},
+    {'c',2,1164,0,0}, {'d',3,1166,0,0}, {'e',3,1169,0,0}, {'f',2,1172,0,0}, {'h',1,1174,0,0}, {'i',5,1175,0,0},
+    {'j',1,1180,0,0}, {'l',1,1181,0,0}, {'o',5,1182,0,0}, {'r',2,1187,0,0}, {'s',3,1189,0,0}, {'t',2,1192,0,0},
+    {'u',2,1194,0,0}, {'w',1,1196,0,0}, {'z',2,1197,0,0}, {'D',2,1199,0,0}, {'a',2,1201,0,0}, {'c',4,1203,0,0},
+    {'d',1,1207,0,0}, {'e',1,1208,0,0}, {'f',2,1209,0,0}, {'g',3,1211,0,0}, {'l',4,1214,0,0}, {'m',3,1218,0,0},
+    {'n',2,1221,0,0}, {'o',2,1223,0,0}, {'p',3,1225,0,0}, {'q',4,1228,0,0}, {'r',2,1232,0,0}, {'s',3,1234,0,0},
+    {'t',2,1237,0,0}, {'u',2,1239,0,0}, {'x',3,1241,0,0}, {'a',1,1244,0,0}, {'c',1,1245,0,0}, {'e',1,1246,0,0},
+    {'f',3,1247,0,0}, {'i',1,1250,0,0}, {'j',1,1251,0,0}, {'l',3,1252,0,0}, {'n',1,1255,0,0}, {'o',2,1256,0,0},
+    {'p',1,1258,0,0}, {'r',2,1259,0,0}, {'s',1,1261,0,0}, {'E',2,1262,0,0}, {'a',3,1264,0,0}, {'b',1,1267,0,0},
+    {'c',2,1268,0,0}, {'d',1,1270,0,0}, {'e',4,1271,0,0}, {'f',1,1275,0,0}, {'g',2,1276,0,0}, {'i',1,1278,0,0},
+    {'j',1,1279,0,0}, {'l',4,1280,0,0}, {'n',4,1284,0,0}, {'o',1,1288,0,0}, {'r',1,1289,0,0}, {'s',2,1290,0,0},
+    {'t',6,1292,0,1}, {'v',2,1298,0,0}, {'A',1,1300,0,0}, {'a',4,1301,0,0}, {'b',1,1305,0,0}, {'c',1,1306,0,0},
+    {'e',3,1307,0,0}, {'f',1,1310,0,0}, {'k',1,1311,0,0}, {'o',5,1312,0,0}, {'s',3,1317,0,0}, {'y',2,1320,0,0},
+    {'a',1,1322,0,0}, {'c',3,1323,0,0}, {'e',2,1326,0,0}, {'f',2,1328,0,0}, {'g',1,1330,0,0}, {'i',4,1331,0,0},
+    {'j',1,1335,0,0}, {'m',3,1336,0,0}, {'n',5,1339,0,0}, {'o',4,1344,0,0}, {'p',1,1348,0,0}, {'q',1,1349,0,0},
+    {'s',2,1350,0,0}, {'t',2,1352,0,0}, {'u',2,1354,0,0}, {'c',2,1356,0,0}, {'f',1,1358,0,0}, {'m',1,1359,0,0},
+    {'o',1,1360,0,0}, {'s',2,1361,0,0}, {'u',1,1363,0,0}, {'a',1,1364,0,0}, {'c',2,1365,0,0}, {'f',1,1367,0,0},
+    {'g',1,1368,0,0}, {'h',1,1369,0,0}, {'j',1,1370,0,0}, {'o',1,1371,0,0}, {'s',1,1372,0,0}, {'A',3,1373,0,0},
+    {'B',1,1376,0,0}, {'E',2,1377,0,0}, {'H',1,1379,0,0}, {'a',9,1380,0,0}, {'b',3,1389,0,0}, {'c',4,1392,0,0},
+    {'d',4,1396,0,0}, {'e',5,1400,0,0}, {'f',3,1405,0,0}, {'g',2,1408,0,0}, {'h',2,1410,0,0}, {'j',1,1412,0,0},
+    {'l',5,1413,0,0}, {'m',2,1418,0,0}, {'n',4,1420,0,0}, {'o',8,1424,0,0}, {'p',1,1432,0,0}, {'r',5,1433,0,0},
+    {'s',6,1438,0,0}, {'t',8,1444,1,1}, {'u',1,1452,0,0}, {'v',2,1453,0,0}, {'D',1,1455,0,0}, {'a',4,1456,0,0},
+    {'c',2,1460,0,0}, {'d',1,1462,0,0}, {'e',1,1463,0,0}, {'f',1,1464,0,0}, {'h',1,1465,0,0}, {'i',3,1466,0,0},
+    {'l',2,1469,0,0}, {'n',1,1471,0,0}, {'o',2,1472,0,0}, {'p',1,1474,0,0}, {'s',2,1475,0,0}, {'u',3,1477,0,0},
+    {'G',2,1480,0,0}, {'L',3,1482,0,0}, {'R',1,1485,0,0}, {'V',2,1486,0,0}, {'a',5,1488,0,0}, {'b',2,1493,0,0},
+    {'c',5,1495,0,0}, {'d',1,1500,0,0}, {'e',7,1501,0,0}, {'f',1,1508,0,0}, {'g',4,1509,0,0}, {'h',3,1513,0,0},
+    {'i',3,1516,0,0}, {'j',1,1519,0,0}, {'l',7,1520,0,0}, {'m',1,1527,0,0}, {'o',2,1528,0,0}, {'p',3,1530,0,0},
+    {'r',4,1533,0,0}, {'s',7,1537,0,0}, {'t',4,1544,0,0}, {'u',2,1548,0,0}, {'v',9,1550,0,0}, {'w',3,1559,0,0},
+    {'S',1,1562,0,0}, {'a',2,1563,0,0}, {'c',2,1565,0,0}, {'d',5,1567,0,0}, {'e',1,1572,0,0}, {'f',2,1573,0,0},
+    {'g',3,1575,0,0}, {'h',2,1578,0,0}, {'i',1,1580,0,0}, {'l',4,1581,0,0}, {'m',3,1585,0,0}, {'o',1,1588,0,0},
+    {'p',3,1589,0,0}, {'r',7,1592,0,0}, {'s',3,1599,0,0}, {'t',1,1602,0,0}, {'u',1,1603,0,0}, {'v',1,1604,0,0},
+    {'a',1,1605,0,0}, {'c',1,1606,0,0}, {'e',1,1607,0,0}, {'f',1,1608,0,0}, {'h',3,1609,0,0}, {'i',3,1612,0,0},
+    {'l',2,1615,0,0}, {'m',1,1617,0,0}, {'o',3,1618,0,0}, {'r',10,1621,0,0}, {'s',2,1631,0,0}, {'u',1,1633,0,0},
+    {'f',1,1634,0,0}, {'i',1,1635,0,0}, {'o',1,1636,0,0}, {'p',1,1637,0,0}, {'s',1,1638,0,0}, {'u',3,1639,0,0},
+    {'A',3,1642,0,0}, {'B',1,1645,0,0}, {'H',1,1646,0,0}, {'a',7,1647,0,0}, {'b',3,1654,0,0}, {'c',4,1657,0,0},
+    {'d',4,1661,0,0}, {'e',3,1665,0,0}, {'f',3,1668,0,0}, {'h',2,1671,0,0}, {'i',3,1673,0,0}, {'l',3,1676,0,0},
+    {'m',1,1679,0,0}, {'n',1,1680,0,0}, {'o',4,1681,0,0}, {'p',2,1685,0,0}, {'r',1,1687,0,0}, {'s',4,1688,0,0},
+    {'t',3,1692,0,0}, {'u',1,1695,0,0}, {'x',1,1696,0,0}, {'a',1,1697,0,0}, {'b',1,1698,0,0}, {'c',10,1699,0,0},
+    {'d',1,1709,0,0}, {'e',7,1710,0,0}, {'f',1,1717,0,0}, {'h',4,1718,0,0}, {'i',2,1722,0,0}, {'l',1,1724,0,0},
+    {'m',4,1725,0,0}, {'o',3,1729,0,0}, {'p',1,1732,0,0}, {'q',3,1733,0,0}, {'r',1,1736,0,0}, {'s',4,1737,0,0},
+    {'t',2,1741,0,0}, {'u',5,1743,0,0}, {'w',3,1748,0,0}, {'z',1,1751,0,0}, {'a',2,1752,0,0}, {'b',1,1754,0,0},
+    {'c',3,1755,0,0}, {'d',1,1758,0,0}, {'e',1,1759,0,0}, {'f',1,1760,0,0}, {'h',4,1761,0,0}, {'i',3,1765,0,0},
+    {'o',3,1768,0,0}, {'p',1,1771,0,0}, {'r',3,1772,0,0}, {'s',3,1775,0,0}, {'w',2,1778,0,0}, {'A',1,1780,0,0},
+    {'H',1,1781,0,0}, {'a',2,1782,0,0}, {'b',1,1784,0,0}, {'c',2,1785,0,0}, {'d',3,1787,0,0}, {'f',2,1790,0,0},
+    {'g',1,1792,0,0}, {'h',2,1793,0,0}, {'l',2,1795,0,0}, {'m',2,1797,0,0}, {'o',2,1799,0,0}, {'p',6,1801,0,0},
+    {'r',3,1807,0,0}, {'s',1,1810,0,0}, {'t',3,1811,0,0}, {'u',2,1814,0,0}, {'w',1,1816,0,0}, {'A',1,1817,0,0},
+    {'B',1,1818,0,0}, {'D',1,1819,0,0}, {'a',2,1820,0,0}, {'c',1,1822,0,0}, {'d',1,1823,0,0}, {'e',3,1824,0,0},
+    {'f',1,1827,0,0}, {'l',1,1828,0,0}, {'n',1,1829,0,0}, {'o',1,1830,0,0}, {'p',1,1831,0,0}, {'r',1,1832,0,0},
+    {'s',2,1833,0,0}, {'z',1,1835,0,0}, {'c',1,1836,0,0}, {'e',2,1837,0,0}, {'f',1,1839,0,0}, {'o',1,1840,0,0},
+    {'p',1,1841,0,0}, {'r',2,1842,0,0}, {'s',1,1844,0,0}, {'c',3,1845,0,0}, {'d',1,1848,0,0}, {'f',1,1849,0,0},
+    {'h',2,1850,0,0}, {'i',1,1852,0,0}, {'l',2,1853,0,0}, {'m',1,1855,0,0}, {'n',1,1856,0,0}, {'o',3,1857,0,0},
+    {'r',2,1860,0,0}, {'s',2,1862,0,0}, {'u',2,1864,0,0}, {'v',1,1866,0,0}, {'w',1,1867,0,0}, {'a',1,1868,0,0},
+    {'c',2,1869,0,0}, {'e',1,1871,0,0}, {'f',1,1872,0,0}, {'i',1,1873,0,0}, {'o',1,1874,0,0}, {'s',1,1875,0,0},
+    {'u',2,1876,0,0}, {'a',1,1878,0,0}, {'c',2,1879,0,0}, {'d',1,1881,0,0}, {'e',2,1882,0,0}, {'f',1,1884,0,0},
+    {'h',1,1885,0,0}, {'i',1,1886,0,0}, {'o',1,1887,0,0}, {'s',1,1888,0,0}, {'w',2,1889,0,0}, {'l',1,1891,0,0},
+    {'P',1,1892,2,1}, {'c',1,1893,0,0}, {'r',1,1894,0,0}, {'i',1,1895,0,0}, {'y',1,1896,0,0}, {'r',1,1897,0,0},
+    {'r',1,1898,0,0}, {'p',1,1899,0,0}, {'a',1,1900,0,0}, {'d',1,1901,0,0}, {'g',1,1902,0,0}, {'p',1,1903,0,0},
+    {'p',1,1904,0,0}, {'i',1,1905,0,0}, {'c',1,1906,0,0}, {'s',1,1907,0,0}, {'i',1,1908,0,0}, {'m',1,1909,0,0},
+    {'c',1,1910,0,0}, {'r',2,1911,0,0}, {'y',1,1913,0,0}, {'c',1,1914,0,0}, {'r',1,1915,0,0}, {'t',1,1916,0,0},
+    {'r',1,1917,0,0}, {'p',1,1918,0,0}, {'e',1,1919,0,0}, {'c',1,1920,0,0}, {'m',1,1921,0,0}, {'c',1,1922,0,0},
+    {'P',1,1923,0,0}, {'c',1,1924,0,0}, {'p',2,1925,0,0}, {'y',1,1927,0,0}, {'a',1,1928,0,0}, {'e',1,1929,0,0},
+    {'i',1,1930,0,0}, {'o',1,1931,0,0}, {'o',1,1932,0,0}, {'d',1,1933,0,0}, {'n',1,1934,0,0}, {'r',1,1935,0,0},
+    {'i',1,1936,0,0}, {'r',1,1937,0,0}, {'o',2,1938,0,0}, {'l',1,1940,0,0}, {'n',3,1941,0,0}, {'p',2,1944,0,0},
+    {'u',1,1946,0,0}, {'o',1,1947,0,0}, {'c',1,1948,0,0}, {'p',2,1949,0,0}, {';',0,0,3,3}, {'o',1,1951,0,0},
+    {'c',1,1952,0,0}, {'c',1,1953,0,0}, {'c',1,1954,0,0}, {'g',1,1955,0,0}, {'r',1,1956,0,0}, {'s',1,1957,0,0},
+    {'a',1,1958,0,0}, {'y',1,1959,0,0}, {'l',2,1960,0,0}, {'r',1,1962,0,0}, {'a',2,1963,0,0}, {'f',1,1965,0,0},
+    {'p',1,1966,0,0}, {'t',3,1967,0,0}, {'u',1,1970,0,0}, {'w',1,1971,0,0}, {'c',1,1972,0,0}, {'t',1,1973,0,0},
+    {'G',1,1974,0,0}, {'H',1,1975,6,2}, {'c',1,1976,0,0}, {'a',1,1977,0,0}, {'i',1,1978,0,0}, {'y',1,1979,0,0},
+    {'o',1,1980,0,0}, {'r',1,1981,0,0}, {'r',1,1982,0,0}, {'e',1,1983,0,0}, {'a',1,1984,0,0}, {'p',1,1985,0,0},
+    {'g',1,1986,0,0}, {'p',1,1987,0,0}, {'s',1,1988,0,0}, {'u',2,1989,0,0}, {'c',1,1991,0,0}, {'i',1,1992,0,0},
+    {'a',1,1993,0,0}, {'m',1,1994,0,0}, {'i',1,1995,0,0}, {'p',1,1996,0,0}, {'y',1,1997,0,0}, {'r',1,1998,0,0},
+    {'l',1,1999,0,0}, {'p',1,2000,0,0}, {'r',1,2001,0,0}, {'u',1,2002,0,0}, {'c',1,2003,0,0}, {'c',1,2004,0,0},
+    {';',0,0,0,1}, {'m',1,2005,0,0}, {'r',1,2006,0,0}, {'e',1,2007,0,0}, {'i',1,2008,0,0}, {'y',1,2009,0,0},
+    {'o',1,2010,0,0}, {'r',1,2011,0,0}, {';',0,0,8,3}, {'p',1,2012,0,0}, {'e',1,2013,0,0}, {'c',1,2014,0,0},
+    {';',0,0,11,3}, {'R',1,2015,0,0}, {'c',1,2016,0,0}, {'t',1,2017,0,0}, {'i',1,2018,0,0}, {'r',1,2019,0,0},
+    {'l',1,2020,0,0}, {'p',1,2021,0,0}, {'r',1,2022,0,0}, {'c',1,2023,0,0}, {'t',1,2024,0,0}, {'m',1,2025,0,0},
+    {'c',1,2026,0,0}, {'l',1,2027,0,0}, {'c',1,2028,0,0}, {'c',1,2029,0,0}, {'i',1,2030,0,0}, {'y',1,2031,0,0},
+    {'o',1,2032,0,0}, {'r',1,2033,0,0}, {'r',1,2034,0,0}, {';',0,0,14,3}, {'a',2,2035,0,0}, {'p',1,2037,0,0},
+    {'t',2,2038,0,0}, {'v',1,2040,0,0}, {'g',1,2041,0,0}, {'p',1,2042,0,0}, {'t',1,2043,0,0}, {'c',1,2044,0,0},
+    {'i',1,2045,0,0}, {'k',1,2046,0,0}, {'m',1,2047,0,0}, {'i',1,2048,0,0}, {'y',1,2049,0,0}, {'r',1,2050,0,0},
+    {'p',1,2051,0,0}, {'c',1,2052,0,0}, {'e',1,2053,0,0}, {'k',1,2054,0,0}, {'c',1,2055,0,0}, {'c',1,2056,0,0},
+    {'p',1,2057,0,0}, {'e',1,2058,0,0}, {'y',1,2059,0,0}, {'r',1,2060,0,0}, {'p',1,2061,0,0}, {'c',1,2062,0,0},
+    {'c',1,2063,0,0}, {';',0,0,1,1}, {'c',1,2064,0,0}, {'m',1,2065,0,0}, {'n',1,2066,0,0}, {'p',1,2067,0,0},
+    {'r',1,2068,0,0}, {'a',1,2069,0,0}, {'e',1,2070,0,0}, {'y',1,2071,0,0}, {'f',1,2072,0,0}, {'s',1,2073,0,0},
+    {'r',1,2074,0,0}, {';',0,0,17,3}, {'e',1,2075,0,0}, {'i',1,2076,0,0}, {'n',1,2077,0,0}, {'p',1,2078,0,0},
+    {'w',1,2079,0,0}, {'c',1,2080,0,0}, {'h',1,2081,0,0}, {'t',1,2082,0,0}, {';',0,0,20,3}, {'p',1,2083,0,0},
+    {'y',1,2084,0,0}, {'d',1,2085,0,0}, {'l',1,2086,0,0}, {'r',1,2087,0,0}, {'n',1,2088,0,0}, {'p',1,2089,0,0},
+    {'c',1,2090,0,0}, {';',0,0,23,2}, {'c',1,2091,0,0}, {'c',1,2092,0,0}, {'a',1,2093,0,0}, {'e',1,2094,0,0},
+    {'y',1,2095,0,0}, {'g',1,2096,0,0}, {'s',1,2097,0,0}, {'w',1,2098,0,0}, {'r',1,2099,0,0}, {'B',1,2100,0,0},
+    {'n',1,2101,0,0}, {'p',1,2102,0,0}, {'t',13,2103,0,0}, {'c',1,2116,0,0}, {'i',1,2117,0,0}, {';',0,0,25,2},
+    {'l',1,2118,0,0}, {'c',1,2119,0,0}, {'i',1,2120,0,0}, {'y',1,2121,0,0}, {'b',1,2122,0,0}, {'r',1,2123,0,0},
+    {'r',1,2124,0,0}, {'a',1,2125,0,0}, {'e',1,2126,0,0}, {'i',1,2127,0,0}, {'p',1,2128,0,0}, {'e',1,2129,0,0},
+    {';',0,0,27,3}, {'c',1,2130,0,0}, {'l',1,2131,0,0}, {'i',2,2132,0,0}, {'m',1,2134,0,0}, {'e',1,2135,0,0},
+    {'r',1,2136,0,0}, {'y',1,2137,0,0}, {'r',1,2138,0,0}, {'i',1,2139,0,0}, {';',0,0,30,2}, {'u',1,2140,0,0},
+    {'i',1,2141,0,0}, {'p',1,2142,0,0}, {';',0,0,32,3}, {'e',1,2143,0,0}, {'i',1,2144,0,0}, {'o',2,2145,0,0},
+    {'c',1,2147,0,0}, {'i',1,2148,0,0}, {'O',1,2149,0,0}, {'r',1,2150,0,0}, {'p',1,2151,0,0}, {'c',1,2152,0,0},
+    {'a',1,2153,0,0}, {'G',1,2154,35,2}, {'c',1,2155,0,0}, {'n',1,2156,0,0}, {'r',1,2157,0,0}, {'a',1,2158,0,0},
+    {'e',1,2159,0,0}, {'y',1,2160,0,0}, {';',0,0,37,3}, {'v',1,2161,0,0}, {'r',1,2162,0,0}, {'o',1,2163,0,0},
+    {'g',1,2164,0,0}, {'p',1,2165,0,0}, {'u',1,2166,0,0}, {'i',1,2167,0,0}, {'c',1,2168,0,0}, {'h',1,2169,0,0},
+    {'l',1,2170,0,0}, {'C',1,2171,0,0}, {'c',1,2172,0,0}, {'F',1,2173,0,0}, {'c',1,2174,0,0}, {';',0,0,40,3},
+    {'a',1,2175,0,0}, {'e',1,2176,0,0}, {'i',1,2177,0,0}, {'y',1,2178,0,0}, {'r',1,2179,0,0}, {'o',1,2180,0,0},
+    {'g',1,2181,0,0}, {'a',1,2182,0,0}, {'p',1,2183,0,0}, {'r',1,2184,0,0}, {'u',1,2185,0,0}, {'c',1,2186,0,0},
+    {'a',1,2187,0,0}, {'b',2,2188,0,0}, {'c',2,2190,0,0}, {'m',1,2192,0,0}, {'p',3,2193,0,0}, {'O',1,2196,0,0},
+    {'A',1,2197,0,0}, {'H',1,2198,0,0}, {'c',1,2199,0,0}, {'b',1,2200,0,0}, {'u',1,2201,0,0}, {'a',1,2202,0,0},
+    {'e',1,2203,0,0}, {'y',1,2204,0,0}, {'r',1,2205,0,0}, {'e',2,2206,0,0}, {'i',2,2208,0,0}, {'l',1,2210,0,0},
+    {'p',1,2211,0,0}, {'i',1,2212,0,0}, {'c',1,2213,0,0}, {'t',1,2214,0,0}, {'c',1,2215,0,0}, {'r',1,2216,0,0},
+    {'r',2,2217,0,0}, {'i',1,2219,0,0}, {'y',1,2220,0,0}, {'b',1,2221,0,0}, {'r',1,2222,0,0}, {'r',1,2223,0,0},
+    {'a',1,2224,0,0}, {'d',1,2225,0,0}, {'i',1,2226,0,0}, {'g',1,2227,0,0}, {'p',1,2228,0,0}, {'A',1,2229,0,0},
+    {'D',1,2230,0,0}, {'E',1,2231,0,0}, {'T',1,2232,0,0}, {'a',1,2233,0,0}, {'d',1,2234,0,0}, {'p',1,2235,0,0},
+    {'s',1,2236,0,0}, {'i',1,2237,0,0}, {'c',1,2238,0,0}, {'i',1,2239,0,0}, {'m',1,2240,0,0}, {'a',1,2241,0,0},
+    {'a',1,2242,0,0}, {'y',1,2243,0,0}, {'a',1,2244,0,0}, {'e',1,2245,0,0}, {'r',3,2246,0,0}, {'r',1,2249,0,0},
+    {'p',1,2250,0,0}, {'c',1,2251,0,0}, {'d',1,2252,0,0}, {'i',1,2253,0,0}, {'d',1,2254,0,0}, {'r',1,2255,0,0},
+    {'p',1,2256,0,0}, {'c',1,2257,0,0}, {'r',1,2258,0,0}, {';',0,0,43,2}, {'p',1,2259,0,0}, {'c',1,2260,0,0},
+    {'c',1,2261,0,0}, {'c',1,2262,0,0}, {'c',1,2263,0,0}, {'c',1,2264,0,0}, {'i',1,2265,0,0}, {'y',1,2266,0,0},
+    {'r',1,2267,0,0}, {'p',1,2268,0,0}, {'c',1,2269,0,0}, {'m',1,2270,0,0}, {'c',1,2271,0,0}, {'c',1,2272,0,0},
+    {'a',1,2273,0,0}, {'y',1,2274,0,0}, {'o',1,2275,0,0}, {'r',1,2276,0,0}, {'t',1,2277,0,0}, {'r',1,2278,0,0},
+    {'p',1,2279,0,0}, {'c',1,2280,0,0}, {'c',1,2281,0,0}, {'r',1,2282,0,0}, {';',0,0,45,3}, {'E',1,2283,0,0},
+    {'d',1,2284,0,0}, {'i',1,2285,0,0}, {'u',1,2286,0,0}, {'y',1,2287,0,0}, {'l',1,2288,0,0}, {';',0,0,48,3},
+    {'r',1,2289,0,0}, {'r',1,2290,0,0}, {'e',2,2291,0,0}, {'p',1,2293,0,0}, {'a',2,2294,0,0}, {'p',1,2296,2,1},
+    {'d',5,2297,0,0}, {'g',7,2302,0,0}, {'g',1,2309,0,0}, {'p',1,2310,0,0}, {';',0,0,51,3}, {'E',1,2311,0,0},
+    {'a',1,2312,0,0}, {'e',1,2313,0,0}, {'i',1,2314,0,0}, {'o',1,2315,0,0}, {'p',1,2316,0,0}, {'i',1,2317,0,0},
+    {'c',1,2318,0,0}, {'t',1,2319,0,0}, {'y',1,2320,0,0}, {'i',1,2321,0,0}, {'m',1,2322,0,0}, {'c',1,2323,0,0},
+    {'i',1,2324,0,0}, {'o',1,2325,0,0}, {'c',1,2326,0,0}, {'r',2,2327,0,0}, {'r',1,2329,0,0}, {'o',1,2330,0,0},
+    {'y',1,2331,0,0}, {'q',1,2332,0,0}, {'c',1,2333,0,0}, {'m',1,2334,0,0}, {'p',1,2335,0,0}, {'r',1,2336,0,0},
+    {'t',3,2337,0,0}, {'r',1,2340,0,0}, {'g',7,2341,0,0}, {'a',1,2348,0,0}, {'a',2,2349,0,0}, {'k',2,2351,0,0},
+    {'o',1,2353,0,0}, {'e',2,2354,0,0}, {'o',1,2356,0,0}, {'p',1,2357,0,0}, {'t',2,2358,0,0}, {'w',1,2360,0,0},
+    {'x',12,2361,0,0}, {'r',1,2373,0,0}, {'e',1,2374,0,0}, {'v',1,2375,0,0}, {'c',1,2376,0,0}, {'e',1,2377,0,0},
+    {'i',1,2378,0,0}, {'o',1,2379,0,0}, {'l',1,2380,0,0}, {'m',1,2381,0,0}, {'c',1,2382,0,0}, {'p',6,2383,0,0},
+    {'r',2,2389,0,0}, {'a',2,2391,0,0}, {'e',1,2393,0,0}, {'i',1,2394,0,0}, {'u',1,2395,0,0}, {'o',1,2396,0,0},
+    {'d',1,2397,0,0}, {'m',1,2398,0,0}, {'n',1,2399,0,0}, {'r',1,2400,0,0}, {'c',1,2401,0,0}, {'e',1,2402,0,0},
+    {'i',1,2403,0,0}, {'r',7,2404,0,0}, {'u',1,2411,0,0}, {'l',1,2412,0,0}, {'m',2,2413,0,0}, {'n',2,2415,0,0},
+    {'p',3,2417,0,0}, {'a',1,2420,0,0}, {'o',1,2421,0,0}, {'c',1,2422,0,0}, {'u',2,2423,0,0}, {'d',1,2425,0,0},
+    {'d',1,2426,0,0}, {'e',2,2427,0,0}, {'l',1,2429,0,0}, {'p',6,2430,0,0}, {'r',4,2436,0,0}, {'v',1,2440,0,0},
+    {'w',1,2441,0,0}, {'c',1,2442,0,0}, {'i',1,2443,0,0}, {'l',1,2444,0,0}, {'r',1,2445,0,0}, {'a',1,2446,0,0},
+    {'g',1,2447,0,0}, {'l',1,2448,0,0}, {'r',1,2449,0,0}, {'s',1,2450,0,0}, {'k',1,2451,0,0}, {'l',1,2452,0,0},
+    {'a',1,2453,0,0}, {'y',1,2454,0,0}, {';',0,0,54,3}, {'a',2,2455,0,0}, {'o',1,2457,0,0}, {'g',1,2458,57,2},
+    {'l',1,2459,0,0}, {'m',1,2460,0,0}, {'i',1,2461,0,0}, {'r',1,2462,0,0}, {'a',1,2463,0,0}, {'a',1,2464,0,0},
+    {'e',1,2465,0,0}, {'g',1,2466,0,0}, {'s',1,2467,0,0}, {'v',3,2468,0,0}, {'c',1,2471,0,0}, {'c',2,2472,0,0},
+    {'l',1,2474,0,0}, {'p',1,2475,0,0}, {'t',5,2476,0,0}, {'u',1,2481,0,0}, {'w',1,2482,0,0}, {'b',1,2483,0,0},
+    {'c',2,2484,0,0}, {'c',2,2486,0,0}, {'o',1,2488,0,0}, {'t',1,2489,0,0}, {'d',1,2490,0,0}, {'r',1,2491,0,0},
+    {'a',1,2492,0,0}, {'h',1,2493,0,0}, {'a',1,2494,0,0}, {'c',1,2495,0,0}, {'i',1,2496,0,0}, {'D',1,2497,0,0},
+    {'o',1,2498,0,0}, {'c',1,2499,0,0}, {'s',1,2500,0,0}, {'a',1,2501,0,0}, {'i',1,2502,0,0}, {'o',1,2503,0,0},
+    {'y',1,2504,0,0}, {'o',1,2505,0,0}, {';',0,0,59,3}, {'D',1,2506,0,0}, {'r',1,2507,0,0}, {';',0,0,62,3},
+    {'r',1,2508,0,0}, {'s',2,2509,0,0}, {';',0,0,65,3}, {'i',1,2511,0,0}, {'l',1,2512,0,0}, {'s',2,2513,0,0},
+    {'a',1,2515,0,0}, {'p',1,2516,0,0}, {'s',1,2517,0,0}, {'g',1,2518,0,0}, {'s',1,2519,0,0}, {'g',1,2520,0,0},
+    {'p',1,2521,0,0}, {'a',1,2522,0,0}, {'l',1,2523,0,0}, {'s',1,2524,0,0}, {'c',2,2525,0,0}, {'s',2,2527,0,0},
+    {'u',3,2529,0,0}, {'v',1,2532,0,0}, {'D',1,2533,0,0}, {'a',1,2534,0,0}, {'c',1,2535,0,0}, {'d',1,2536,0,0},
+    {'i',1,2537,0,0}, {'a',1,2538,0,0}, {'h',1,2539,68,2}, {'m',1,2540,0,0}, {'r',1,2541,0,0}, {'c',1,2542,0,0},
+    {'i',1,2543,0,0}, {'p',2,2544,0,0}, {'l',1,2546,0,0}, {'y',1,2547,0,0}, {'m',1,2548,0,0}, {'i',1,2549,0,0},
+    {'l',2,2550,0,0}, {'r',1,2552,0,0}, {'l',1,2553,0,0}, {'l',1,2554,0,0}, {'a',1,2555,0,0}, {'l',1,2556,0,0},
+    {'t',1,2557,0,0}, {'o',1,2558,0,0}, {'p',1,2559,0,0}, {'r',2,2560,0,0}, {'a',1,2562,0,0}, {'a',2,2563,0,0},
+    {'o',1,2565,0,0}, {'c',1,2566,0,0}, {';',0,0,70,3}, {'l',1,2567,0,0}, {'c',1,2568,0,0}, {'m',1,2569,0,0},
+    {'p',1,2570,0,0}, {'r',1,2571,0,0}, {'i',1,2572,0,0}, {'y',1,2573,0,0}, {'o',1,2574,0,0}, {';',0,0,73,3},
+    {'l',1,2575,0,0}, {'q',3,2576,0,0}, {'s',4,2579,0,0}, {'r',1,2583,0,0}, {';',0,0,11,3}, {'g',1,2584,0,0},
+    {'m',1,2585,0,0}, {'c',1,2586,0,0}, {';',0,0,76,3}, {'E',1,2587,0,0}, {'a',1,2588,0,0}, {'j',1,2589,0,0},
+    {'E',1,2590,0,0}, {'a',1,2591,0,0}, {'e',2,2592,0,0}, {'s',1,2594,0,0}, {'p',1,2595,0,0}, {'a',1,2596,0,0},
+    {'c',1,2597,0,0}, {'i',1,2598,0,0}, {';',0,0,0,1}, {'c',2,2599,0,0}, {'d',1,2601,0,0}, {'l',1,2602,0,0},
+    {'q',1,2603,0,0}, {'r',5,2604,0,0}, {'e',1,2609,0,0}, {'n',1,2610,0,0}, {'r',1,2611,0,0}, {'i',1,2612,0,0},
+    {'l',1,2613,0,0}, {'m',1,2614,0,0}, {'r',2,2615,0,0}, {'a',1,2617,0,0}, {'i',1,2618,0,0}, {'a',1,2619,0,0},
+    {'l',1,2620,0,0}, {'r',1,2621,0,0}, {'r',1,2622,0,0}, {'s',2,2623,0,0}, {'a',1,2625,0,0}, {'m',1,2626,0,0},
+    {'o',1,2627,0,0}, {'p',1,2628,0,0}, {'r',1,2629,0,0}, {'c',1,2630,0,0}, {'l',1,2631,0,0}, {'t',1,2632,0,0},
+    {'b',1,2633,0,0}, {'p',1,2634,0,0}, {'c',1,2635,0,0}, {';',0,0,79,3}, {'i',1,2636,0,0}, {'y',1,2637,0,0},
+    {'c',1,2638,0,0}, {'x',1,2639,0,0}, {'f',1,2640,0,0}, {'r',1,2641,0,0}, {'r',1,2642,0,0}, {';',0,0,82,3},
+    {'i',2,2643,0,0}, {'n',1,2645,0,0}, {'o',1,2646,0,0}, {'l',1,2647,0,0}, {'a',3,2648,0,0}, {'o',1,2651,0,0},
+    {'p',1,2652,0,0}, {';',0,0,85,3}, {'c',1,2653,0,0}, {'f',1,2654,0,0}, {'o',1,2655,0,0}, {'t',5,2656,0,0},
+    {'c',1,2661,0,0}, {'g',1,2662,0,0}, {'p',1,2663,0,0}, {'t',1,2664,0,0}, {'r',1,2665,0,0}, {'u',1,2666,0,0},
+    {'c',1,2667,0,0}, {'i',1,2668,0,0}, {';',0,0,88,3}, {'i',1,2669,0,0}, {'k',1,2670,0,0}, {'m',1,2671,0,0},
+    {'i',1,2672,0,0}, {'y',1,2673,0,0}, {'r',1,2674,0,0}, {'a',1,2675,0,0}, {'p',1,2676,0,0}, {'c',1,2677,0,0},
+    {'e',1,2678,0,0}, {'k',1,2679,0,0}, {'p',1,2680,0,0}, {'e',1,2681,0,0}, {'y',1,2682,0,0}, {'r',1,2683,0,0},
+    {'r',1,2684,0,0}, {'c',1,2685,0,0}, {'c',1,2686,0,0}, {'p',1,2687,0,0}, {'c',1,2688,0,0}, {'a',1,2689,0,0},
+    {'r',1,2690,0,0}, {'t',1,2691,0,0}, {'a',1,2692,0,0}, {';',0,0,91,3}, {'g',1,2693,0,0}, {'a',1,2694,0,0},
+    {'c',1,2695,0,0}, {'e',1,2696,0,0}, {'g',1,2697,0,0}, {'m',1,2698,0,0}, {'n',1,2699,0,0}, {'p',1,2700,0,0},
+    {'q',1,2701,0,0}, {'r',1,2702,0,0}, {'t',3,2703,0,0}, {'a',1,2706,0,0}, {'b',1,2707,0,0}, {'r',2,2708,0,0},
+    {'a',1,2710,0,0}, {'e',2,2711,0,0}, {'u',1,2713,0,0}, {'y',1,2714,0,0}, {'c',1,2715,0,0}, {'q',1,2716,0,0},
+    {'r',2,2717,0,0}, {'s',1,2719,0,0}, {';',0,0,94,3}, {'f',1,2720,0,0}, {'g',1,2721,0,0}, {'q',3,2722,0,0},
+    {'s',5,2725,0,0}, {'i',1,2730,0,0}, {'l',1,2731,0,0}, {'r',1,2732,0,0}, {';',0,0,97,3}, {'E',1,2733,0,0},
+    {'a',1,2734,0,0}, {'b',1,2735,0,0}, {'c',1,2736,0,0}, {';',0,0,20,3}, {'a',1,2737,0,0}, {'c',1,2738,0,0},
+    {'h',1,2739,0,0}, {'t',1,2740,0,0}, {'i',1,2741,0,0}, {'o',1,2742,0,0}, {'E',1,2743,0,0}, {'a',1,2744,0,0},
+    {'e',2,2745,0,0}, {'s',1,2747,0,0}, {'a',2,2748,0,0}, {'b',1,2750,0,0}, {'n',1,2751,0,0}, {'o',1,2752,0,0},
+    {'p',3,2753,0,0}, {'t',1,2756,0,0}, {'w',2,2757,0,0}, {'z',3,2759,0,0}, {'a',1,2762,0,0}, {'a',1,2763,0,0},
+    {'c',1,2764,0,0}, {'h',1,2765,0,0}, {'m',1,2766,0,0}, {'t',1,2767,0,0}, {'a',1,2768,0,0}, {'c',1,2769,0,0},
+    {'h',1,2770,0,0}, {'i',1,2771,0,0}, {'q',2,2772,0,0}, {'t',1,2774,0,0}, {';',0,0,1,1}, {'c',2,2775,0,0},
+    {'d',1,2777,0,0}, {'h',1,2778,0,0}, {'i',1,2779,0,0}, {'l',1,2780,0,0}, {'q',1,2781,0,0}, {'r',2,2782,0,0},
+    {'r',2,2784,0,0}, {'e',1,2786,0,0}, {'n',1,2787,0,0}, {'D',1,2788,0,0}, {'c',1,2789,0,0}, {'l',2,2790,0,0},
+    {'p',2,2792,0,0}, {'r',1,2794,0,0}, {'o',1,2795,0,0}, {'y',1,2796,0,0}, {'a',1,2797,0,0}, {'a',1,2798,0,0},
+    {'r',1,2799,0,0}, {'o',1,2800,0,0}, {'c',1,2801,0,0}, {'d',4,2802,0,0}, {'n',1,2806,0,0}, {'c',1,2807,0,0},
+    {'d',1,2808,0,0}, {'p',1,2809,0,0}, {'d',1,2810,0,0}, {'p',1,2811,0,0}, {';',0,0,100,3}, {'c',1,2812,0,0},
+    {'t',1,2813,0,0}, {';',0,0,103,2}, {'l',1,2814,0,0}, {'m',1,2815,0,0}, {'g',1,2816,0,0}, {'t',2,2817,0,0},
+    {'e',1,2819,0,0}, {'l',1,2820,0,0}, {'t',2,2821,0,0}, {'i',1,2823,0,0}, {'D',1,2824,0,0}, {'d',1,2825,0,0},
+    {'b',1,2826,0,0}, {'c',1,2827,0,0}, {'n',1,2828,0,0}, {'p',5,2829,0,0}, {'t',1,2834,0,0}, {'s',1,2835,0,0},
+    {'u',1,2836,0,0}, {'a',2,2837,0,0}, {'e',1,2839,0,0}, {'o',1,2840,0,0}, {'u',1,2841,0,0}, {'y',1,2842,0,0},
+    {'a',1,2843,0,0}, {';',0,0,105,3}, {'A',1,2844,0,0}, {'a',1,2845,0,0}, {'d',1,2846,0,0}, {'q',1,2847,0,0},
+    {'s',2,2848,0,0}, {'x',1,2850,0,0}, {'r',1,2851,0,0}, {'E',1,2852,0,0}, {'e',3,2853,0,0}, {'s',1,2856,0,0},
+    {'t',2,2857,0,0}, {'A',1,2859,0,0}, {'a',1,2860,0,0}, {'p',1,2861,0,0}, {';',0,0,108,3}, {'s',2,2862,0,0},
+    {'v',1,2864,0,0}, {'c',1,2865,0,0}, {'A',1,2866,0,0}, {'E',1,2867,0,0}, {'a',1,2868,0,0}, {'d',1,2869,0,0},
+    {'e',4,2870,0,0}, {'s',1,2874,0,0}, {'t',2,2875,0,0}, {'i',1,2877,0,0}, {'p',1,2878,0,0}, {'t',3,2879,111,2},
+    {'a',1,2882,0,0}, {'o',1,2883,0,0}, {'r',3,2884,0,0}, {'A',1,2887,0,0}, {'a',1,2888,0,0}, {'i',1,2889,0,0},
+    {'t',1,2890,0,0}, {'c',4,2891,0,0}, {'h',1,2895,0,0}, {'i',1,2896,0,0}, {'m',1,2897,0,0}, {'p',1,2898,0,0},
+    {'q',1,2899,0,0}, {'u',3,2900,0,0}, {'g',1,2903,0,0}, {'i',1,2904,0,0}, {'l',1,2905,0,0}, {'r',1,2906,0,0},
+    {';',0,0,113,2}, {'m',3,2907,0,0}, {'D',1,2910,0,0}, {'H',1,2911,0,0}, {'a',1,2912,0,0}, {'d',1,2913,0,0},
+    {'g',2,2914,0,0}, {'i',1,2916,0,0}, {'l',3,2917,0,0}, {'r',2,2920,0,0}, {'s',1,2922,0,0}, {'A',1,2923,0,0},
+    {'a',1,2924,0,0}, {'n',1,2925,0,0}, {';',0,0,115,3}, {'c',1,2926,0,0}, {'s',1,2927,0,0}, {'i',1,2928,0,0},
+    {'y',1,2929,0,0}, {'a',1,2930,0,0}, {'b',1,2931,0,0}, {'i',1,2932,0,0}, {'o',1,2933,0,0}, {'s',1,2934,0,0},
+    {'l',1,2935,0,0}, {'c',1,2936,0,0}, {'r',1,2937,0,0}, {'o',1,2938,0,0}, {'r',1,2939,0,0}, {'t',1,2940,0,0},
+    {'b',1,2941,0,0}, {'m',1,2942,0,0}, {'n',1,2943,0,0}, {'a',1,2944,0,0}, {'c',2,2945,0,0}, {'i',1,2947,0,0},
+    {'t',1,2948,0,0}, {'a',1,2949,0,0}, {'e',1,2950,0,0}, {'i',3,2951,0,0}, {'p',1,2954,0,0}, {'a',1,2955,0,0},
+    {'e',1,2956,0,0}, {'l',1,2957,0,0}, {';',0,0,118,3}, {'a',1,2958,0,0}, {'d',4,2959,0,0}, {'i',1,2963,0,0},
+    {'o',1,2964,0,0}, {'s',1,2965,0,0}, {'v',1,2966,0,0}, {'c',1,2967,0,0}, {'l',1,2968,0,0}, {'o',1,2969,0,0},
+    {'i',2,2970,0,0}, {'m',1,2972,0,0}, {'b',1,2973,0,0}, {'r',4,2974,0,0}, {'y',1,2978,0,0}, {'r',5,2979,0,0},
+    {'r',1,2984,0,0}, {'i',2,2985,0,0}, {'m',1,2987,0,0}, {'o',1,2988,0,0}, {';',0,0,121,2}, {'t',1,2989,0,0},
+    {'v',1,2990,0,0}, {'a',1,2991,0,0}, {'u',1,2992,0,0}, {';',0,0,123,2}, {'i',1,2993,0,0}, {'p',1,2994,0,0},
+    {'u',1,2995,0,0}, {';',0,0,125,3}, {'E',1,2996,0,0}, {'a',1,2997,0,0}, {'c',1,2998,0,0}, {'e',2,2999,0,0},
+    {'i',1,3001,0,0}, {'n',3,3002,0,0}, {'o',3,3005,0,0}, {'s',1,3008,0,0}, {'u',1,3009,0,0}, {'c',1,3010,0,0},
+    {'i',1,3011,0,0}, {'n',1,3012,0,0}, {'r',1,3013,0,0}, {'n',1,3014,0,0}, {'p',1,3015,0,0}, {'r',1,3016,0,0},
+    {'c',1,3017,0,0}, {'a',1,3018,0,0}, {'e',1,3019,0,0}, {'o',1,3020,0,0}, {'a',1,3021,0,0}, {'r',1,3022,0,0},
+    {'t',1,3023,0,0}, {'a',1,3024,0,0}, {'a',1,3025,0,0}, {'c',2,3026,0,0}, {'d',1,3028,0,0}, {'e',1,3029,0,0},
+    {'n',1,3030,0,0}, {'q',1,3031,0,0}, {'r',1,3032,0,0}, {'t',2,3033,0,0}, {'a',1,3035,0,0}, {'b',1,3036,0,0},
+    {'r',2,3037,0,0}, {'a',1,3039,0,0}, {'e',2,3040,0,0}, {'u',1,3042,0,0}, {'y',1,3043,0,0}, {'c',1,3044,0,0},
+    {'l',1,3045,0,0}, {'q',1,3046,0,0}, {'s',1,3047,0,0}, {'a',1,3048,0,0}, {'c',1,3049,0,0}, {'g',1,3050,35,2},
+    {'i',1,3051,0,0}, {'l',1,3052,0,0}, {'r',1,3053,0,0}, {'a',1,3054,0,0}, {'o',2,3055,0,0}, {'g',1,3057,0,0},
+    {'n',1,3058,0,0}, {'s',1,3059,0,0}, {'a',1,3060,0,0}, {'h',1,3061,0,0}, {'m',1,3062,0,0}, {'o',1,3063,0,0},
+    {'m',1,3064,0,0}, {'a',2,3065,0,0}, {'b',1,3067,0,0}, {'p',3,3068,0,0}, {'t',1,3071,0,0}, {'a',1,3072,0,0},
+    {'p',1,3073,0,0}, {'a',1,3074,0,0}, {'a',1,3075,0,0}, {'c',1,3076,0,0}, {'h',1,3077,0,0}, {'q',2,3078,0,0},
+    {'h',1,3080,0,0}, {'i',1,3081,0,0}, {'r',1,3082,0,0}, {'l',1,3083,0,0}, {';',0,0,128,3}, {'c',1,3084,0,0},
+    {'q',1,3085,0,0}, {';',0,0,131,3}, {'E',1,3086,0,0}, {'a',2,3087,0,0}, {'c',1,3089,0,0}, {'e',2,3090,0,0},
+    {'i',1,3092,0,0}, {'n',3,3093,0,0}, {'p',1,3096,0,0}, {'s',1,3097,0,0}, {'y',1,3098,0,0}, {'o',1,3099,0,0},
+    {'A',1,3100,0,0}, {'a',1,3101,0,0}, {'c',1,3102,0,0}, {'m',1,3103,0,0}, {'s',1,3104,0,0}, {'t',1,3105,0,0},
+    {'x',1,3106,0,0}, {'r',2,3107,0,0}, {'a',1,3109,0,0}, {'c',2,3110,0,0}, {'o',1,3112,0,0}, {'y',1,3113,134,2},
+    {'g',1,3114,0,0}, {'m',8,3115,0,0}, {'a',1,3123,0,0}, {'a',2,3124,0,0}, {'e',1,3126,0,0}, {'i',2,3127,0,0},
+    {'t',2,3129,0,0}, {'f',1,3131,0,0}, {'l',2,3132,0,0}, {'p',1,3134,0,0}, {'a',2,3135,0,0}, {'c',2,3137,0,0},
+    {'s',1,3139,0,0}, {'u',3,3140,0,0}, {'a',1,3143,0,0}, {'c',1,3144,0,0}, {'e',1,3145,0,0}, {'m',1,3146,0,0},
+    {'t',1,3147,0,0}, {'a',1,3148,0,0}, {'r',2,3149,0,0}, {'b',9,3151,0,0}, {'c',1,3160,0,0}, {'m',1,3161,0,0},
+    {'n',1,3162,0,0}, {'p',13,3163,0,0}, {'A',1,3176,0,0}, {'a',1,3177,0,0}, {'n',1,3178,0,0}, {'l',1,3179,0,0},
+    {'r',1,3180,0,0}, {'u',1,3181,0,0}, {'r',1,3182,0,0}, {'a',1,3183,0,0}, {'e',1,3184,0,0}, {'y',1,3185,0,0},
+    {'o',1,3186,0,0}, {'l',1,3187,0,0}, {'r',1,3188,0,0}, {'e',2,3189,0,0}, {'i',2,3191,0,0}, {'k',2,3193,0,0},
+    {'o',1,3195,0,0}, {'l',1,3196,0,0}, {'m',1,3197,0,0}, {'n',1,3198,0,0}, {'e',1,3199,0,0}, {'p',4,3200,0,0},
+    {'s',1,3204,0,0}, {'r',1,3205,0,0}, {'a',1,3206,0,0}, {'i',7,3207,0,0}, {'p',1,3214,0,0}, {'c',2,3215,0,0},
+    {'h',1,3217,0,0}, {'t',1,3218,0,0}, {'i',1,3219,0,0}, {'o',1,3220,0,0}, {'r',1,3221,0,0}, {'a',1,3222,0,0},
+    {'c',1,3223,0,0}, {'r',1,3224,0,0}, {'r',2,3225,0,0}, {'i',1,3227,0,0}, {'y',1,3228,0,0}, {'a',1,3229,0,0},
+    {'b',1,3230,0,0}, {'h',1,3231,0,0}, {'i',1,3232,0,0}, {'r',1,3233,0,0}, {'r',1,3234,0,0}, {'a',1,3235,0,0},
+    {'b',1,3236,0,0}, {'c',2,3237,0,0}, {'t',1,3239,0,0}, {'a',1,3240,0,0}, {'l',1,3241,136,2}, {'g',1,3242,0,0},
+    {'p',1,3243,0,0}, {'a',1,3244,0,0}, {'d',1,3245,0,0}, {'h',1,3246,0,0}, {'l',1,3247,0,0}, {'s',1,3248,0,0},
+    {'u',1,3249,0,0}, {'c',2,3250,0,0}, {'i',1,3252,0,0}, {'t',1,3253,0,0}, {'c',1,3254,0,0}, {'d',1,3255,0,0},
+    {'i',1,3256,0,0}, {'r',1,3257,0,0}, {'a',1,3258,0,0}, {'m',1,3259,0,0}, {'a',1,3260,0,0}, {'r',1,3261,0,0},
+    {'a',1,3262,0,0}, {'a',1,3263,0,0}, {'n',1,3264,0,0}, {'r',7,3265,0,0}, {'y',1,3272,0,0}, {'a',1,3273,0,0},
+    {'e',3,3274,0,0}, {'l',1,3277,0,0}, {'r',2,3278,0,0}, {'r',1,3280,0,0}, {'t',1,3281,0,0}, {'s',1,3282,0,0},
+    {'p',1,3283,0,0}, {'r',1,3284,0,0}, {'t',1,3285,0,0}, {'c',1,3286,0,0}, {'u',2,3287,0,0}, {'i',1,3289,0,0},
+    {'i',1,3290,0,0}, {'d',2,3291,0,0}, {'i',1,3293,0,0}, {'r',1,3294,0,0}, {'p',1,3295,0,0}, {';',0,0,138,3},
+    {';',0,0,141,3}, {'e',1,3296,0,0}, {'c',1,3297,0,0}, {'a',1,3298,0,0}, {'i',1,3299,0,0}, {'u',1,3300,0,0},
+    {'t',1,3301,0,0}, {'r',1,3302,0,0}, {'A',1,3303,0,0}, {'a',1,3304,0,0}, {';',0,0,144,2}, {'A',1,3305,0,0},
+    {'a',1,3306,0,0}, {'a',1,3307,0,0}, {'i',1,3308,0,0}, {'d',1,3309,0,0}, {'p',2,3310,0,0}, {'t',1,3312,0,0},
+    {'A',1,3313,0,0}, {'a',1,3314,0,0}, {'c',1,3315,0,0}, {'q',1,3316,0,0}, {'p',1,3317,0,0}, {'t',1,3318,0,0},
+    {'e',1,3319,0,0}, {'e',1,3320,0,0}, {'c',2,3321,0,0}, {'i',1,3323,0,0}, {'y',1,3324,0,0}, {'n',1,3325,146,2},
+    {'r',1,3326,0,0}, {'c',1,3327,0,0}, {'p',1,3328,0,0}, {'c',1,3329,0,0}, {'c',1,3330,0,0}, {'m',1,3331,0,0},
+    {'c',1,3332,0,0}, {'a',1,3333,0,0}, {'y',1,3334,0,0}, {'o',1,3335,0,0}, {'e',1,3336,0,0}, {'t',1,3337,0,0},
+    {'r',1,3338,0,0}, {'c',1,3339,0,0}, {'g',1,3340,0,0}, {'p',1,3341,0,0}, {'c',1,3342,0,0}, {'j',1,3343,0,0},
+    {'n',1,3344,0,0}, {'i',1,3345,0,0}, {';',0,0,2,1}, {'u',1,3346,0,0}, {'e',1,3347,0,0}, {'r',1,3348,0,0},
+    {';',0,0,148,2}, {';',0,0,150,4}, {'a',1,3349,0,0}, {'h',1,3350,0,0}, {'c',1,3351,0,0}, {';',0,0,154,3},
+    {'o',1,3352,0,0}, {'f',1,3353,0,0}, {'l',1,3354,0,0}, {'n',1,3355,0,0}, {'r',1,3356,0,0}, {'i',1,3357,0,0},
+    {'l',1,3358,0,0}, {'l',1,3359,157,2}, {'k',1,3360,0,0}, {'v',1,3361,0,0}, {'w',1,3362,0,0}, {';',0,0,159,2},
+    {'a',1,3363,0,0}, {'n',1,3364,0,0}, {'a',1,3365,0,0}, {';',0,0,161,4}, {'f',1,3366,0,0}, {'v',1,3367,0,0},
+    {'r',1,3368,0,0}, {'p',1,3369,0,0}, {'y',1,3370,0,0}, {'Y',1,3371,165,2}, {'u',1,3372,0,0}, {';',0,0,167,3},
+    {'i',1,3373,0,0}, {'l',1,3374,0,0}, {'r',1,3375,0,0}, {'d',1,3376,0,0}, {'r',1,3377,0,0}, {'n',1,3378,0,0},
+    {'t',1,3379,0,0}, {'i',1,3380,0,0}, {'t',1,3381,0,0}, {';',0,0,170,3}, {';',0,0,173,2}, {'c',1,3382,0,0},
+    {'c',1,3383,0,0}, {'s',1,3384,0,0}, {'o',1,3385,0,0}, {'g',1,3386,0,0}, {'i',1,3387,0,0}, {'t',1,3388,0,0},
+    {'f',1,3389,0,0}, {'r',1,3390,0,0}, {'n',1,3391,0,0}, {'s',1,3392,0,0}, {'r',1,3393,0,0}, {';',0,0,175,3},
+    {'C',1,3394,0,0}, {'t',1,3395,0,0}, {'y',1,3396,0,0}, {'y',1,3397,0,0}, {'y',1,3398,0,0}, {'g',1,3399,0,0},
+    {'r',1,3400,0,0}, {'h',1,3401,0,0}, {'r',1,3402,0,0}, {';',0,0,178,2}, {';',0,0,180,3}, {'t',1,3403,0,0},
+    {';',0,0,183,4}, {'c',1,3404,0,0}, {'m',1,3405,0,0}, {'f',1,3406,0,0}, {'f',1,3407,0,0}, {';',0,0,136,2},
+    {'D',1,3408,0,0}, {'E',1,3409,0,0}, {'b',1,3410,0,0}, {'n',6,3411,0,0}, {'r',1,3417,0,0}, {'r',1,3418,0,0},
+    {';',0,0,187,2}, {';',0,0,6,2}, {'u',1,3419,0,0}, {'r',1,3420,0,0}, {'r',1,3421,0,0}, {';',0,0,189,2},
+    {'t',1,3422,0,0}, {';',0,0,191,4}, {'a',1,3423,0,0}, {'m',1,3424,0,0}, {'c',1,3425,0,0}, {'t',1,3426,0,0},
+    {'o',1,3427,0,0}, {'f',1,3428,0,0}, {'i',1,3429,0,0}, {'a',1,3430,0,0}, {'i',1,3431,0,0}, {'r',1,3432,0,0},
+    {'m',1,3433,0,0}, {';',0,0,195,2}, {'l',1,3434,197,2}, {'s',1,3435,0,0}, {'o',1,3436,0,0}, {';',0,0,199,2},
+    {';',0,0,201,4}, {'l',1,3437,0,0}, {'f',1,3438,0,0}, {'A',1,3439,0,0}, {'r',1,3440,0,0}, {'r',1,3441,0,0},
+    {'y',1,3442,0,0}, {'m',1,3443,0,0}, {'e',1,3444,0,0}, {'d',1,3445,0,0}, {'r',1,3446,0,0}, {';',0,0,205,2},
+    {'t',1,3447,0,0}, {';',0,0,207,4}, {'f',1,3448,0,0}, {'a',1,3449,0,0}, {'r',1,3450,0,0}, {'D',1,3451,0,0},
+    {'e',1,3452,0,0}, {';',0,0,211,1}, {'r',1,3453,0,0}, {';',0,0,212,3}, {'b',1,3454,0,0}, {'f',1,3455,0,0},
+    {'i',1,3456,0,0}, {'r',1,3457,0,0}, {'r',1,3458,0,0}, {'p',2,3459,0,0}, {'y',1,3461,0,0}, {'i',1,3462,0,0},
+    {'y',1,3463,0,0}, {'u',1,3464,0,0}, {'r',1,3465,0,0}, {';',0,0,215,2}, {'t',1,3466,0,0}, {';',0,0,14,3},
+    {'a',1,3467,0,0}, {'c',1,3468,0,0}, {'g',1,3469,0,0}, {'l',1,3470,0,0}, {';',0,0,217,3}, {'e',2,3471,0,0},
+    {'i',1,3473,0,0}, {'o',1,3474,0,0}, {'f',1,3475,0,0}, {'a',1,3476,0,0}, {'r',1,3477,0,0}, {'l',1,3478,0,0},
+    {'c',1,3479,0,0}, {'l',1,3480,220,2}, {'r',1,3481,0,0}, {';',0,0,222,2}, {';',0,0,224,4}, {'f',1,3482,0,0},
+    {'r',1,3483,0,0}, {'r',1,3484,0,0}, {'c',1,3485,0,0}, {'y',1,3486,0,0}, {'y',1,3487,0,0}, {'p',1,3488,0,0},
+    {'d',1,3489,0,0}, {';',0,0,228,2}, {';',0,0,230,4}, {'f',1,3490,0,0}, {'r',1,3491,0,0}, {'y',1,3492,0,0},
+    {'u',1,3493,0,0}, {'b',1,3494,0,0}, {'g',1,3495,0,0}, {'l',1,3496,0,0}, {'r',1,3497,0,0}, {'r',1,3498,0,0},
+    {'d',1,3499,0,0}, {';',0,0,234,2}, {'t',10,3500,0,0}, {'s',6,3510,0,0}, {';',0,0,236,4}, {'f',1,3516,0,0},
+    {'d',1,3517,0,0}, {'g',4,3518,0,0}, {'f',1,3522,0,0}, {'e',1,3523,0,0}, {'r',1,3524,0,0}, {';',0,0,240,3},
+    {'r',1,3525,0,0}, {';',0,0,243,3}, {';',0,0,246,2}, {'i',1,3526,0,0}, {'l',1,3527,0,0}, {';',0,0,248,4},
+    {'u',1,3528,0,0}, {'f',1,3529,0,0}, {'r',1,3530,0,0}, {'y',1,3531,0,0}, {'u',1,3532,0,0}, {'r',1,3533,0,0},
+    {'d',1,3534,0,0}, {';',0,0,252,2}, {'a',1,3535,0,0}, {'t',1,3536,0,0}, {'L',1,3537,0,0}, {';',0,0,254,4},
+    {'r',1,3538,0,0}, {'B',1,3539,0,0}, {'f',1,3540,0,0}, {';',0,0,258,3}, {'C',2,3541,0,0}, {'D',1,3543,0,0},
+    {'E',3,3544,0,0}, {'G',1,3547,0,0}, {'H',1,3548,0,0}, {'L',1,3549,0,0}, {'N',1,3550,0,0}, {'P',1,3551,0,0},
+    {'R',2,3552,0,0}, {'S',2,3554,0,0}, {'T',1,3556,0,0}, {'V',1,3557,0,0}, {'r',1,3558,0,0}, {'l',1,3559,0,0},
+    {'i',1,3560,0,0}, {'u',1,3561,0,0}, {'r',1,3562,0,0}, {';',0,0,261,2}, {'l',1,3563,0,0}, {';',0,0,263,4},
+    {'a',1,3564,0,0}, {'c',1,3565,0,0}, {'g',1,3566,0,0}, {'c',1,3567,0,0}, {'f',1,3568,0,0}, {'n',1,3569,0,0},
+    {'r',1,3570,0,0}, {'a',1,3571,0,0}, {'l',1,3572,0,0}, {'m',1,3573,0,0}, {'l',1,3574,267,2}, {'r',2,3575,0,0},
+    {'t',1,3577,0,0}, {';',0,0,269,2}, {';',0,0,271,4}, {';',0,0,275,2}, {'s',1,3578,0,0}, {'n',1,3579,0,0},
+    {'f',1,3580,0,0}, {'c',1,3581,0,0}, {'m',1,3582,0,0}, {'d',1,3583,0,0}, {'p',1,3584,0,0}, {'r',1,3585,0,0},
+    {';',0,0,277,2}, {'T',1,3586,279,1}, {';',0,0,280,4}, {'f',1,3587,0,0}, {'r',1,3588,0,0}, {'r',1,3589,0,0},
+    {';',0,0,35,2}, {'u',1,3590,0,0}, {'g',1,3591,0,0}, {'r',2,3592,0,0}, {'r',1,3594,0,0}, {'d',1,3595,0,0},
+    {';',0,0,284,2}, {'e',1,3596,0,0}, {';',0,0,37,3}, {';',0,0,286,2}, {'h',1,3597,0,0}, {'f',1,3598,0,0},
+    {'n',1,3599,0,0}, {'g',1,3600,0,0}, {'r',1,3601,0,0}, {';',0,0,288,3}, {'e',1,3602,0,0}, {'H',1,3603,0,0},
+    {'y',1,3604,0,0}, {'T',1,3605,0,0}, {'u',1,3606,0,0}, {'r',1,3607,0,0}, {'d',1,3608,0,0}, {'r',1,3609,0,0},
+    {';',0,0,291,2}, {';',0,0,293,4}, {'r',1,3610,0,0}, {'m',1,3611,0,0}, {'l',1,3612,0,0}, {'f',1,3613,0,0},
+    {'t',1,3614,0,0}, {'a',1,3615,0,0}, {'r',1,3616,0,0}, {'r',1,3617,0,0}, {';',0,0,297,3}, {'s',1,3618,0,0},
+    {'c',1,3619,0,0}, {'h',1,3620,0,0}, {';',0,0,300,3}, {';',0,0,303,3}, {'e',1,3621,0,0}, {'s',1,3622,0,0},
+    {'R',1,3623,0,0}, {'D',1,3624,0,0}, {'c',1,3625,0,0}, {'y',1,3626,0,0}, {';',0,0,306,1}, {';',0,0,307,2},
+    {'r',1,3627,0,0}, {'d',1,3628,0,0}, {';',0,0,309,2}, {';',0,0,311,4}, {'r',1,3629,0,0}, {'t',1,3630,0,0},
+    {'c',1,3631,0,0}, {'n',1,3632,0,0}, {'d',1,3633,0,0}, {'f',1,3634,0,0}, {'p',1,3635,0,0}, {'r',1,3636,0,0},
+    {'r',1,3637,0,0}, {'u',1,3638,0,0}, {'r',2,3639,0,0}, {'c',1,3641,0,0}, {'e',1,3642,0,0}, {'r',1,3643,0,0},
+    {';',0,0,315,2}, {'l',1,3644,0,0}, {';',0,0,317,4}, {'a',1,3645,0,0}, {'c',1,3646,0,0}, {'e',1,3647,0,0},
+    {'o',1,3648,0,0}, {'o',1,3649,0,0}, {'f',1,3650,0,0}, {'r',1,3651,0,0}, {'o',1,3652,0,0}, {'q',1,3653,0,0},
+    {'e',1,3654,0,0}, {'r',1,3655,0,0}, {'o',1,3656,0,0}, {'e',1,3657,0,0}, {'i',2,3658,0,0}, {'n',1,3660,0,0},
+    {'r',1,3661,0,0}, {'l',1,3662,0,0}, {'l',1,3663,321,2}, {'s',1,3664,0,0}, {'r',1,3665,0,0}, {';',0,0,323,2},
+    {'s',1,3666,0,0}, {';',0,0,325,3}, {'b',1,3667,0,0}, {'t',2,3668,0,0}, {'y',1,3670,0,0}, {';',0,0,328,4},
+    {'f',1,3671,0,0}, {'r',1,3672,0,0}, {'a',1,3673,0,0}, {'r',1,3674,0,0}, {'g',1,3675,0,0}, {';',0,0,332,4},
+    {'f',1,3676,0,0}, {'r',1,3677,0,0}, {';',0,0,336,4}, {'f',1,3678,0,0}, {'r',1,3679,0,0}, {'y',1,3680,0,0},
+    {'y',1,3681,0,0}, {'y',1,3682,0,0}, {'u',1,3683,0,0}, {'r',1,3684,0,0}, {';',0,0,340,2}, {';',0,0,342,4},
+    {'f',1,3685,0,0}, {'r',1,3686,0,0}, {'l',1,3687,0,0}, {'y',1,3688,0,0}, {'u',1,3689,0,0}, {'r',1,3690,0,0},
+    {';',0,0,346,2}, {'t',1,3691,0,0}, {'o',1,3692,0,0}, {'a',1,3693,0,0}, {';',0,0,348,3}, {'f',1,3694,0,0},
+    {'r',1,3695,0,0}, {'u',1,3696,0,0}, {'e',1,3697,0,0}, {';',0,0,351,5}, {';',0,0,356,3}, {'r',1,3698,0,0},
+    {'t',1,3699,0,0}, {';',0,0,359,2}, {'i',1,3700,0,0}, {';',0,0,361,4}, {'a',1,3701,0,0}, {'f',1,3702,0,0},
+    {'p',1,3703,0,0}, {'h',1,3704,0,0}, {'c',1,3705,0,0}, {'l',1,3706,0,0}, {';',0,0,2,1}, {';',0,0,365,3},
+    {'a',1,3707,0,0}, {'d',1,3708,0,0}, {'s',1,3709,0,0}, {'v',1,3710,0,0}, {';',0,0,368,3}, {'e',1,3711,0,0},
+    {'l',1,3712,0,0}, {'m',1,3713,0,0}, {'r',1,3714,0,0}, {'s',2,3715,0,0}, {'z',1,3717,0,0}, {'o',1,3718,0,0},
+    {'f',1,3719,0,0}, {';',0,0,371,3}, {'c',1,3720,0,0}, {';',0,0,374,3}, {'d',1,3721,0,0}, {'s',1,3722,0,0},
+    {'r',1,3723,0,0}, {'n',1,3724,0,0}, {'r',1,3725,0,0}, {';',0,0,377,1}, {'m',1,3726,0,0}, {'l',1,3727,0,0},
+    {'l',1,3728,378,2}, {'o',1,3729,0,0}, {'n',1,3730,0,0}, {'t',1,3731,0,0}, {'k',4,3732,0,0}, {'v',1,3736,0,0},
+    {'w',1,3737,0,0}, {'k',2,3738,0,0}, {'n',1,3740,0,0}, {';',0,0,380,2}, {'u',1,3741,0,0}, {'a',1,3742,0,0},
+    {'p',1,3743,0,0}, {'s',1,3744,0,0}, {'n',1,3745,0,0}, {'a',1,3746,0,0}, {'h',1,3747,0,0}, {'w',1,3748,0,0},
+    {';',0,0,382,4}, {'c',3,3749,0,0}, {'o',3,3752,0,0}, {'s',2,3755,0,0}, {'t',1,3757,0,0}, {'u',1,3758,0,0},
+    {'v',1,3759,0,0}, {'w',1,3760,0,0}, {'r',1,3761,0,0}, {'c',1,3762,0,0}, {'n',1,3763,0,0}, {'1',2,3764,0,0},
+    {'3',1,3766,0,0}, {'c',1,3767,0,0}, {';',0,0,386,4}, {'q',1,3768,0,0}, {'t',1,3769,0,0}, {'f',1,3770,0,0},
+    {';',0,0,390,3}, {'t',1,3771,0,0}, {'t',1,3772,0,0}, {'D',4,3773,0,0}, {'H',5,3777,0,0}, {'U',4,3782,0,0},
+    {'V',7,3786,0,0}, {'b',1,3793,0,0}, {'d',4,3794,0,0}, {'h',5,3798,0,0}, {'m',1,3803,0,0}, {'p',1,3804,0,0},
+    {'t',1,3805,0,0}, {'u',4,3806,0,0}, {'v',7,3810,0,0}, {'i',1,3817,0,0}, {'v',1,3818,0,0}, {'b',1,3819,0,0},
+    {'r',1,3820,0,0}, {'m',1,3821,0,0}, {'m',2,3822,0,0}, {'l',3,3824,0,0}, {'l',2,3827,0,0}, {'p',3,3829,0,0},
+    {'u',1,3832,0,0}, {';',0,0,393,3}, {'a',1,3833,0,0}, {'b',1,3834,0,0}, {'c',2,3835,0,0}, {'d',1,3837,0,0},
+    {'s',1,3838,0,0}, {'e',1,3839,0,0}, {'o',1,3840,0,0}, {'p',1,3841,0,0}, {'r',1,3842,0,0}, {'d',1,3843,0,0},
+    {'r',1,3844,0,0}, {'p',1,3845,0,0}, {'t',1,3846,0,0}, {'i',1,3847,0,0}, {'p',1,3848,0,0}, {'t',2,3849,396,2},
+    {';',0,0,398,4}, {'y',1,3851,0,0}, {'c',1,3852,0,0}, {';',0,0,402,2}, {';',0,0,404,3}, {'E',1,3853,0,0},
+    {'c',3,3854,0,0}, {'e',1,3857,0,0}, {'f',1,3858,0,0}, {'m',1,3859,0,0}, {'s',1,3860,0,0}, {'b',1,3861,0,0},
+    {'o',1,3862,0,0}, {'m',1,3863,0,0}, {'p',3,3864,0,0}, {'g',2,3867,0,0}, {'i',1,3869,0,0}, {'f',1,3870,0,0},
+    {'r',1,3871,0,0}, {'y',2,3872,165,2}, {'r',1,3874,0,0}, {'s',1,3875,0,0}, {'r',1,3876,0,0}, {'b',2,3877,0,0},
+    {'p',2,3879,0,0}, {'o',1,3881,0,0}, {'a',1,3882,0,0}, {'p',1,3883,0,0}, {'s',1,3884,0,0}, {'a',1,3885,0,0},
+    {';',0,0,407,3}, {'b',1,3886,0,0}, {'c',2,3887,0,0}, {'d',1,3889,0,0}, {'o',1,3890,0,0}, {'s',1,3891,0,0},
+    {'a',1,3892,0,0}, {'l',1,3893,0,0}, {'r',1,3894,0,0}, {'v',1,3895,0,0}, {'e',1,3896,0,0}, {'e',1,3897,0,0},
+    {'o',1,3898,0,0}, {'n',1,3899,0,0}, {'c',1,3900,0,0}, {'r',1,3901,0,0}, {'r',1,3902,0,0}, {'g',1,3903,0,0},
+    {'e',1,3904,0,0}, {'r',1,3905,0,0}, {'h',2,3906,0,0}, {'a',1,3908,0,0}, {'a',1,3909,0,0}, {'r',1,3910,0,0},
+    {';',0,0,410,2}, {'g',1,3911,0,0}, {'r',1,3912,0,0}, {'t',1,3913,0,0}, {';',0,0,57,2}, {'t',1,3914,0,0},
+    {'p',1,3915,0,0}, {'s',1,3916,0,0}, {';',0,0,412,4}, {'r',2,3917,0,0}, {'m',3,3919,0,0}, {';',0,0,136,2},
+    {'a',1,3922,0,0}, {'i',1,3923,0,0}, {';',0,0,416,2}, {'i',1,3924,0,0}, {'o',1,3925,0,0}, {'y',1,3926,0,0},
+    {'o',1,3927,0,0}, {'r',1,3928,0,0}, {'l',1,3929,0,0}, {'f',1,3930,0,0}, {';',0,0,418,2}, {'e',1,3931,0,0},
+    {'m',1,3932,0,0}, {'p',1,3933,0,0}, {'s',1,3934,0,0}, {'b',1,3935,0,0}, {'n',3,3936,0,0}, {'k',1,3939,0,0},
+    {'o',1,3940,0,0}, {'r',1,3941,0,0}, {'r',1,3942,0,0}, {'y',1,3943,0,0}, {'l',1,3944,0,0}, {'r',1,3945,0,0},
+    {'o',1,3946,0,0}, {'i',2,3947,0,0}, {'r',1,3949,0,0}, {'a',1,3950,0,0}, {'n',1,3951,0,0}, {'y',1,3952,0,0},
+    {'g',1,3953,0,0}, {'o',1,3954,0,0}, {'t',1,3955,0,0}, {'u',1,3956,0,0}, {'t',1,3957,0,0}, {'r',1,3958,0,0},
+    {'r',2,3959,0,0}, {'l',1,3961,0,0}, {';',0,0,420,2}, {'t',1,3962,0,0}, {'o',1,3963,0,0}, {';',0,0,422,4},
+    {'a',1,3964,0,0}, {';',0,0,426,3}, {'d',1,3965,0,0}, {'n',1,3966,0,0}, {';',0,0,429,3}, {';',0,0,432,3},
+    {'d',1,3967,0,0}, {'c',1,3968,0,0}, {'t',1,3969,0,0}, {'p',2,3970,0,0}, {';',0,0,435,2}, {'p',1,3972,0,0},
+    {'o',1,3973,0,0}, {'f',1,3974,0,0}, {'r',2,3975,0,0}, {'u',1,3977,0,0}, {'i',3,3978,0,0}, {'i',1,3981,0,0},
+    {'o',1,3982,0,0}, {'i',1,3983,0,0}, {'l',1,3984,0,0}, {'a',1,3985,0,0}, {'e',1,3986,0,0}, {'i',1,3987,0,0},
+    {'p',1,3988,0,0}, {'o',1,3989,0,0}, {'r',1,3990,0,0}, {'r',1,3991,0,0}, {'o',1,3992,0,0}, {'m',1,3993,0,0},
+    {';',0,0,437,2}, {';',0,0,68,2}, {'l',1,3994,439,2}, {'o',1,3995,0,0}, {'l',1,3996,0,0}, {'s',1,3997,0,0},
+    {'e',1,3998,0,0}, {'o',1,3999,0,0}, {'l',1,4000,0,0}, {';',0,0,441,2}, {'a',1,4001,0,0}, {'l',1,4002,0,0},
+    {'i',1,4003,0,0}, {'l',1,4004,0,0}, {';',0,0,443,4}, {'i',1,4005,0,0}, {'i',1,4006,0,0}, {'t',1,4007,0,0},
+    {'i',1,4008,0,0}, {'n',1,4009,0,0}, {'f',1,4010,0,0}, {'f',1,4011,0,0}, {'a',1,4012,0,0}, {'k',2,4013,0,0},
+    {'r',1,4015,0,0}, {'c',6,4016,0,0}, {'s',1,4022,0,0}, {'w',1,4023,0,0}, {'r',1,4024,0,0}, {';',0,0,447,3},
+    {'u',1,4025,0,0}, {'m',1,4026,0,0}, {';',0,0,450,3}, {'e',1,4027,0,0}, {'r',1,4028,0,0}, {';',0,0,453,2},
+    {'t',1,4029,0,0}, {';',0,0,455,3}, {';',0,0,73,3}, {'q',1,4030,0,0}, {'s',1,4031,0,0}, {';',0,0,458,3},
+    {'c',1,4032,0,0}, {'d',1,4033,0,0}, {'l',2,4034,0,0}, {';',0,0,461,4}, {';',0,0,8,3}, {'e',1,4036,0,0},
+    {'y',1,4037,0,0}, {';',0,0,465,3}, {';',0,0,468,3}, {';',0,0,471,3}, {';',0,0,474,3}, {'p',2,4038,0,0},
+    {';',0,0,477,3}, {'q',2,4040,0,0}, {'i',1,4042,0,0}, {'f',1,4043,0,0}, {'v',1,4044,0,0}, {'r',1,4045,0,0},
+    {'m',3,4046,0,0}, {'c',1,4049,0,0}, {'i',1,4050,0,0}, {'o',1,4051,0,0}, {'P',1,4052,0,0}, {'u',1,4053,0,0},
+    {'a',2,4054,0,0}, {'d',1,4056,0,0}, {'e',1,4057,0,0}, {'l',1,4058,0,0}, {'s',1,4059,0,0}, {'r',1,4060,0,0},
+    {'E',1,4061,0,0}, {'r',1,4062,0,0}, {'r',1,4063,0,0}, {'f',1,4064,0,0}, {'i',1,4065,0,0}, {'d',1,4066,0,0},
+    {'r',3,4067,0,0}, {'r',1,4070,0,0}, {'r',1,4071,0,0}, {'r',1,4072,0,0}, {'l',1,4073,0,0}, {'c',1,4074,0,0},
+    {';',0,0,480,4}, {'e',1,4075,0,0}, {'w',1,4076,0,0}, {'r',1,4077,0,0}, {'t',1,4078,0,0}, {'k',2,4079,0,0},
+    {'f',1,4081,0,0}, {'b',1,4082,0,0}, {'r',1,4083,0,0}, {'a',1,4084,0,0}, {'r',1,4085,0,0}, {'u',1,4086,0,0},
+    {'h',1,4087,0,0}, {'u',1,4088,0,0}, {'r',1,4089,0,0}, {';',0,0,484,2}, {'y',1,4090,0,0}, {'c',1,4091,0,0},
+    {';',0,0,486,3}, {';',0,0,489,4}, {'a',1,4092,0,0}, {'i',1,4093,0,0}, {'n',1,4094,0,0}, {'f',1,4095,0,0},
+    {'t',1,4096,0,0}, {'i',1,4097,0,0}, {'c',1,4098,0,0}, {'g',3,4099,0,0}, {'t',1,4102,0,0}, {'f',1,4103,0,0},
+    {'e',1,4104,0,0}, {'a',1,4105,0,0}, {'i',1,4106,0,0}, {'d',1,4107,0,0}, {';',0,0,493,3}, {'c',1,4108,0,0},
+    {'e',2,4109,0,0}, {'l',1,4111,0,0}, {'p',1,4112,0,0}, {'y',1,4113,0,0}, {'o',1,4114,0,0}, {'f',1,4115,0,0},
+    {'a',1,4116,0,0}, {'o',1,4117,0,0}, {'e',1,4118,0,0}, {'r',1,4119,0,0}, {'n',5,4120,0,0}, {'l',1,4125,0,0},
+    {'c',1,4126,0,0}, {'l',1,4127,496,2}, {'r',1,4128,0,0}, {';',0,0,498,2}, {';',0,0,500,4}, {'t',1,4129,0,0},
+    {'f',1,4130,0,0}, {'r',1,4131,0,0}, {'r',1,4132,0,0}, {'c',1,4133,0,0}, {'p',1,4134,0,0}, {'d',1,4135,0,0},
+    {';',0,0,504,2}, {';',0,0,506,4}, {'e',1,4136,0,0}, {'y',1,4137,0,0}, {'y',1,4138,0,0}, {'f',1,4139,0,0},
+    {'r',1,4140,0,0}, {'r',1,4141,0,0}, {'r',1,4142,0,0}, {'a',1,4143,0,0}, {'r',1,4144,0,0}, {';',0,0,510,3},
+    {'r',1,4145,0,0}, {'u',1,4146,0,0}, {'m',1,4147,0,0}, {'r',1,4148,0,0}, {'b',1,4149,0,0}, {'g',3,4150,0,0},
+    {';',0,0,513,3}, {'u',1,4153,0,0}, {'r',8,4154,0,0}, {';',0,0,516,3}, {'a',1,4162,0,0}, {'e',2,4163,0,0},
+    {'r',1,4165,0,0}, {'r',1,4166,0,0}, {'a',1,4167,0,0}, {'k',2,4168,0,0}, {'r',1,4170,0,0}, {'d',1,4171,0,0},
+    {'i',1,4172,0,0}, {'b',1,4173,0,0}, {';',0,0,519,2}, {'a',1,4174,0,0}, {'u',1,4175,0,0}, {'d',1,4176,0,0},
+    {'u',1,4177,0,0}, {'h',1,4178,0,0}, {'t',5,4179,0,0}, {';',0,0,521,3}, {';',0,0,94,3}, {'q',1,4184,0,0},
+    {'s',1,4185,0,0}, {';',0,0,524,3}, {'c',1,4186,0,0}, {'d',1,4187,0,0}, {'g',2,4188,0,0}, {'s',5,4190,0,0},
+    {'s',1,4195,0,0}, {'o',1,4196,0,0}, {';',0,0,527,4}, {';',0,0,531,3}, {'r',2,4197,0,0}, {'l',1,4199,0,0},
+    {'y',1,4200,0,0}, {'r',1,4201,0,0}, {'o',1,4202,0,0}, {'a',1,4203,0,0}, {'r',1,4204,0,0}, {'d',1,4205,0,0},
+    {'u',1,4206,0,0}, {';',0,0,534,3}, {'p',2,4207,0,0}, {';',0,0,537,3}, {'q',2,4209,0,0}, {'i',1,4211,0,0},
+    {'n',1,4212,0,0}, {'r',1,4213,0,0}, {'r',1,4214,0,0}, {'g',3,4215,0,0}, {'p',1,4218,0,0}, {'a',1,4219,0,0},
+    {'f',1,4220,0,0}, {'l',1,4221,0,0}, {'i',1,4222,0,0}, {'a',1,4223,0,0}, {'b',1,4224,0,0}, {';',0,0,540,3},
+    {'e',1,4225,0,0}, {'f',1,4226,0,0}, {'r',2,4227,0,0}, {'r',1,4229,0,0}, {'o',1,4230,0,0}, {'a',1,4231,0,0},
+    {';',0,0,543,3}, {'r',1,4232,0,0}, {'q',1,4233,0,0}, {'r',1,4234,0,0}, {';',0,0,240,3}, {'m',3,4235,0,0},
+    {'b',1,4238,0,0}, {'u',1,4239,0,0}, {'r',1,4240,0,0}, {'c',1,4241,0,0}, {'i',1,4242,0,0}, {'o',1,4243,0,0},
+    {'r',1,4244,0,0}, {'m',1,4245,0,0}, {'a',1,4246,0,0}, {'u',1,4247,0,0}, {'P',1,4248,0,0}, {'i',3,4249,0,0},
+    {'d',1,4252,0,0}, {'u',1,4253,0,0}, {'r',1,4254,0,0}, {'E',1,4255,0,0}, {'o',1,4256,0,0}, {'r',1,4257,546,2},
+    {'e',1,4258,0,0}, {'t',2,4259,0,0}, {';',0,0,548,3}, {'s',1,4261,0,0}, {'k',1,4262,0,0}, {'m',1,4263,0,0},
+    {';',0,0,551,2}, {'s',1,4264,0,0}, {'s',1,4265,0,0}, {';',0,0,553,4}, {';',0,0,557,3}, {'r',1,4266,0,0},
+    {';',0,0,560,3}, {'a',1,4267,0,0}, {'c',1,4268,0,0}, {'d',1,4269,0,0}, {'u',1,4270,0,0}, {'p',1,4271,0,0},
+    {'r',1,4272,0,0}, {'l',1,4273,0,0}, {'e',1,4274,0,0}, {'f',1,4275,0,0}, {'r',1,4276,0,0}, {'p',1,4277,0,0},
+    {'t',1,4278,0,0}, {'a',1,4279,0,0}, {';',0,0,563,5}, {';',0,0,568,6}, {'v',1,4280,0,0}, {'f',1,4281,0,0},
+    {';',0,0,574,5}, {';',0,0,579,6}, {'v',1,4282,0,0}, {'g',1,4283,0,0}, {'a',1,4284,0,0}, {'a',1,4285,0,0},
+    {'l',1,4286,0,0}, {'u',1,4287,0,0}, {'g',1,4288,0,0}, {';',0,0,585,3}, {'E',1,4289,0,0}, {'i',1,4290,0,0},
+    {'o',1,4291,0,0}, {'p',1,4292,0,0}, {'u',1,4293,0,0}, {'p',1,4294,588,2}, {'m',1,4295,0,0}, {'p',1,4296,0,0},
+    {'r',1,4297,0,0}, {'d',1,4298,0,0}, {'n',1,4299,0,0}, {'p',1,4300,0,0}, {';',0,0,590,2}, {'s',1,4301,0,0},
+    {'r',1,4302,0,0}, {'r',2,4303,0,0}, {'o',1,4305,0,0}, {'u',1,4306,0,0}, {'e',1,4307,0,0}, {'i',1,4308,0,0},
+    {'i',1,4309,0,0}, {';',0,0,592,4}, {';',0,0,596,5}, {';',0,0,601,3}, {'q',3,4310,0,0}, {'s',1,4313,0,0},
+    {'i',1,4314,0,0}, {';',0,0,604,3}, {'r',1,4315,0,0}, {'r',1,4316,0,0}, {'r',1,4317,0,0}, {'a',1,4318,0,0},
+    {';',0,0,607,3}, {'d',1,4319,0,0}, {';',0,0,108,3}, {'y',1,4320,0,0}, {'r',1,4321,0,0}, {';',0,0,610,5},
+    {'r',1,4322,0,0}, {'r',1,4323,0,0}, {';',0,0,615,3}, {'f',1,4324,0,0}, {'q',3,4325,0,0}, {'s',2,4328,0,0},
+    {'i',1,4330,0,0}, {';',0,0,618,3}, {'r',1,4331,0,0}, {'d',1,4332,0,0}, {'f',1,4333,0,0}, {';',0,0,111,2},
+    {'i',1,4334,0,0}, {'n',1,4335,0,0}, {'r',4,4336,0,0}, {'l',1,4340,0,0}, {';',0,0,621,3}, {'c',1,4341,0,0},
+    {'e',2,4342,0,0}, {'r',1,4344,0,0}, {'r',1,4345,0,0}, {'g',1,4346,0,0}, {'r',1,4347,0,0}, {';',0,0,624,3},
+    {'c',1,4348,0,0}, {'e',1,4349,0,0}, {'r',1,4350,0,0}, {'o',1,4351,0,0}, {'m',2,4352,0,0}, {'i',1,4354,0,0},
+    {'a',1,4355,0,0}, {'s',1,4356,0,0}, {'b',4,4357,0,0}, {'c',1,4361,0,0}, {'p',4,4362,0,0}, {'l',1,4366,0,0},
+    {'l',1,4367,0,0}, {'g',1,4368,0,0}, {'i',1,4369,0,0}, {';',0,0,627,1}, {'e',1,4370,0,0}, {'s',1,4371,0,0},
+    {'a',1,4372,0,0}, {'a',1,4373,0,0}, {'p',1,4374,0,0}, {'a',1,4375,0,0}, {'e',1,4376,0,0}, {'t',1,4377,0,0},
+    {'n',1,4378,0,0}, {'A',1,4379,0,0}, {'e',1,4380,0,0}, {'t',2,4381,0,0}, {'A',1,4383,0,0}, {'t',1,4384,0,0},
+    {'i',1,4385,0,0}, {'r',1,4386,0,0}, {'r',2,4387,0,0}, {'e',1,4389,0,0}, {'u',1,4390,0,0}, {'t',1,4391,0,0},
+    {'r',2,4392,0,0}, {';',0,0,628,2}, {'s',1,4394,0,0}, {'l',1,4395,0,0}, {'v',1,4396,0,0}, {'t',1,4397,0,0},
+    {'o',1,4398,0,0}, {'i',1,4399,0,0}, {'i',1,4400,0,0}, {';',0,0,630,4}, {'n',1,4401,0,0}, {'a',1,4402,0,0},
+    {';',0,0,634,3}, {'a',1,4403,0,0}, {';',0,0,637,2}, {'t',1,4404,0,0}, {'r',1,4405,0,0}, {'i',1,4406,0,0},
+    {'r',1,4407,0,0}, {'n',1,4408,0,0}, {';',0,0,639,3}, {'c',1,4409,0,0}, {'g',1,4410,0,0}, {'c',1,4411,0,0},
+    {'d',1,4412,0,0}, {'n',1,4413,0,0}, {'f',1,4414,0,0}, {'r',1,4415,0,0}, {'r',1,4416,0,0}, {'u',1,4417,0,0},
+    {'r',1,4418,0,0}, {';',0,0,642,3}, {'e',1,4419,0,0}, {'f',1,4420,645,2}, {'m',1,4421,647,2}, {'g',1,4422,0,0},
+    {'r',1,4423,0,0}, {'l',1,4424,0,0}, {';',0,0,649,3}, {'r',1,4425,0,0}, {'a',1,4426,0,0}, {'l',1,4427,0,0},
+    {'l',1,4428,0,0}, {'m',1,4429,0,0}, {'l',1,4430,652,2}, {'a',1,4431,0,0}, {';',0,0,654,3}, {'a',2,4432,657,2},
+    {'s',2,4434,0,0}, {'t',1,4436,0,0}, {';',0,0,659,2}, {'c',1,4437,0,0}, {'i',1,4438,0,0}, {'m',1,4439,0,0},
+    {'p',1,4440,0,0}, {'t',1,4441,0,0}, {';',0,0,661,4}, {';',0,0,665,2}, {'v',1,4442,0,0}, {'m',1,4443,0,0},
+    {'n',1,4444,0,0}, {'c',1,4445,0,0}, {';',0,0,667,2}, {'n',2,4446,0,0}, {'s',9,4448,0,0}, {'n',1,4457,0,0},
+    {'f',1,4458,0,0}, {'n',1,4459,0,0}, {';',0,0,669,3}, {'p',1,4460,0,0}, {'u',1,4461,0,0}, {';',0,0,672,3},
+    {'c',6,4462,0,0}, {'m',1,4468,0,0}, {'E',1,4469,0,0}, {'a',1,4470,0,0}, {'s',1,4471,0,0}, {'d',1,4472,0,0},
+    {'f',3,4473,0,0}, {'p',2,4476,0,0}, {'i',1,4478,0,0}, {'r',1,4479,0,0}, {'r',1,4480,0,0}, {';',0,0,675,2},
+    {'c',1,4481,0,0}, {';',0,0,677,4}, {'t',1,4482,0,0}, {'f',1,4483,0,0}, {'i',1,4484,0,0}, {'r',1,4485,0,0},
+    {'t',2,4486,0,0}, {'s',1,4488,0,0}, {'t',1,4489,279,1}, {'r',1,4490,0,0}, {'r',1,4491,0,0}, {'a',1,4492,0,0},
+    {'r',1,4493,0,0}, {'r',1,4494,0,0}, {'e',1,4495,0,0}, {'u',1,4496,0,0}, {'i',1,4497,0,0}, {'m',1,4498,0,0},
+    {'g',4,4499,0,0}, {'u',1,4503,0,0}, {'r',11,4504,0,0}, {'a',1,4515,0,0}, {'i',1,4516,0,0}, {'r',1,4517,0,0},
+    {'r',1,4518,0,0}, {'a',1,4519,0,0}, {'k',2,4520,0,0}, {'r',1,4522,0,0}, {'d',1,4523,0,0}, {'i',1,4524,0,0},
+    {'b',1,4525,0,0}, {';',0,0,681,2}, {'a',1,4526,0,0}, {'d',1,4527,0,0}, {'u',1,4528,0,0}, {'h',1,4529,0,0},
+    {'l',4,4530,0,0}, {'t',1,4534,0,0}, {';',0,0,35,2}, {'s',1,4535,0,0}, {'o',1,4536,0,0}, {';',0,0,683,4},
+    {'r',2,4537,0,0}, {';',0,0,687,2}, {'v',1,4539,0,0}, {'h',1,4540,0,0}, {'g',1,4541,0,0}, {'i',1,4542,0,0},
+    {'r',1,4543,0,0}, {'a',1,4544,0,0}, {';',0,0,689,3}, {'u',1,4545,0,0}, {'i',1,4546,0,0}, {'n',1,4547,0,0},
+    {'r',1,4548,0,0}, {'r',1,4549,0,0}, {'a',1,4550,0,0}, {'f',1,4551,0,0}, {'l',1,4552,0,0}, {'i',1,4553,0,0},
+    {'r',2,4554,0,0}, {'o',1,4556,0,0}, {'r',1,4557,0,0}, {'q',1,4558,0,0}, {'r',1,4559,0,0}, {';',0,0,288,3},
+    {'b',1,4560,0,0}, {'u',1,4561,0,0}, {'r',1,4562,0,0}, {'m',1,4563,0,0}, {'i',4,4564,0,0}, {'u',1,4568,0,0},
+    {'u',1,4569,0,0}, {'u',1,4570,0,0}, {';',0,0,692,3}, {'p',1,4571,0,0}, {'r',1,4572,0,0}, {'u',1,4573,0,0},
+    {';',0,0,695,3}, {'d',1,4574,0,0}, {'r',1,4575,0,0}, {'E',1,4576,0,0}, {'a',1,4577,0,0}, {'s',1,4578,0,0},
+    {'o',1,4579,0,0}, {'i',1,4580,0,0}, {';',0,0,698,2}, {'t',3,4581,0,0}, {'r',1,4584,0,0}, {'r',2,4585,0,0},
+    {'t',1,4587,700,2}, {'i',1,4588,0,0}, {'w',1,4589,0,0}, {'m',2,4590,0,0}, {'t',1,4592,0,0}, {';',0,0,702,4},
+    {'o',1,4593,0,0}, {'r',1,4594,0,0}, {'h',1,4595,0,0}, {'y',1,4596,0,0}, {'r',1,4597,0,0}, {';',0,0,134,2},
+    {'m',1,4598,0,0}, {';',0,0,706,3}, {'d',1,4599,0,0}, {'e',2,4600,0,0}, {'g',2,4602,0,0}, {'l',2,4604,0,0},
+    {'n',1,4606,0,0}, {'p',1,4607,0,0}, {'r',1,4608,0,0}, {'r',1,4609,0,0}, {'l',1,4610,0,0}, {'s',1,4611,0,0},
+    {'p',1,4612,0,0}, {'d',1,4613,0,0}, {'l',1,4614,0,0}, {';',0,0,709,3}, {'e',2,4615,0,0}, {'t',1,4617,0,0},
+    {';',0,0,712,1}, {'b',2,4618,0,0}, {'f',1,4620,0,0}, {'d',1,4621,0,0}, {'r',1,4622,0,0}, {'a',1,4623,0,0},
+    {'u',1,4624,0,0}, {'u',2,4625,0,0}, {';',0,0,713,3}, {'a',1,4627,0,0}, {'f',1,4628,0,0}, {'r',1,4629,0,0},
+    {'r',1,4630,0,0}, {'t',1,4631,0,0}, {'i',1,4632,0,0}, {'a',1,4633,0,0}, {'r',2,4634,0,0}, {'a',1,4636,0,0},
+    {'n',1,4637,0,0}, {';',0,0,716,3}, {'E',1,4638,0,0}, {'d',1,4639,0,0}, {'e',2,4640,0,0}, {'m',1,4642,0,0},
+    {'n',2,4643,0,0}, {'p',1,4645,0,0}, {'r',1,4646,0,0}, {'s',3,4647,0,0}, {'c',6,4650,0,0}, {';',0,0,300,3},
+    {'g',1,4656,0,0}, {'1',1,4657,719,2}, {'2',1,4658,721,2}, {'3',1,4659,723,2}, {';',0,0,725,3}, {'E',1,4660,0,0},
+    {'d',2,4661,0,0}, {'e',2,4663,0,0}, {'h',1,4665,0,0}, {'l',1,4666,0,0}, {'m',1,4667,0,0}, {'n',2,4668,0,0},
+    {'p',1,4670,0,0}, {'s',3,4671,0,0}, {'r',1,4674,0,0}, {'r',2,4675,0,0}, {'w',1,4677,0,0}, {'i',1,4678,0,0},
+    {'g',1,4679,0,0}, {';',0,0,728,2}, {'k',1,4680,0,0}, {'r',1,4681,0,0}, {'d',1,4682,0,0}, {';',0,0,730,2},
+    {'t',1,4683,0,0}, {'r',1,4684,0,0}, {';',0,0,732,4}, {'r',1,4685,0,0}, {'t',1,4686,0,0}, {'c',1,4687,0,0},
+    {'n',1,4688,0,0}, {'a',1,4689,0,0}, {'s',1,4690,0,0}, {'r',1,4691,0,0}, {'d',1,4692,0,0}, {'e',1,4693,0,0},
+    {'t',1,4694,0,0}, {'a',1,4695,0,0}, {';',0,0,736,3}, {'b',1,4696,0,0}, {'c',1,4697,0,0}, {'f',2,4698,0,0},
+    {'a',1,4700,0,0}, {'i',1,4701,0,0}, {'d',1,4702,0,0}, {'a',1,4703,0,0}, {'d',1,4704,0,0}, {'e',1,4705,0,0},
+    {'m',1,4706,0,0}, {'p',1,4707,0,0}, {'s',1,4708,0,0}, {'t',1,4709,0,0}, {'e',1,4710,0,0}, {'r',1,4711,0,0},
+    {'y',1,4712,0,0}, {'c',1,4713,0,0}, {'r',1,4714,0,0}, {'x',1,4715,0,0}, {'h',1,4716,0,0}, {'r',1,4717,0,0},
+    {'r',1,4718,0,0}, {'u',1,4719,0,0}, {'r',1,4720,0,0}, {'c',1,4721,0,0}, {'e',1,4722,0,0}, {'r',1,4723,0,0},
+    {';',0,0,739,2}, {'r',1,4724,0,0}, {'l',1,4725,0,0}, {'a',1,4726,0,0}, {'s',1,4727,0,0}, {';',0,0,741,4},
+    {'a',1,4728,0,0}, {'r',2,4729,0,0}, {'l',1,4731,0,0}, {'o',1,4732,0,0}, {'r',1,4733,0,0}, {'r',1,4734,0,0},
+    {'c',1,4735,0,0}, {';',0,0,136,2}, {'o',1,4736,0,0}, {'f',1,4737,0,0}, {'r',1,4738,0,0}, {'o',1,4739,0,0},
+    {'a',1,4740,0,0}, {'u',1,4741,0,0}, {'i',3,4742,0,0}, {'p',1,4745,0,0}, {'o',1,4746,0,0}, {'r',1,4747,0,0},
+    {'n',1,4748,0,0}, {'r',1,4749,0,0}, {'r',1,4750,0,0}, {'o',1,4751,0,0}, {'l',1,4752,0,0}, {'i',2,4753,0,0},
+    {'r',1,4755,0,0}, {'l',1,4756,745,2}, {'n',1,4757,0,0}, {'r',1,4758,0,0}, {'r',2,4759,0,0}, {'s',1,4761,0,0},
+    {'g',1,4762,0,0}, {'e',1,4763,0,0}, {'k',1,4764,0,0}, {'n',1,4765,0,0}, {'p',3,4766,0,0}, {'r',2,4769,0,0},
+    {'s',2,4771,0,0}, {'t',2,4773,0,0}, {';',0,0,747,2}, {'s',1,4775,0,0}, {';',0,0,118,3}, {'b',1,4776,0,0},
+    {'e',1,4777,0,0}, {'l',1,4778,0,0}, {'b',1,4779,0,0}, {'t',1,4780,0,0}, {';',0,0,749,4}, {'r',1,4781,0,0},
+    {'u',2,4782,0,0}, {'f',1,4784,0,0}, {'o',1,4785,0,0}, {'r',1,4786,0,0}, {'r',1,4787,0,0}, {'b',1,4788,0,0},
+    {'p',1,4789,0,0}, {'g',1,4790,0,0}, {'r',1,4791,0,0}, {'b',1,4792,0,0}, {'g',1,4793,0,0}, {'e',1,4794,0,0},
+    {';',0,0,753,4}, {'f',1,4795,0,0}, {'a',1,4796,0,0}, {'r',1,4797,0,0}, {'p',1,4798,0,0}, {'r',1,4799,0,0},
+    {'p',1,4800,0,0}, {'r',1,4801,0,0}, {';',0,0,757,4}, {'r',1,4802,0,0}, {'r',1,4803,0,0}, {'r',1,4804,0,0},
+    {'r',1,4805,0,0}, {'p',1,4806,0,0}, {'s',1,4807,0,0}, {'o',1,4808,0,0}, {'f',1,4809,0,0}, {'l',1,4810,0,0},
+    {'i',1,4811,0,0}, {'r',1,4812,0,0}, {'r',1,4813,0,0}, {'r',1,4814,0,0}, {'c',1,4815,0,0}, {'l',1,4816,0,0},
+    {'r',1,4817,0,0}, {'e',1,4818,0,0}, {'d',1,4819,0,0}, {'u',1,4820,0,0}, {'y',1,4821,0,0}, {'r',1,4822,0,0},
+    {';',0,0,761,2}, {';',0,0,146,2}, {';',0,0,763,4}, {'y',1,4823,0,0}, {'f',1,4824,0,0}, {'r',1,4825,0,0},
+    {'y',1,4826,0,0}, {'l',1,4827,767,2}, {'u',1,4828,0,0}, {'r',1,4829,0,0}, {';',0,0,769,2}, {'t',1,4830,0,0},
+    {'t',1,4831,0,0}, {'a',1,4832,0,0}, {';',0,0,771,4}, {'y',1,4833,0,0}, {'r',1,4834,0,0}, {'f',1,4835,0,0},
+    {'r',1,4836,0,0}, {';',0,0,775,3}, {'j',1,4837,0,0}, {'g',1,4838,778,2}, {'t',1,4839,0,0}, {'v',1,4840,0,0},
+    {'c',1,4841,780,2}, {'v',1,4842,0,0}, {'a',1,4843,0,0}, {'r',1,4844,0,0}, {'n',1,4845,0,0}, {';',0,0,782,4},
+    {'y',1,4846,0,0}, {'g',1,4847,786,2}, {';',0,0,788,4}, {'g',1,4848,0,0}, {'d',1,4849,0,0}, {';',0,0,157,2},
+    {'s',1,4850,0,0}, {';',0,0,792,3}, {'e',1,4851,0,0}, {'u',1,4852,0,0}, {'o',1,4853,0,0}, {';',0,0,795,2},
+    {';',0,0,797,4}, {'e',1,4854,0,0}, {';',0,0,801,3}, {'e',1,4855,0,0}, {';',0,0,804,2}, {';',0,0,165,2},
+    {'t',1,4856,0,0}, {'t',1,4857,0,0}, {'e',1,4858,0,0}, {'o',1,4859,0,0}, {'i',1,4860,0,0}, {'c',1,4861,0,0},
+    {'i',1,4862,0,0}, {';',0,0,806,2}, {'l',1,4863,0,0}, {'e',1,4864,0,0}, {'l',1,4865,0,0}, {'k',1,4866,0,0},
+    {'e',1,4867,0,0}, {'n',2,4868,0,0}, {'r',1,4870,0,0}, {'n',1,4871,0,0}, {'o',1,4872,0,0}, {';',0,0,808,3},
+    {'o',1,4873,0,0}, {'t',1,4874,0,0}, {'s',1,4875,0,0}, {';',0,0,811,4}, {'a',1,4876,0,0}, {'r',1,4877,0,0},
+    {';',0,0,815,2}, {';',0,0,817,2}, {';',0,0,819,2}, {'e',1,4878,0,0}, {';',0,0,821,3}, {'v',1,4879,0,0},
+    {'o',1,4880,0,0}, {'a',1,4881,0,0}, {'r',1,4882,0,0}, {'o',1,4883,0,0}, {'e',1,4884,0,0}, {';',0,0,824,4},
+    {'o',1,4885,0,0}, {'q',1,4886,0,0}, {'l',1,4887,0,0}, {'A',1,4888,0,0}, {'B',1,4889,0,0}, {'L',1,4890,0,0},
+    {'R',1,4891,0,0}, {'T',1,4892,0,0}, {'a',1,4893,0,0}, {';',0,0,828,4}, {'o',1,4894,0,0}, {'t',1,4895,0,0},
+    {'o',1,4896,0,0}, {'c',1,4897,832,2}, {';',0,0,834,2}, {'v',1,4898,0,0}, {'e',1,4899,0,0}, {'r',1,4900,0,0},
+    {'y',2,4901,0,0}, {'n',1,4903,0,0}, {';',0,0,836,4}, {'l',1,4904,0,0}, {'l',2,4905,0,0}, {'l',1,4907,0,0},
+    {';',0,0,840,3}, {';',0,0,843,3}, {';',0,0,197,2}, {'t',1,4908,0,0}, {'n',1,4909,0,0}, {'e',1,4910,0,0},
+    {';',0,0,846,4}, {'l',1,4911,0,0}, {'i',1,4912,0,0}, {';',0,0,850,3}, {';',0,0,853,2}, {'a',2,4913,0,0},
+    {'v',1,4915,0,0}, {'i',1,4916,0,0}, {'c',1,4917,0,0}, {';',0,0,855,2}, {';',0,0,857,4}, {'t',1,4918,0,0},
+    {';',0,0,861,4}, {'c',1,4919,0,0}, {'k',1,4920,0,0}, {'c',1,4921,0,0}, {'e',1,4922,0,0}, {';',0,0,865,3},
+    {'z',1,4923,0,0}, {';',0,0,868,3}, {'o',1,4924,0,0}, {'D',1,4925,0,0}, {'E',1,4926,0,0}, {';',0,0,871,2},
+    {'g',1,4927,0,0}, {';',0,0,873,2}, {'t',1,4928,0,0}, {'c',1,4929,875,2}, {';',0,0,877,2}, {'v',1,4930,0,0},
+    {'r',1,4931,0,0}, {'i',1,4932,0,0}, {'i',1,4933,0,0}, {'g',1,4934,0,0}, {'r',1,4935,0,0}, {'s',1,4936,0,0},
+    {'n',1,4937,0,0}, {';',0,0,879,4}, {';',0,0,883,2}, {';',0,0,885,3}, {'d',1,4938,0,0}, {'y',1,4939,0,0},
+    {';',0,0,220,2}, {'c',1,4940,0,0}, {';',0,0,888,4}, {';',0,0,892,4}, {'c',1,4941,0,0}, {'y',1,4942,0,0},
+    {';',0,0,896,2}, {';',0,0,898,2}, {'a',1,4943,0,0}, {'i',1,4944,0,0}, {';',0,0,900,4}, {';',0,0,904,4},
+    {';',0,0,908,2}, {'t',1,4945,0,0}, {'d',1,4946,0,0}, {';',0,0,910,3}, {'a',1,4947,0,0}, {';',0,0,913,3},
+    {'o',1,4948,0,0}, {'i',1,4949,0,0}, {'A',2,4950,0,0}, {'C',1,4952,0,0}, {'D',1,4953,0,0}, {'F',1,4954,0,0},
+    {'R',1,4955,0,0}, {'T',2,4956,0,0}, {'U',1,4958,0,0}, {'V',1,4959,0,0}, {'a',1,4960,0,0}, {'r',1,4961,0,0},
+    {'E',1,4962,0,0}, {'F',1,4963,0,0}, {'G',1,4964,0,0}, {'L',1,4965,0,0}, {'S',1,4966,0,0}, {'T',1,4967,0,0},
+    {'t',1,4968,0,0}, {'o',1,4969,0,0}, {'L',1,4970,0,0}, {'R',1,4971,0,0}, {'l',1,4972,0,0}, {'r',1,4973,0,0},
+    {';',0,0,916,4}, {'r',2,4974,0,0}, {';',0,0,920,3}, {'o',1,4976,0,0}, {'u',1,4977,0,0}, {'i',1,4978,0,0},
+    {'s',1,4979,0,0}, {';',0,0,923,4}, {';',0,0,927,3}, {';',0,0,930,2}, {'t',1,4980,0,0}, {'o',1,4981,0,0},
+    {'i',1,4982,0,0}, {'t',1,4983,0,0}, {'e',1,4984,0,0}, {'i',1,4985,0,0}, {'e',1,4986,0,0}, {'r',1,4987,0,0},
+    {';',0,0,932,3}, {'o',1,4988,0,0}, {'u',1,4989,0,0}, {'o',1,4990,0,0}, {'l',1,4991,0,0}, {'q',1,4992,0,0},
+    {'x',1,4993,0,0}, {'r',1,4994,0,0}, {'u',1,4995,0,0}, {'e',2,4996,0,0}, {'e',1,4998,0,0}, {'r',1,4999,0,0},
+    {'e',1,5000,0,0}, {'i',1,5001,0,0}, {'q',1,5002,0,0}, {'u',3,5003,0,0}, {'i',1,5006,0,0}, {'e',1,5007,0,0},
+    {';',0,0,935,4}, {'d',1,5008,0,0}, {'g',1,5009,0,0}, {'t',1,5010,0,0}, {'c',1,5011,939,2}, {'a',1,5012,0,0},
+    {'v',1,5013,0,0}, {'r',1,5014,0,0}, {'a',1,5015,0,0}, {'r',1,5016,0,0}, {';',0,0,941,4}, {'C',1,5017,0,0},
+    {';',0,0,945,4}, {'s',1,5018,0,0}, {'d',1,5019,0,0}, {'e',1,5020,0,0}, {';',0,0,267,2}, {'B',2,5021,0,0},
+    {'P',1,5023,0,0}, {'i',1,5024,0,0}, {'M',1,5025,0,0}, {'c',1,5026,0,0}, {';',0,0,949,3}, {'e',1,5027,0,0},
+    {'e',1,5028,0,0}, {'u',1,5029,0,0}, {'o',1,5030,0,0}, {';',0,0,952,4}, {';',0,0,279,1}, {';',0,0,956,3},
+    {';',0,0,959,4}, {'r',1,5031,0,0}, {'t',1,5032,0,0}, {';',0,0,963,3}, {';',0,0,966,3}, {'t',1,5033,0,0},
+    {'o',1,5034,0,0}, {'i',1,5035,0,0}, {'r',1,5036,0,0}, {'t',8,5037,0,0}, {';',0,0,969,3}, {'d',1,5045,0,0},
+    {'h',1,5046,0,0}, {';',0,0,972,3}, {'D',1,5047,0,0}, {'c',1,5048,0,0}, {';',0,0,975,2}, {'c',1,5049,0,0},
+    {'t',1,5050,0,0}, {'o',1,5051,0,0}, {'i',1,5052,0,0}, {'c',1,5053,0,0}, {'t',4,5054,0,0}, {'a',1,5058,0,0},
+    {'l',1,5059,0,0}, {';',0,0,977,4}, {';',0,0,981,3}, {'r',1,5060,0,0}, {';',0,0,984,4}, {';',0,0,988,3},
+    {'e',1,5061,0,0}, {'e',1,5062,0,0}, {'T',1,5063,0,0}, {'r',1,5064,0,0}, {'e',1,5065,0,0}, {'N',1,5066,991,2},
+    {'E',1,5067,0,0}, {'y',1,5068,0,0}, {';',0,0,993,2}, {'o',1,5069,0,0}, {'i',1,5070,0,0}, {'e',1,5071,0,0},
+    {'a',1,5072,0,0}, {'k',1,5073,0,0}, {'S',1,5074,0,0}, {'e',4,5075,0,0}, {';',0,0,995,4}, {'l',1,5079,0,0},
+    {';',0,0,999,4}, {'o',1,5080,0,0}, {'t',1,5081,0,0}, {';',0,0,1003,3}, {'o',1,5082,0,0}, {'y',1,5083,0,0},
+    {'v',1,5084,0,0}, {'c',1,5085,1006,2}, {'a',1,5086,0,0}, {'v',1,5087,0,0}, {'r',1,5088,0,0}, {'r',2,5089,0,0},
+    {'n',2,5091,0,0}, {'n',1,5093,0,0}, {';',0,0,1008,4}, {'r',1,5094,0,0}, {'w',1,5095,0,0}, {'u',1,5096,0,0},
+    {'e',2,5097,0,0}, {'r',1,5099,0,0}, {'w',1,5100,0,0}, {'r',2,5101,0,0}, {';',0,0,1012,2}, {'l',1,5103,0,0},
+    {'g',1,5104,0,0}, {';',0,0,1014,4}, {'d',1,5105,0,0}, {';',0,0,321,2}, {'h',1,5106,0,0}, {';',0,0,1018,3},
+    {'h',2,5107,0,0}, {'a',1,5109,0,0}, {';',0,0,1021,3}, {'i',1,5110,0,0}, {'T',1,5111,0,0}, {';',0,0,1024,4},
+    {';',0,0,1028,4}, {'s',1,5112,0,0}, {'c',1,5113,0,0}, {'e',1,5114,0,0}, {';',0,0,1032,4}, {';',0,0,1036,4},
+    {';',0,0,1040,4}, {';',0,0,1044,4}, {';',0,0,1048,2}, {';',0,0,1050,2}, {';',0,0,1052,2}, {'t',1,5115,0,0},
+    {'c',1,5116,0,0}, {';',0,0,1054,4}, {';',0,0,1058,4}, {';',0,0,1062,2}, {';',0,0,1064,2}, {'t',1,5117,0,0},
+    {'o',1,5118,0,0}, {';',0,0,1066,2}, {'W',1,5119,0,0}, {';',0,0,1068,2}, {';',0,0,1070,3}, {';',0,0,1073,4},
+    {'t',1,5120,0,0}, {'v',1,5121,0,0}, {'c',1,5122,1077,2}, {'e',1,5123,1079,2}, {'g',1,5124,1081,2}, {'v',1,5125,0,0},
+    {'s',1,5126,0,0}, {'h',1,5127,0,0}, {'a',1,5128,0,0}, {'r',1,5129,0,0}, {'g',1,5130,0,0}, {'n',1,5131,0,0},
+    {';',0,0,1083,3}, {'l',1,5132,0,0}, {';',0,0,1086,3}, {';',0,0,1089,3}, {'e',1,5133,0,0}, {'s',1,5134,0,0},
+    {'t',2,5135,0,0}, {'p',1,5137,0,0}, {'t',1,5138,0,0}, {'a',1,5139,0,0}, {'n',1,5140,0,0}, {';',0,0,1092,4},
+    {'i',1,5141,0,0}, {';',0,0,1096,3}, {';',0,0,1099,1}, {'o',1,5142,0,0}, {'g',1,5143,1100,2}, {';',0,0,1102,4},
+    {'p',2,5144,0,0}, {'d',1,5146,0,0}, {';',0,0,378,2}, {'n',1,5147,0,0}, {'t',1,5148,0,0}, {';',0,0,1106,3},
+    {'c',1,5149,0,0}, {'e',1,5150,0,0}, {'p',1,5151,0,0}, {'s',1,5152,0,0}, {'e',1,5153,0,0}, {'e',1,5154,0,0},
+    {';',0,0,1109,3}, {'t',1,5155,0,0}, {'g',1,5156,0,0}, {'o',1,5157,0,0}, {'u',1,5158,0,0}, {'t',1,5159,0,0},
+    {'i',1,5160,0,0}, {'o',1,5161,0,0}, {';',0,0,1112,2}, {';',0,0,1114,3}, {'e',1,5162,0,0}, {'a',1,5163,0,0},
+    {'i',1,5164,0,0}, {'u',1,5165,0,0}, {'d',1,5166,0,0}, {'p',1,5167,0,0}, {'t',1,5168,0,0}, {'q',1,5169,0,0},
+    {'t',1,5170,0,0}, {'r',1,5171,0,0}, {'p',1,5172,0,0}, {'e',1,5173,0,0}, {'e',1,5174,0,0}, {'o',1,5175,0,0},
+    {'k',3,5176,0,0}, {'k',1,5179,0,0}, {'2',1,5180,0,0}, {'4',1,5181,0,0}, {'4',1,5182,0,0}, {'k',1,5183,0,0},
+    {'u',1,5184,0,0}, {';',0,0,1117,3}, {';',0,0,1120,4}, {'o',1,5185,0,0}, {'i',1,5186,0,0}, {'L',1,5187,0,0},
+    {'R',1,5188,0,0}, {'l',1,5189,0,0}, {'r',1,5190,0,0}, {';',0,0,1124,3}, {'D',1,5191,0,0}, {'U',1,5192,0,0},
+    {'d',1,5193,0,0}, {'u',1,5194,0,0}, {'L',1,5195,0,0}, {'R',1,5196,0,0}, {'l',1,5197,0,0}, {'r',1,5198,0,0},
+    {';',0,0,1127,3}, {'H',1,5199,0,0}, {'L',1,5200,0,0}, {'R',1,5201,0,0}, {'h',1,5202,0,0}, {'l',1,5203,0,0},
+    {'r',1,5204,0,0}, {'o',1,5205,0,0}, {'L',1,5206,0,0}, {'R',1,5207,0,0}, {'l',1,5208,0,0}, {'r',1,5209,0,0},
+    {';',0,0,1130,3}, {'D',1,5210,0,0}, {'U',1,5211,0,0}, {'d',1,5212,0,0}, {'u',1,5213,0,0}, {'i',1,5214,0,0},
+    {'l',1,5215,0,0}, {'i',1,5216,0,0}, {'L',1,5217,0,0}, {'R',1,5218,0,0}, {'l',1,5219,0,0}, {'r',1,5220,0,0},
+    {';',0,0,1133,3}, {'H',1,5221,0,0}, {'L',1,5222,0,0}, {'R',1,5223,0,0}, {'h',1,5224,0,0}, {'l',1,5225,0,0},
+    {'r',1,5226,0,0}, {'m',1,5227,0,0}, {'e',1,5228,0,0}, {'a',1,5229,0,0}, {';',0,0,1136,4}, {'i',1,5230,0,0},
+    {';',0,0,1140,3}, {'e',1,5231,0,0}, {';',0,0,1143,1}, {'b',1,5232,0,0}, {'h',1,5233,0,0}, {';',0,0,1144,3},
+    {'e',1,5234,0,0}, {';',0,0,1147,3}, {'E',1,5235,0,0}, {'e',2,5236,0,0}, {'t',1,5238,0,0}, {'n',1,5239,0,0},
+    {'r',1,5240,0,0}, {'a',1,5241,0,0}, {'u',1,5242,0,0}, {'o',1,5243,0,0}, {';',0,0,1150,6}, {'t',1,5244,0,0},
+    {'n',1,5245,0,0}, {'s',1,5246,0,0}, {'o',1,5247,0,0}, {'i',1,5248,0,0}, {'c',1,5249,0,0}, {'s',2,5250,0,0},
+    {';',0,0,1156,2}, {'l',1,5252,1158,2}, {'t',1,5253,0,0}, {';',0,0,396,2}, {'e',1,5254,0,0}, {';',0,0,1160,2},
+    {'k',2,5255,0,0}, {';',0,0,1162,3}, {';',0,0,1165,2}, {'e',1,5257,0,0}, {'l',1,5258,0,0}, {';',0,0,1167,3},
+    {'n',1,5259,0,0}, {'i',1,5260,0,0}, {'c',1,5261,0,0}, {'s',2,5262,0,0}, {'n',2,5264,0,0}, {'a',2,5266,0,0},
+    {';',0,0,1170,3}, {'f',1,5268,0,0}, {'l',1,5269,0,0}, {';',0,0,1173,3}, {'d',1,5270,0,0}, {'n',1,5271,0,0},
+    {';',0,0,1176,4}, {'o',1,5272,0,0}, {';',0,0,165,2}, {'s',1,5273,0,0}, {'r',1,5274,0,0}, {'s',1,5275,0,0},
+    {';',0,0,1180,4}, {';',0,0,1184,3}, {'e',1,5276,0,0}, {';',0,0,1187,3}, {'e',1,5277,0,0}, {'t',1,5278,0,0},
+    {'r',1,5279,0,0}, {'r',1,5280,0,0}, {'c',1,5281,0,0}, {'r',1,5282,0,0}, {'r',1,5283,0,0}, {'a',1,5284,0,0},
+    {'u',1,5285,0,0}, {'o',1,5286,0,0}, {'r',1,5287,0,0}, {';',0,0,1190,6}, {'r',1,5288,0,0}, {'y',3,5289,0,0},
+    {'e',1,5292,0,0}, {'e',1,5293,0,0}, {'e',1,5294,0,0}, {'d',1,5295,0,0}, {'n',1,5296,0,0}, {'t',1,5297,0,0},
+    {'t',1,5298,0,0}, {';',0,0,1196,3}, {';',0,0,1199,3}, {'e',1,5299,0,0}, {'t',1,5300,0,0}, {';',0,0,1202,3},
+    {';',0,0,1205,3}, {'v',1,5301,0,0}, {'r',1,5302,0,0}, {'c',1,5303,0,0}, {'o',1,5304,0,0}, {'g',1,5305,0,0},
+    {'r',1,5306,0,0}, {'s',1,5307,0,0}, {'a',1,5308,0,0}, {'t',1,5309,0,0}, {'h',1,5310,0,0}, {'l',1,5311,0,0},
+    {'r',1,5312,0,0}, {';',0,0,1208,3}, {'o',1,5313,0,0}, {'s',1,5314,0,0}, {'m',1,5315,0,0}, {'n',1,5316,0,0},
+    {'d',1,5317,0,0}, {'n',1,5318,0,0}, {';',0,0,1211,2}, {'r',1,5319,0,0}, {'o',1,5320,0,0}, {'a',1,5321,0,0},
+    {';',0,0,1213,4}, {'q',2,5322,0,0}, {'i',1,5324,0,0}, {'l',1,5325,0,0}, {'q',1,5326,0,0}, {'l',1,5327,0,0},
+    {'a',1,5328,0,0}, {'d',1,5329,0,0}, {'h',1,5330,0,0}, {'a',1,5331,0,0}, {'r',1,5332,0,0}, {'o',1,5333,0,0},
+    {';',0,0,1217,4}, {';',0,0,1221,2}, {';',0,0,1223,3}, {'o',1,5334,0,0}, {'t',1,5335,0,0}, {';',0,0,1226,3},
+    {'f',1,5336,0,0}, {'r',1,5337,0,0}, {'r',1,5338,0,0}, {'g',1,5339,0,0}, {';',0,0,1229,2}, {'r',1,5340,0,0},
+    {'t',1,5341,0,0}, {';',0,0,1231,3}, {'t',1,5342,0,0}, {'e',1,5343,0,0}, {'o',1,5344,0,0}, {';',0,0,1234,3},
+    {'c',1,5345,1237,2}, {'o',1,5346,0,0}, {';',0,0,1239,2}, {'t',1,5347,0,0}, {'v',1,5348,0,0}, {'o',1,5349,0,0},
+    {'t',1,5350,0,0}, {'o',1,5351,0,0}, {'r',1,5352,0,0}, {'y',3,5353,0,0}, {'1',2,5356,0,0}, {';',0,0,1241,3},
+    {';',0,0,1244,3}, {'n',1,5358,0,0}, {';',0,0,1247,4}, {';',0,0,1251,3}, {'s',1,5359,0,0}, {'s',1,5360,0,0},
+    {';',0,0,1254,2}, {'l',1,5361,0,0}, {'v',1,5362,0,0}, {'r',1,5363,0,0}, {'l',1,5364,0,0}, {'m',1,5365,0,0},
+    {'a',1,5366,0,0}, {'l',1,5367,0,0}, {'s',1,5368,0,0}, {'v',2,5369,0,0}, {'a',1,5371,0,0}, {'t',1,5372,0,0},
+    {'r',1,5373,0,0}, {';',0,0,1256,3}, {'t',1,5374,0,0}, {';',0,0,1259,3}, {';',0,0,439,2}, {';',0,0,1262,3},
+    {';',0,0,1265,1}, {'t',1,5375,0,0}, {'c',1,5376,0,0}, {'n',1,5377,0,0}, {'i',1,5378,0,0}, {'l',1,5379,0,0},
+    {'i',1,5380,0,0}, {'g',1,5381,0,0}, {'i',1,5382,0,0}, {'g',1,5383,0,0}, {'g',1,5384,0,0}, {';',0,0,1266,3},
+    {'g',1,5385,0,0}, {'s',1,5386,0,0}, {';',0,0,1269,2}, {';',0,0,1271,4}, {'l',1,5387,0,0}, {';',0,0,1275,3},
+    {'v',1,5388,0,0}, {'t',1,5389,0,0}, {'1',6,5390,0,0}, {'2',2,5396,0,0}, {'3',3,5398,0,0}, {'4',1,5401,0,0},
+    {'5',2,5402,0,0}, {'7',1,5404,0,0}, {'l',1,5405,0,0}, {'n',1,5406,0,0}, {';',0,0,1278,4}, {'t',1,5407,0,0},
+    {'a',2,5408,0,0}, {'v',1,5410,0,0}, {'c',1,5411,0,0}, {';',0,0,1282,2}, {';',0,0,70,3}, {'l',1,5412,0,0},
+    {'c',1,5413,0,0}, {'o',1,5414,0,0}, {';',0,0,1284,6}, {'e',1,5415,0,0}, {'l',1,5416,0,0}, {';',0,0,1290,2},
+    {';',0,0,1292,3}, {'p',1,5417,0,0}, {';',0,0,477,3}, {'q',1,5418,0,0}, {'m',1,5419,0,0}, {';',0,0,1295,4},
+    {'e',1,5420,0,0}, {';',0,0,1299,3}, {';',0,0,1302,3}, {'e',1,5421,0,0}, {'l',1,5422,0,0}, {';',0,0,1305,3},
+    {'r',1,5423,0,0}, {'t',1,5424,0,0}, {'a',1,5425,0,0}, {'e',1,5426,0,0}, {'p',1,5427,0,0}, {'r',1,5428,0,0},
+    {'o',1,5429,0,0}, {'q',2,5430,0,0}, {'e',1,5432,0,0}, {'i',1,5433,0,0}, {'t',1,5434,0,0}, {';',0,0,1308,6},
+    {';',0,0,486,3}, {'s',1,5435,0,0}, {';',0,0,1314,2}, {'l',1,5436,0,0}, {'c',1,5437,0,0}, {';',0,0,1316,3},
+    {'c',1,5438,0,0}, {'w',1,5439,0,0}, {';',0,0,1319,3}, {'c',1,5440,0,0}, {'t',1,5441,0,0}, {'i',1,5442,0,0},
+    {'o',1,5443,0,0}, {'a',1,5444,0,0}, {'a',1,5445,0,0}, {'r',1,5446,0,0}, {'h',1,5447,0,0}, {'l',1,5448,0,0},
+    {'r',1,5449,0,0}, {';',0,0,1322,4}, {'a',1,5450,0,0}, {';',0,0,1326,4}, {'s',1,5451,0,0}, {'o',1,5452,0,0},
+    {'l',1,5453,0,0}, {'e',1,5454,0,0}, {'t',1,5455,0,0}, {'c',1,5456,1330,2}, {';',0,0,1332,2}, {'l',1,5457,1334,2},
+    {'v',1,5458,0,0}, {'n',1,5459,0,0}, {'t',1,5460,0,0}, {'i',1,5461,0,0}, {'a',1,5462,0,0}, {'g',1,5463,0,0},
+    {'r',1,5464,0,0}, {'e',1,5465,0,0}, {'l',1,5466,0,0}, {'p',1,5467,0,0}, {'h',1,5468,0,0}, {';',0,0,1336,3},
+    {'d',1,5469,0,0}, {'r',1,5470,0,0}, {'n',2,5471,0,0}, {'o',1,5473,0,0}, {'a',1,5474,0,0}, {'g',1,5475,0,0},
+    {'r',1,5476,0,0}, {'a',1,5477,0,0}, {'r',1,5478,0,0}, {';',0,0,1339,2}, {'n',1,5479,0,0}, {';',0,0,1341,4},
+    {';',0,0,1345,2}, {'d',1,5480,0,0}, {'s',1,5481,0,0}, {';',0,0,1347,4}, {';',0,0,85,3}, {'E',1,5482,0,0},
+    {'d',1,5483,0,0}, {'s',2,5484,0,0}, {'v',1,5486,0,0}, {'d',1,5487,0,0}, {'y',1,5488,0,0}, {';',0,0,496,2},
+    {'c',1,5489,0,0}, {'h',1,5490,0,0}, {';',0,0,1351,4}, {';',0,0,1355,4}, {'c',1,5491,0,0}, {'y',1,5492,0,0},
+    {'a',2,5493,0,0}, {'i',1,5495,0,0}, {'e',1,5496,0,0}, {';',0,0,1359,2}, {';',0,0,1361,2}, {';',0,0,1363,4},
+    {';',0,0,1367,4}, {'r',1,5497,0,0}, {';',0,0,1371,3}, {'i',1,5498,0,0}, {'r',1,5499,0,0}, {';',0,0,1374,3},
+    {'t',1,5500,0,0}, {'p',1,5501,0,0}, {'a',1,5502,0,0}, {'d',1,5503,0,0}, {';',0,0,1377,3}, {'d',1,5504,0,0},
+    {'l',1,5505,0,0}, {'o',1,5506,1380,2}, {';',0,0,1382,3}, {'b',2,5507,0,0}, {'f',1,5509,0,0}, {'h',1,5510,0,0},
+    {'l',1,5511,0,0}, {'p',1,5512,0,0}, {'s',1,5513,0,0}, {'t',1,5514,0,0}, {'i',1,5515,0,0}, {';',0,0,1385,3},
+    {'s',1,5516,0,0}, {'r',1,5517,0,0}, {'k',1,5518,0,0}, {'c',2,5519,0,0}, {'e',1,5521,0,0}, {'s',1,5522,0,0},
+    {'o',1,5523,0,0}, {'i',1,5524,0,0}, {'l',1,5525,0,0}, {';',0,0,1388,1}, {';',0,0,1389,3}, {'o',2,5526,0,0},
+    {'h',1,5528,0,0}, {'s',1,5529,0,0}, {';',0,0,1392,3}, {'a',1,5530,0,0}, {'h',1,5531,0,0}, {'l',1,5532,0,0},
+    {'r',1,5533,0,0}, {'t',1,5534,0,0}, {';',0,0,91,3}, {'l',1,5535,0,0}, {'c',1,5536,0,0}, {'o',1,5537,0,0},
+    {';',0,0,1395,6}, {'e',1,5538,0,0}, {'a',1,5539,0,0}, {'d',1,5540,0,0}, {'e',1,5541,0,0}, {'g',1,5542,0,0},
+    {'s',1,5543,0,0}, {'h',1,5544,0,0}, {'o',1,5545,0,0}, {'d',1,5546,0,0}, {'u',2,5547,0,0}, {'k',1,5549,0,0},
+    {';',0,0,1401,2}, {'r',1,5550,0,0}, {'r',1,5551,0,0}, {'r',1,5552,0,0}, {'i',1,5553,0,0}, {'o',1,5554,0,0},
+    {'s',1,5555,0,0}, {';',0,0,1403,3}, {'p',1,5556,0,0}, {';',0,0,537,3}, {'q',1,5557,0,0}, {'m',1,5558,0,0},
+    {'g',1,5559,0,0}, {'r',1,5560,0,0}, {'k',1,5561,0,0}, {'l',1,5562,0,0}, {'m',1,5563,0,0}, {'r',1,5564,0,0},
+    {'a',1,5565,0,0}, {'r',1,5566,0,0}, {';',0,0,1406,4}, {'u',1,5567,0,0}, {'m',1,5568,0,0}, {'s',1,5569,0,0},
+    {'a',1,5570,0,0}, {'n',1,5571,0,0}, {';',0,0,1410,3}, {';',0,0,1413,1}, {'l',1,5572,0,0}, {'r',1,5573,0,0},
+    {'r',1,5574,0,0}, {'r',2,5575,0,0}, {'i',1,5577,0,0}, {'u',1,5578,0,0}, {';',0,0,1414,4}, {';',0,0,1418,3},
+    {'e',1,5579,0,0}, {'g',1,5580,0,0}, {';',0,0,1421,1}, {'o',2,5581,0,0}, {'o',1,5583,0,0}, {';',0,0,1422,3},
+    {'r',1,5584,0,0}, {'t',1,5585,0,0}, {'e',1,5586,0,0}, {'e',1,5587,0,0}, {'r',1,5588,0,0}, {'e',1,5589,0,0},
+    {'a',1,5590,0,0}, {';',0,0,1425,3}, {'e',1,5591,0,0}, {'f',1,5592,0,0}, {'s',1,5593,0,0}, {'h',1,5594,0,0},
+    {'t',1,5595,0,0}, {';',0,0,1428,6}, {'t',1,5596,0,0}, {';',0,0,546,2}, {';',0,0,1434,3}, {';',0,0,1437,3},
+    {'e',1,5597,0,0}, {'t',1,5598,0,0}, {'e',1,5599,0,0}, {'m',1,5600,0,0}, {'h',1,5601,0,0}, {'u',1,5602,0,0},
+    {'o',1,5603,1440,2}, {'s',1,5604,0,0}, {'i',1,5605,0,0}, {'o',1,5606,0,0}, {'s',3,5607,0,0}, {';',0,0,1442,3},
+    {';',0,0,1445,3}, {'u',1,5610,0,0}, {'l',1,5611,0,0}, {';',0,0,1448,4}, {';',0,0,1452,4}, {'o',1,5612,0,0},
+    {'i',1,5613,0,0}, {'p',1,5614,0,0}, {';',0,0,1456,5}, {'t',2,5615,0,0}, {';',0,0,1461,5}, {'h',1,5617,0,0},
+    {'s',1,5618,0,0}, {'s',1,5619,0,0}, {'a',1,5620,0,0}, {'t',1,5621,0,0}, {';',0,0,1466,6}, {';',0,0,1472,5},
+    {'d',1,5622,0,0}, {'s',1,5623,0,0}, {'r',1,5624,0,0}, {'r',2,5625,0,0}, {';',0,0,588,2}, {'p',2,5627,0,0},
+    {';',0,0,1477,3}, {'o',1,5629,0,0}, {'i',1,5630,0,0}, {'g',2,5631,0,0}, {';',0,0,1480,3}, {'h',1,5633,0,0},
+    {'r',1,5634,0,0}, {'h',1,5635,0,0}, {'r',2,5636,0,0}, {'t',1,5638,0,0}, {'i',1,5639,0,0}, {'a',1,5640,0,0},
+    {'m',1,5641,0,0}, {'s',1,5642,0,0}, {';',0,0,601,3}, {'q',1,5643,0,0}, {'s',1,5644,0,0}, {';',0,0,1483,5},
+    {'m',1,5645,0,0}, {';',0,0,604,3}, {'r',1,5646,0,0}, {'r',1,5647,0,0}, {'r',1,5648,0,0}, {';',0,0,1488,3},
+    {';',0,0,1491,2}, {'r',1,5649,0,0}, {'r',1,5650,0,0}, {';',0,0,1493,3}, {'t',2,5651,0,0}, {';',0,0,615,3},
+    {'q',1,5653,0,0}, {'s',1,5654,0,0}, {';',0,0,1496,5}, {'s',1,5655,0,0}, {'m',1,5656,0,0}, {'i',2,5657,0,0},
+    {';',0,0,1501,3}, {';',0,0,1504,4}, {'n',4,5659,0,0}, {'i',2,5663,0,0}, {';',0,0,1508,3}, {'a',1,5665,0,0},
+    {'s',1,5666,0,0}, {'t',1,5667,0,0}, {'i',1,5668,0,0}, {'u',1,5669,0,0}, {';',0,0,1511,5}, {'c',2,5670,0,0},
+    {'r',1,5672,0,0}, {'r',3,5673,0,0}, {'h',1,5676,0,0}, {'i',2,5677,0,0}, {'u',1,5679,0,0}, {';',0,0,1516,5},
+    {';',0,0,1521,4}, {'r',1,5680,0,0}, {';',0,0,1525,3}, {'e',2,5681,0,0}, {'d',1,5683,0,0}, {'r',1,5684,0,0},
+    {'u',2,5685,0,0}, {';',0,0,1528,3}, {'E',1,5687,0,0}, {'e',1,5688,0,0}, {'s',1,5689,0,0}, {'c',2,5690,0,0},
+    {';',0,0,1531,3}, {'E',1,5692,0,0}, {'e',1,5693,0,0}, {'s',1,5694,0,0}, {';',0,0,1534,3}, {'d',1,5695,0,0},
+    {';',0,0,1537,3}, {'a',1,5696,0,0}, {'r',1,5697,0,0}, {'p',1,5698,0,0}, {'s',1,5699,0,0}, {'r',1,5700,0,0},
+    {';',0,0,1540,6}, {'s',1,5701,0,0}, {';',0,0,1546,6}, {';',0,0,1552,4}, {'f',1,5702,0,0}, {'r',1,5703,0,0},
+    {';',0,0,1556,6}, {';',0,0,1562,4}, {'r',1,5704,0,0}, {'r',1,5705,0,0}, {'r',1,5706,0,0}, {'m',1,5707,0,0},
+    {'r',1,5708,0,0}, {'h',1,5709,0,0}, {'r',2,5710,0,0}, {'a',1,5712,0,0}, {'t',1,5713,0,0}, {';',0,0,1566,3},
+    {';',0,0,1569,3}, {'c',1,5714,1572,2}, {'h',1,5715,0,0}, {'a',1,5716,0,0}, {';',0,0,1574,3}, {';',0,0,1577,3},
+    {'l',1,5717,0,0}, {'g',1,5718,0,0}, {'r',1,5719,0,0}, {';',0,0,1580,2}, {'v',1,5720,0,0}, {'r',1,5721,0,0},
+    {';',0,0,1582,3}, {'r',1,5722,0,0}, {'r',1,5723,0,0}, {'o',1,5724,0,0}, {'e',1,5725,0,0}, {'r',1,5726,0,0},
+    {'a',1,5727,0,0}, {'r',1,5728,0,0}, {';',0,0,1585,3}, {'u',1,5729,0,0}, {';',0,0,1588,4}, {';',0,0,1592,3},
+    {'p',1,5730,0,0}, {'s',1,5731,0,0}, {'r',1,5732,0,0}, {'r',2,5733,0,0}, {';',0,0,645,2}, {';',0,0,647,2},
+    {'o',1,5735,0,0}, {';',0,0,1595,3}, {'o',1,5736,0,0}, {';',0,0,1598,3}, {'s',1,5737,0,0}, {';',0,0,1601,3},
+    {'d',1,5738,0,0}, {'e',1,5739,0,0}, {';',0,0,652,2}, {'r',1,5740,0,0}, {';',0,0,657,2}, {'l',1,5741,0,0},
+    {'i',1,5742,0,0}, {'l',1,5743,0,0}, {';',0,0,1604,3}, {'n',1,5744,0,0}, {'o',1,5745,0,0}, {'i',1,5746,0,0},
+    {';',0,0,390,3}, {'e',1,5747,0,0}, {';',0,0,1607,2}, {'a',1,5748,0,0}, {'e',1,5749,0,0}, {'h',1,5750,0,0},
+    {'c',1,5751,0,0}, {'k',1,5752,0,0}, {';',0,0,1609,1}, {'a',1,5753,0,0}, {'b',1,5754,0,0}, {'c',1,5755,0,0},
+    {'d',2,5756,0,0}, {'e',1,5758,0,0}, {'m',1,5759,0,0}, {'s',1,5760,0,0}, {'t',1,5761,0,0}, {'t',1,5762,0,0},
+    {';',0,0,1610,4}, {'d',1,5763,1614,2}, {';',0,0,1616,3}, {'e',1,5764,0,0}, {';',0,0,125,3}, {'a',1,5765,0,0},
+    {'c',1,5766,0,0}, {'e',1,5767,0,0}, {'n',3,5768,0,0}, {'s',1,5771,0,0}, {'e',2,5772,0,0}, {';',0,0,1619,3},
+    {'p',1,5774,0,0}, {'i',1,5775,0,0}, {';',0,0,1622,3}, {'a',1,5776,0,0}, {'l',1,5777,0,0}, {'s',1,5778,0,0},
+    {';',0,0,1625,3}, {'t',1,5779,0,0}, {'m',1,5780,0,0}, {'e',1,5781,0,0}, {';',0,0,1628,4}, {'s',1,5782,0,0},
+    {';',0,0,1632,3}, {';',0,0,1635,4}, {'m',1,5783,0,0}, {';',0,0,1639,4}, {'e',1,5784,0,0}, {'i',1,5785,0,0},
+    {'t',2,5786,0,0}, {';',0,0,279,1}, {'r',1,5788,0,0}, {';',0,0,1643,3}, {'i',1,5789,0,0}, {'r',1,5790,0,0},
+    {';',0,0,1646,3}, {';',0,0,1649,5}, {'t',1,5791,0,0}, {'c',1,5792,0,0}, {'p',1,5793,0,0}, {';',0,0,1654,3},
+    {'d',1,5794,0,0}, {'e',1,5795,0,0}, {'l',1,5796,0,0}, {'o',1,5797,1657,2}, {';',0,0,1659,3}, {'a',1,5798,0,0},
+    {'b',2,5799,0,0}, {'c',1,5801,0,0}, {'f',1,5802,0,0}, {'h',1,5803,0,0}, {'l',1,5804,0,0}, {'p',1,5805,0,0},
+    {'s',1,5806,0,0}, {'t',1,5807,0,0}, {'w',1,5808,0,0}, {'i',1,5809,0,0}, {'o',2,5810,0,0}, {'r',1,5812,0,0},
+    {'k',1,5813,0,0}, {'c',2,5814,0,0}, {'e',1,5816,0,0}, {'s',1,5817,0,0}, {'o',1,5818,0,0}, {'i',1,5819,0,0},
+    {'l',1,5820,0,0}, {';',0,0,1662,1}, {';',0,0,1663,3}, {'h',1,5821,0,0}, {'o',2,5822,0,0}, {';',0,0,1666,3},
+    {';',0,0,37,3}, {'i',1,5824,0,0}, {'p',1,5825,0,0}, {'s',1,5826,0,0}, {';',0,0,1669,3}, {'h',1,5827,0,0},
+    {'o',1,5828,0,0}, {'d',1,5829,0,0}, {'u',2,5830,0,0}, {';',0,0,1672,2}, {'t',6,5832,0,0}, {';',0,0,1674,2},
+    {'n',1,5838,0,0}, {'r',1,5839,0,0}, {'r',1,5840,0,0}, {'s',1,5841,0,0}, {'d',1,5842,0,0}, {'g',1,5843,0,0},
+    {'r',1,5844,0,0}, {'k',1,5845,0,0}, {'r',1,5846,0,0}, {';',0,0,1676,4}, {'u',1,5847,0,0}, {'m',1,5848,0,0},
+    {';',0,0,1680,1}, {'g',1,5849,0,0}, {'l',1,5850,0,0}, {'r',1,5851,0,0}, {'u',1,5852,0,0}, {';',0,0,1681,4},
+    {';',0,0,1685,1}, {'o',2,5853,0,0}, {'e',1,5855,0,0}, {'e',1,5856,0,0}, {';',0,0,1686,3}, {'e',1,5857,0,0},
+    {'f',1,5858,0,0}, {'l',1,5859,0,0}, {'h',1,5860,0,0}, {'t',1,5861,0,0}, {'o',1,5862,0,0}, {';',0,0,1689,3},
+    {'o',1,5863,0,0}, {'e',1,5864,0,0}, {'i',1,5865,0,0}, {'c',1,5866,0,0}, {';',0,0,1692,3}, {'p',1,5867,0,0},
+    {'i',1,5868,0,0}, {'l',1,5869,0,0}, {'m',1,5870,0,0}, {';',0,0,1695,3}, {'b',1,5871,0,0}, {'e',1,5872,0,0},
+    {'r',1,5873,0,0}, {'h',1,5874,0,0}, {'r',2,5875,0,0}, {';',0,0,700,2}, {';',0,0,1698,1}, {'a',1,5877,0,0},
+    {'i',1,5878,0,0}, {'n',1,5879,0,0}, {';',0,0,1699,3}, {'w',1,5880,0,0}, {'p',1,5881,0,0}, {'c',1,5882,0,0},
+    {';',0,0,1702,2}, {'t',2,5883,0,0}, {'a',3,5885,0,0}, {'o',1,5888,0,0}, {';',0,0,1704,3}, {'q',1,5889,0,0},
+    {';',0,0,1707,3}, {'E',1,5890,0,0}, {';',0,0,1710,3}, {'E',1,5891,0,0}, {'e',1,5892,0,0}, {'l',1,5893,0,0},
+    {'a',1,5894,0,0}, {'r',1,5895,0,0}, {'l',1,5896,0,0}, {'h',1,5897,0,0}, {'a',1,5898,0,0}, {';',0,0,560,3},
+    {'e',1,5899,0,0}, {';',0,0,1713,3}, {'s',1,5900,0,0}, {'c',1,5901,0,0}, {';',0,0,1716,3}, {'a',1,5902,0,0},
+    {';',0,0,1719,4}, {'e',1,5903,0,0}, {';',0,0,654,3}, {'p',2,5904,0,0}, {'p',2,5906,0,0}, {'b',3,5908,0,0},
+    {'p',3,5911,0,0}, {'r',2,5914,0,0}, {';',0,0,1723,3}, {'r',1,5916,0,0}, {';',0,0,1726,4}, {'m',1,5917,0,0},
+    {'l',1,5918,0,0}, {'r',1,5919,0,0}, {';',0,0,1730,3}, {'f',1,5920,0,0}, {'i',1,5921,0,0}, {'s',1,5922,0,0},
+    {';',0,0,1733,3}, {'o',1,5923,0,0}, {';',0,0,1736,3}, {'d',1,5924,0,0}, {'u',1,5925,0,0}, {'E',1,5926,0,0},
+    {'e',1,5927,0,0}, {'l',1,5928,0,0}, {'a',1,5929,0,0}, {'e',1,5930,0,0}, {'i',1,5931,0,0}, {'u',2,5932,0,0},
+    {';',0,0,131,3}, {'a',1,5934,0,0}, {'c',1,5935,0,0}, {'e',1,5936,0,0}, {'n',3,5937,0,0}, {'s',1,5940,0,0},
+    {';',0,0,1739,3}, {';',0,0,719,2}, {';',0,0,721,2}, {';',0,0,723,2}, {';',0,0,1742,3}, {'o',1,5941,0,0},
+    {'s',1,5942,0,0}, {';',0,0,1745,3}, {'d',1,5943,0,0}, {'s',2,5944,0,0}, {'a',1,5946,0,0}, {'u',1,5947,0,0},
+    {'E',1,5948,0,0}, {'e',1,5949,0,0}, {'l',1,5950,0,0}, {'e',1,5951,0,0}, {'i',1,5952,0,0}, {'u',2,5953,0,0},
+    {'r',1,5955,0,0}, {'h',1,5956,0,0}, {'r',2,5957,0,0}, {'a',1,5959,0,0}, {'g',1,5960,1748,2}, {'e',1,5961,0,0},
+    {';',0,0,1750,3}, {'o',1,5962,0,0}, {'i',1,5963,0,0}, {';',0,0,1753,3}, {'e',1,5964,0,0}, {'e',2,5965,0,0},
+    {'a',3,5967,0,0}, {'k',2,5970,0,0}, {'s',1,5972,0,0}, {'p',1,5973,0,0}, {'i',1,5974,0,0}, {'n',1,5975,1756,2},
+    {'e',1,5976,0,0}, {'s',3,5977,1758,2}, {';',0,0,1760,3}, {';',0,0,1763,3}, {'o',1,5980,0,0}, {'i',1,5981,0,0},
+    {';',0,0,1766,4}, {'o',1,5982,0,0}, {';',0,0,1770,3}, {'m',1,5983,0,0}, {'e',1,5984,0,0}, {'n',1,5985,0,0},
+    {'o',1,5986,0,0}, {';',0,0,1773,3}, {'i',1,5987,0,0}, {'l',1,5988,0,0}, {'b',1,5989,0,0}, {'i',1,5990,0,0},
+    {'z',1,5991,0,0}, {';',0,0,1776,4}, {';',0,0,1780,2}, {'y',1,5992,0,0}, {'o',1,5993,0,0}, {'t',1,5994,0,0},
+    {'e',1,5995,0,0}, {';',0,0,1782,3}, {';',0,0,1785,3}, {'t',1,5996,0,0}, {';',0,0,1788,3}, {'y',1,5997,0,0},
+    {'v',1,5998,0,0}, {'c',1,5999,1791,2}, {'r',1,6000,0,0}, {'a',1,6001,0,0}, {'r',1,6002,0,0}, {'h',1,6003,0,0},
+    {'v',1,6004,0,0}, {'l',1,6005,0,0}, {'r',1,6006,0,0}, {'k',1,6007,0,0}, {'r',1,6008,0,0}, {'o',1,6009,0,0},
+    {'i',1,6010,0,0}, {'r',1,6011,0,0}, {'n',1,6012,0,0}, {';',0,0,1793,4}, {'r',1,6013,0,0}, {'w',1,6014,0,0},
+    {'r',1,6015,0,0}, {'s',1,6016,0,0}, {';',0,0,1797,2}, {'h',1,6017,0,0}, {'l',1,6018,0,0}, {'a',1,6019,0,0},
+    {'r',1,6020,0,0}, {'o',1,6021,0,0}, {'g',1,6022,0,0}, {'i',1,6023,0,0}, {';',0,0,1799,4}, {'t',1,6024,0,0},
+    {'d',1,6025,0,0}, {';',0,0,1803,3}, {'f',1,6026,0,0}, {'r',1,6027,0,0}, {';',0,0,745,2}, {'g',1,6028,0,0},
+    {';',0,0,1806,3}, {';',0,0,1809,3}, {'v',1,6029,0,0}, {'h',1,6030,0,0}, {'r',1,6031,0,0}, {'p',1,6032,0,0},
+    {'a',1,6033,0,0}, {'o',1,6034,0,0}, {'h',1,6035,0,0}, {'i',1,6036,0,0}, {'r',1,6037,0,0}, {';',0,0,1812,3},
+    {'h',1,6038,0,0}, {'i',1,6039,0,0}, {'u',2,6040,0,0}, {'h',1,6042,0,0}, {'r',1,6043,0,0}, {'h',1,6044,0,0},
+    {'a',1,6045,0,0}, {'q',1,6046,0,0}, {'i',1,6047,0,0}, {'a',1,6048,0,0}, {';',0,0,1815,1}, {'i',1,6049,0,0},
+    {'b',1,6050,0,0}, {'p',1,6051,0,0}, {';',0,0,1816,4}, {'p',1,6052,0,0}, {'i',1,6053,0,0}, {';',0,0,1820,4},
+    {'n',2,6054,0,0}, {'n',2,6056,0,0}, {'z',1,6058,0,0}, {'c',1,6059,0,0}, {'a',1,6060,0,0}, {'e',2,6061,0,0},
+    {'r',1,6063,0,0}, {';',0,0,1824,4}, {'t',1,6064,0,0}, {';',0,0,1828,4}, {';',0,0,1832,3}, {'c',1,6065,0,0},
+    {';',0,0,1835,3}, {'i',1,6066,0,0}, {'r',1,6067,0,0}, {'r',1,6068,0,0}, {'r',1,6069,0,0}, {'r',1,6070,0,0},
+    {';',0,0,1838,3}, {';',0,0,1841,3}, {'t',1,6071,0,0}, {';',0,0,1844,4}, {'u',1,6072,0,0}, {'m',1,6073,0,0},
+    {'r',1,6074,0,0}, {'r',1,6075,0,0}, {';',0,0,1848,4}, {'u',1,6076,0,0}, {'u',1,6077,0,0}, {'i',1,6078,0,0},
+    {';',0,0,325,3}, {'g',1,6079,0,0}, {'t',1,6080,0,0}, {';',0,0,1852,2}, {'c',1,6081,0,0}, {';',0,0,1854,2},
+    {';',0,0,1856,4}, {';',0,0,1860,4}, {';',0,0,1864,2}, {';',0,0,767,2}, {'t',1,6082,0,0}, {'o',1,6083,0,0},
+    {';',0,0,1866,2}, {'r',1,6084,0,0}, {';',0,0,1868,2}, {';',0,0,1870,2}, {'a',1,6085,0,0}, {';',0,0,1872,4},
+    {';',0,0,1876,4}, {';',0,0,1880,3}, {';',0,0,778,2}, {'e',1,6086,1883,2}, {'e',1,6087,0,0}, {';',0,0,780,2},
+    {'e',1,6088,1885,2}, {';',0,0,1887,2}, {';',0,0,1889,2}, {';',0,0,1891,2}, {'F',1,6089,0,0}, {';',0,0,786,2},
+    {'n',1,6090,0,0}, {'e',1,6091,1893,2}, {'l',1,6092,0,0}, {'d',1,6093,0,0}, {'s',1,6094,0,0}, {'u',1,6095,0,0},
+    {';',0,0,1895,2}, {'q',1,6096,0,0}, {'e',1,6097,0,0}, {'a',1,6098,0,0}, {'y',1,6099,0,0}, {'n',1,6100,0,0},
+    {'l',1,6101,1897,2}, {';',0,0,1899,2}, {'n',1,6102,0,0}, {'l',1,6103,0,0}, {'r',1,6104,0,0}, {'e',4,6105,0,0},
+    {'w',1,6109,0,0}, {'C',1,6110,0,0}, {';',0,0,1901,3}, {'e',1,6111,0,0}, {'u',1,6112,0,0}, {'t',1,6113,0,0},
+    {'u',1,6114,0,0}, {'d',1,6115,0,0}, {'e',1,6116,0,0}, {';',0,0,1904,3}, {'p',1,6117,0,0}, {'a',1,6118,0,0},
+    {'r',1,6119,0,0}, {';',0,0,1907,3}, {'n',1,6120,0,0}, {';',0,0,1910,2}, {'i',1,6121,0,0}, {'n',1,6122,0,0},
+    {'r',1,6123,0,0}, {'t',1,6124,0,0}, {'u',1,6125,0,0}, {'e',6,6126,0,0}, {'r',1,6132,0,0}, {'r',1,6133,0,0},
+    {'e',1,6134,0,0}, {'i',1,6135,0,0}, {'e',1,6136,0,0}, {'r',1,6137,0,0}, {'k',1,6138,0,0}, {'e',1,6139,1912,2},
+    {'n',1,6140,0,0}, {';',0,0,832,2}, {'e',1,6141,1914,2}, {'n',1,6142,0,0}, {';',0,0,1916,2}, {'S',1,6143,0,0},
+    {'V',1,6144,0,0}, {';',0,0,1918,2}, {'o',1,6145,0,0}, {';',0,0,1920,3}, {'T',1,6146,0,0}, {'i',1,6147,0,0},
+    {'s',1,6148,0,0}, {'e',1,6149,0,0}, {'d',2,6150,0,0}, {'l',1,6152,0,0}, {'e',1,6153,0,0}, {';',0,0,1923,2},
+    {'d',1,6154,0,0}, {'e',1,6155,0,0}, {'l',1,6156,0,0}, {';',0,0,1925,2}, {'e',1,6157,0,0}, {'y',1,6158,0,0},
+    {';',0,0,1927,2}, {';',0,0,1929,2}, {'r',1,6159,0,0}, {'o',1,6160,0,0}, {'k',1,6161,0,0}, {'o',1,6162,0,0},
+    {'q',1,6163,0,0}, {';',0,0,1931,2}, {'e',1,6164,1933,2}, {';',0,0,875,2}, {'e',1,6165,1935,2}, {';',0,0,1937,2},
+    {'n',1,6166,0,0}, {'e',1,6167,0,0}, {'r',1,6168,0,0}, {'s',1,6169,0,0}, {'i',1,6170,0,0}, {';',0,0,1939,2},
+    {'e',1,6171,0,0}, {';',0,0,1941,2}, {';',0,0,1943,2}, {'y',1,6172,0,0}, {';',0,0,1945,2}, {';',0,0,1947,2},
+    {'l',1,6173,0,0}, {'e',1,6174,0,0}, {'a',1,6175,0,0}, {'c',1,6176,0,0}, {'n',1,6177,0,0}, {'l',1,6178,0,0},
+    {'n',1,6179,0,0}, {'r',1,6180,0,0}, {'e',1,6181,0,0}, {'o',2,6182,0,0}, {'l',1,6184,0,0}, {'i',1,6185,0,0},
+    {'e',1,6186,0,0}, {'r',1,6187,0,0}, {'p',3,6188,0,0}, {'e',1,6191,0,0}, {'r',1,6192,0,0}, {'i',1,6193,0,0},
+    {'q',1,6194,0,0}, {'u',1,6195,0,0}, {'r',1,6196,0,0}, {'e',1,6197,0,0}, {'l',1,6198,0,0}, {'i',1,6199,0,0},
+    {'a',1,6200,0,0}, {'t',1,6201,0,0}, {'e',1,6202,0,0}, {'i',1,6203,0,0}, {'e',1,6204,0,0}, {'i',1,6205,0,0},
+    {'L',1,6206,0,0}, {'R',1,6207,0,0}, {'k',1,6208,0,0}, {'m',1,6209,0,0}, {'n',1,6210,0,0}, {'P',1,6211,0,0},
+    {'e',1,6212,0,0}, {'n',1,6213,0,0}, {'l',1,6214,0,0}, {'i',1,6215,0,0}, {'d',2,6216,0,0}, {'n',1,6218,0,0},
+    {'a',1,6219,0,0}, {'e',1,6220,0,0}, {'n',1,6221,0,0}, {'p',1,6222,0,0}, {'u',1,6223,0,0}, {'e',1,6224,0,0},
+    {'u',1,6225,0,0}, {'i',1,6226,0,0}, {'e',1,6227,0,0}, {'m',1,6228,0,0}, {'f',1,6229,0,0}, {'s',1,6230,0,0},
+    {'s',1,6231,0,0}, {'e',1,6232,0,0}, {'v',1,6233,0,0}, {'g',1,6234,0,0}, {'u',1,6235,0,0}, {'b',1,6236,0,0},
+    {'c',1,6237,0,0}, {'p',1,6238,0,0}, {'l',1,6239,0,0}, {'r',1,6240,0,0}, {'e',1,6241,1949,2}, {';',0,0,1951,2},
+    {'e',1,6242,1953,2}, {';',0,0,939,2}, {'c',1,6243,0,0}, {'e',1,6244,1955,2}, {';',0,0,1957,2}, {';',0,0,637,2},
+    {'o',1,6245,0,0}, {'u',1,6246,0,0}, {'h',1,6247,1959,2}, {'e',1,6248,1961,2}, {'s',1,6249,0,0}, {'a',1,6250,0,0},
+    {'r',1,6251,0,0}, {'a',1,6252,0,0}, {'a',1,6253,0,0}, {'i',1,6254,0,0}, {'a',1,6255,0,0}, {'d',1,6256,0,0},
+    {';',0,0,1963,3}, {'c',1,6257,0,0}, {'r',1,6258,0,0}, {';',0,0,1966,3}, {'e',1,6259,0,0}, {'l',1,6260,0,0},
+    {'n',1,6261,0,0}, {'l',1,6262,0,0}, {'s',1,6263,0,0}, {'A',2,6264,0,0}, {'C',1,6266,0,0}, {'D',1,6267,0,0},
+    {'F',1,6268,0,0}, {'T',2,6269,0,0}, {'U',1,6271,0,0}, {'V',1,6272,0,0}, {'a',1,6273,0,0}, {'I',1,6274,0,0},
+    {'t',1,6275,0,0}, {'e',1,6276,0,0}, {'y',1,6277,0,0}, {'y',1,6278,0,0}, {'e',1,6279,0,0}, {'n',1,6280,0,0},
+    {'l',1,6281,0,0}, {';',0,0,1969,2}, {'D',1,6282,0,0}, {'L',1,6283,0,0}, {'R',1,6284,0,0}, {'U',1,6285,0,0},
+    {';',0,0,1971,2}, {'C',1,6286,0,0}, {'e',4,6287,0,0}, {'t',2,6291,0,0}, {'e',1,6293,0,0}, {'h',1,6294,0,0},
+    {'s',1,6295,0,0}, {'t',1,6296,0,0}, {';',0,0,991,2}, {';',0,0,1973,3}, {';',0,0,1976,2}, {'n',1,6297,0,0},
+    {'l',1,6298,0,0}, {'f',1,6299,0,0}, {';',0,0,1978,2}, {'S',1,6300,0,0}, {'p',1,6301,0,0}, {';',0,0,706,3},
+    {'E',1,6302,0,0}, {'F',1,6303,0,0}, {'T',1,6304,0,0}, {'e',1,6305,0,0}, {'k',1,6306,0,0}, {'e',1,6307,1980,2},
+    {'c',1,6308,0,0}, {';',0,0,1982,2}, {'e',1,6309,0,0}, {';',0,0,1006,2}, {'c',1,6310,0,0}, {'e',1,6311,1984,2},
+    {';',0,0,1986,2}, {'B',2,6312,0,0}, {'P',1,6314,0,0}, {';',0,0,1835,3}, {'P',1,6315,0,0}, {';',0,0,1988,2},
+    {'o',1,6316,0,0}, {'n',1,6317,0,0}, {'i',1,6318,0,0}, {';',0,0,390,3}, {'A',1,6319,0,0}, {'o',1,6320,0,0},
+    {'n',1,6321,0,0}, {'L',1,6322,0,0}, {'R',1,6323,0,0}, {'o',1,6324,0,0}, {';',0,0,1990,2}, {'e',1,6325,0,0},
+    {';',0,0,1992,3}, {';',0,0,1995,3}, {'l',1,6326,0,0}, {'r',1,6327,0,0}, {'c',1,6328,0,0}, {'h',1,6329,0,0},
+    {'h',1,6330,0,0}, {';',0,0,1998,2}, {';',0,0,2000,3}, {'e',1,6331,2003,2}, {';',0,0,2005,2}, {'e',1,6332,0,0},
+    {'n',1,6333,0,0}, {'i',1,6334,0,0}, {'e',1,6335,2007,2}, {'e',1,6336,0,0}, {';',0,0,1077,2}, {';',0,0,1079,2},
+    {';',0,0,1081,2}, {'e',1,6337,2009,2}, {'y',1,6338,0,0}, {';',0,0,2011,3}, {';',0,0,2014,2}, {';',0,0,2016,2},
+    {';',0,0,2018,3}, {'d',1,6339,0,0}, {'o',1,6340,0,0}, {';',0,0,368,3}, {'d',2,6341,0,0}, {';',0,0,2021,3},
+    {'v',1,6343,0,0}, {'h',1,6344,0,0}, {';',0,0,786,2}, {'r',1,6345,0,0}, {';',0,0,2024,2}, {'r',1,6346,0,0},
+    {'x',2,6347,0,0}, {';',0,0,1100,2}, {';',0,0,51,3}, {'e',1,6349,0,0}, {'e',1,6350,2026,2}, {'i',1,6351,0,0},
+    {';',0,0,2028,3}, {'o',1,6352,0,0}, {'p',1,6353,0,0}, {'r',1,6354,0,0}, {'i',1,6355,0,0}, {'e',1,6356,0,0},
+    {'d',2,6357,0,0}, {'b',1,6359,0,0}, {';',0,0,2031,3}, {';',0,0,2034,3}, {'s',2,6360,0,0}, {'y',1,6362,0,0},
+    {';',0,0,2037,2}, {'u',1,6363,0,0}, {'e',1,6364,0,0}, {'p',1,6365,0,0}, {'r',1,6366,0,0}, {'p',1,6367,0,0},
+    {'o',1,6368,0,0}, {'l',1,6369,0,0}, {'i',1,6370,0,0}, {'c',1,6371,0,0}, {'a',1,6372,0,0}, {'i',1,6373,0,0},
+    {'l',1,6374,0,0}, {'e',1,6375,0,0}, {'d',1,6376,0,0}, {'w',1,6377,0,0}, {'l',1,6378,0,0}, {'s',1,6379,0,0},
+    {'t',1,6380,0,0}, {';',0,0,2039,3}, {';',0,0,2042,3}, {';',0,0,2045,3}, {';',0,0,2048,3}, {';',0,0,2051,3},
+    {'i',1,6381,0,0}, {'m',1,6382,0,0}, {'e',1,6383,0,0}, {';',0,0,2054,3}, {';',0,0,2057,3}, {';',0,0,2060,3},
+    {';',0,0,2063,3}, {';',0,0,2066,3}, {';',0,0,2069,3}, {';',0,0,2072,3}, {';',0,0,2075,3}, {';',0,0,2078,3},
+    {';',0,0,2081,3}, {';',0,0,2084,3}, {';',0,0,2087,3}, {';',0,0,2090,3}, {';',0,0,2093,3}, {';',0,0,2096,3},
+    {';',0,0,2099,3}, {';',0,0,2102,3}, {';',0,0,2105,3}, {'x',1,6384,0,0}, {';',0,0,2108,3}, {';',0,0,2111,3},
+    {';',0,0,2114,3}, {';',0,0,2117,3}, {';',0,0,2120,3}, {';',0,0,2123,3}, {';',0,0,2126,3}, {';',0,0,2129,3},
+    {'n',1,6385,0,0}, {'u',1,6386,0,0}, {'m',1,6387,0,0}, {';',0,0,2132,3}, {';',0,0,2135,3}, {';',0,0,2138,3},
+    {';',0,0,2141,3}, {';',0,0,2144,3}, {';',0,0,2147,3}, {';',0,0,2150,3}, {';',0,0,2153,3}, {';',0,0,2156,3},
+    {';',0,0,2159,3}, {'e',1,6388,0,0}, {';',0,0,1895,2}, {'r',1,6389,2162,2}, {';',0,0,2164,3}, {';',0,0,2167,3},
+    {';',0,0,2170,3}, {'s',1,6390,0,0}, {'t',1,6391,0,0}, {';',0,0,2173,3}, {';',0,0,2176,3}, {'q',1,6392,0,0},
+    {'e',1,6393,0,0}, {'d',1,6394,0,0}, {'c',1,6395,0,0}, {'p',1,6396,0,0}, {'p',1,6397,0,0}, {'t',1,6398,0,0},
+    {';',0,0,2179,3}, {';',0,0,1927,2}, {';',0,0,2182,3}, {'n',1,6399,0,0}, {'l',1,6400,2185,2}, {';',0,0,2187,2},
+    {';',0,0,2189,3}, {'s',1,6401,0,0}, {';',0,0,1158,2}, {'y',1,6402,0,0}, {'r',1,6403,0,0}, {';',0,0,2192,3},
+    {'m',1,6404,0,0}, {'q',1,6405,0,0}, {'e',2,6406,0,0}, {'i',1,6408,0,0}, {'d',1,6409,0,0}, {'i',1,6410,0,0},
+    {';',0,0,2195,3}, {'u',1,6411,0,0}, {';',0,0,2198,1}, {'e',2,6412,0,0}, {';',0,0,2199,1}, {'t',1,6414,0,0},
+    {'n',1,6415,0,0}, {'e',2,6416,0,0}, {'o',1,6418,0,0}, {'t',1,6419,0,0}, {'d',1,6420,0,0}, {'r',1,6421,0,0},
+    {';',0,0,2200,3}, {';',0,0,2203,3}, {';',0,0,2206,3}, {';',0,0,2209,3}, {';',0,0,2212,3}, {'r',2,6422,0,0},
+    {';',0,0,2215,3}, {';',0,0,2218,3}, {'r',2,6424,0,0}, {'c',1,6426,0,0}, {'p',1,6427,0,0}, {'p',1,6428,0,0},
+    {'t',1,6429,0,0}, {';',0,0,2221,3}, {'r',2,6430,0,0}, {'e',1,6432,0,0}, {'v',1,6433,0,0}, {'w',1,6434,0,0},
+    {'n',1,6435,2224,2}, {'a',1,6436,0,0}, {';',0,0,2226,3}, {';',0,0,2229,3}, {'i',1,6437,0,0}, {';',0,0,2232,3},
+    {'y',1,6438,0,0}, {'r',1,6439,0,0}, {'h',1,6440,0,0}, {';',0,0,2235,3}, {'o',1,6441,0,0}, {';',0,0,2238,2},
+    {'n',1,6442,0,0}, {'e',1,6443,0,0}, {';',0,0,2240,3}, {'e',1,6444,0,0}, {';',0,0,2243,2}, {'y',1,6445,0,0},
+    {'t',1,6446,0,0}, {';',0,0,2245,3}, {';',0,0,2248,3}, {'n',1,6447,0,0}, {';',0,0,2251,3}, {'m',1,6448,0,0},
+    {';',0,0,2254,3}, {'e',2,6449,416,2}, {'x',1,6451,0,0}, {'n',1,6452,0,0}, {'p',1,6453,0,0}, {'r',1,6454,0,0},
+    {';',0,0,2257,3}, {'d',1,6455,0,0}, {'n',1,6456,0,0}, {'u',1,6457,0,0}, {'u',1,6458,0,0}, {'e',1,6459,0,0},
+    {'r',1,6460,0,0}, {'o',1,6461,0,0}, {'a',1,6462,0,0}, {'r',1,6463,0,0}, {'n',1,6464,0,0}, {'p',1,6465,0,0},
+    {'k',1,6466,0,0}, {';',0,0,2260,3}, {';',0,0,2263,3}, {';',0,0,2266,3}, {';',0,0,2269,3}, {'l',1,6467,0,0},
+    {'a',1,6468,0,0}, {';',0,0,2272,3}, {'e',1,6469,2275,2}, {'r',1,6470,0,0}, {'n',1,6471,0,0}, {';',0,0,1237,2},
+    {'n',1,6472,0,0}, {';',0,0,2277,3}, {'e',1,6473,2280,2}, {'t',1,6474,0,0}, {'e',1,6475,0,0}, {'t',1,6476,0,0},
+    {';',0,0,2282,2}, {';',0,0,2284,3}, {'s',1,6477,0,0}, {'v',1,6478,0,0}, {'3',1,6479,0,0}, {'4',1,6480,0,0},
+    {';',0,0,2287,2}, {'l',1,6481,0,0}, {';',0,0,2289,3}, {'o',1,6482,0,0}, {';',0,0,2292,2}, {'c',1,6483,0,0},
+    {'o',1,6484,0,0}, {';',0,0,1259,3}, {'n',1,6485,0,0}, {'s',1,6486,0,0}, {'t',1,6487,0,0}, {';',0,0,2294,3},
+    {'D',1,6488,0,0}, {'r',1,6489,0,0}, {';',0,0,2297,3}, {';',0,0,2300,3}, {';',0,0,2257,3}, {';',0,0,2303,3},
+    {'t',1,6490,0,0}, {'e',1,6491,0,0}, {'n',1,6492,0,0}, {'e',1,6493,0,0}, {'g',1,6494,0,0}, {';',0,0,2306,3},
+    {'g',1,6495,0,0}, {';',0,0,2309,3}, {';',0,0,2312,2}, {';',0,0,2314,3}, {';',0,0,2317,3}, {'l',1,6496,0,0},
+    {';',0,0,2320,3}, {'i',1,6497,0,0}, {'2',1,6498,1314,2}, {'3',1,6499,0,0}, {'4',1,6500,2323,2}, {'5',1,6501,0,0},
+    {'6',1,6502,0,0}, {'8',1,6503,0,0}, {'3',1,6504,0,0}, {'5',1,6505,0,0}, {'4',1,6506,2325,2}, {'5',1,6507,0,0},
+    {'8',1,6508,0,0}, {'5',1,6509,0,0}, {'6',1,6510,0,0}, {'8',1,6511,0,0}, {'8',1,6512,0,0}, {';',0,0,2327,3},
+    {';',0,0,2330,3}, {'e',1,6513,0,0}, {';',0,0,2333,2}, {'d',1,6514,0,0}, {'e',1,6515,0,0}, {';',0,0,2335,2},
+    {'a',1,6516,0,0}, {';',0,0,2337,3}, {'t',2,6517,0,0}, {'s',1,6519,0,0}, {';',0,0,2340,3}, {'r',1,6520,0,0},
+    {';',0,0,474,3}, {';',0,0,2343,3}, {';',0,0,2346,1}, {';',0,0,2347,3}, {';',0,0,2350,3}, {';',0,0,2353,3},
+    {';',0,0,2356,3}, {'r',1,6521,0,0}, {'s',1,6522,0,0}, {'p',1,6523,0,0}, {'r',1,6524,0,0}, {'t',1,6525,0,0},
+    {'l',1,6526,0,0}, {'q',1,6527,0,0}, {'s',1,6528,0,0}, {'m',1,6529,0,0}, {'n',1,6530,0,0}, {'p',1,6531,0,0},
+    {'t',1,6532,0,0}, {'y',1,6533,0,0}, {'i',1,6534,0,0}, {';',0,0,2359,3}, {';',0,0,2362,2}, {'s',2,6535,0,0},
+    {'p',1,6537,0,0}, {'n',1,6538,0,0}, {'r',1,6539,0,0}, {'r',1,6540,0,0}, {';',0,0,2364,3}, {'t',1,6541,0,0},
+    {'e',1,6542,0,0}, {'i',1,6543,0,0}, {'r',1,6544,0,0}, {'h',1,6545,0,0}, {'k',1,6546,0,0}, {'l',1,6547,0,0},
+    {'n',1,6548,0,0}, {'e',1,6549,2367,2}, {';',0,0,1330,2}, {';',0,0,1334,2}, {'e',1,6550,2369,2}, {'t',1,6551,0,0},
+    {';',0,0,1760,3}, {'n',1,6552,0,0}, {';',0,0,2371,3}, {';',0,0,2374,2}, {';',0,0,2376,2}, {';',0,0,14,3},
+    {'i',1,6553,0,0}, {'a',1,6554,0,0}, {';',0,0,2378,2}, {';',0,0,2380,2}, {'e',1,6555,0,0}, {';',0,0,2382,3},
+    {'t',1,6556,0,0}, {'t',1,6557,0,0}, {'l',1,6558,0,0}, {'e',1,6559,0,0}, {'c',1,6560,0,0}, {'r',1,6561,0,0},
+    {'o',1,6562,0,0}, {';',0,0,2385,2}, {';',0,0,2387,3}, {'t',1,6563,2390,2}, {';',0,0,2392,3}, {'o',1,6564,0,0},
+    {';',0,0,2395,3}, {'v',1,6565,0,0}, {';',0,0,85,3}, {'e',1,6566,0,0}, {';',0,0,2398,2}, {';',0,0,2400,2},
+    {';',0,0,2402,2}, {'y',1,6567,0,0}, {';',0,0,2404,2}, {';',0,0,2406,2}, {'v',1,6568,0,0}, {'l',1,6569,0,0},
+    {'n',1,6570,0,0}, {';',0,0,2408,3}, {'l',1,6571,0,0}, {';',0,0,2411,3}, {'e',1,6572,0,0}, {'t',1,6573,0,0},
+    {'n',1,6574,0,0}, {'a',1,6575,0,0}, {';',0,0,2414,3}, {'e',1,6576,0,0}, {';',0,0,1380,2}, {';',0,0,2417,3},
+    {'f',1,6577,0,0}, {'s',1,6578,0,0}, {'k',1,6579,0,0}, {'p',1,6580,0,0}, {'l',1,6581,0,0}, {'i',1,6582,0,0},
+    {'l',1,6583,0,0}, {'l',1,6584,0,0}, {';',0,0,2420,6}, {';',0,0,2426,3}, {';',0,0,2429,3}, {'e',1,6585,0,0},
+    {'k',1,6586,0,0}, {';',0,0,2432,3}, {'l',2,6587,0,0}, {'n',1,6589,0,0}, {'l',1,6590,0,0}, {';',0,0,2435,3},
+    {';',0,0,2438,3}, {'r',1,6591,0,0}, {'a',1,6592,0,0}, {'h',1,6593,0,0}, {'r',1,6594,0,0}, {'a',1,6595,0,0},
+    {'e',1,6596,0,0}, {'i',1,6597,0,0}, {'h',1,6598,0,0}, {'a',1,6599,0,0}, {';',0,0,2441,3}, {'t',2,6600,0,0},
+    {'s',1,6602,0,0}, {'p',1,6603,0,0}, {'o',1,6604,0,0}, {'q',2,6605,0,0}, {'t',1,6607,0,0}, {'i',1,6608,0,0},
+    {'t',1,6609,0,0}, {'r',1,6610,0,0}, {';',0,0,2444,3}, {';',0,0,2447,3}, {'l',1,6611,0,0}, {';',0,0,2450,3},
+    {';',0,0,2453,3}, {'n',1,6612,0,0}, {'d',1,6613,0,0}, {';',0,0,2456,3}, {'t',1,6614,0,0}, {'t',2,6615,0,0},
+    {'r',1,6617,0,0}, {';',0,0,534,3}, {';',0,0,2459,3}, {';',0,0,2462,3}, {';',0,0,2465,3}, {';',0,0,2468,3},
+    {'e',1,6618,0,0}, {'a',1,6619,0,0}, {'i',1,6620,0,0}, {'r',1,6621,0,0}, {';',0,0,2471,3}, {'s',1,6622,0,0},
+    {'e',1,6623,0,0}, {'t',1,6624,0,0}, {'r',1,6625,0,0}, {'g',1,6626,0,0}, {'t',1,6627,0,0}, {';',0,0,2474,3},
+    {'n',1,6628,0,0}, {';',0,0,2477,3}, {'d',1,6629,0,0}, {';',0,0,2480,3}, {'o',1,6630,0,0}, {';',0,0,2483,3},
+    {';',0,0,2486,3}, {';',0,0,2489,3}, {'r',1,6631,0,0}, {'k',1,6632,0,0}, {';',0,0,2492,3}, {';',0,0,2495,3},
+    {'e',1,6633,0,0}, {'s',1,6634,0,0}, {'r',1,6635,0,0}, {'s',1,6636,0,0}, {'r',1,6637,0,0}, {';',0,0,2498,3},
+    {';',0,0,2501,3}, {'h',1,6638,0,0}, {'a',1,6639,0,0}, {'n',1,6640,0,0}, {';',0,0,2504,3}, {'s',1,6641,0,0},
+    {'o',4,6642,0,0}, {'r',1,6646,0,0}, {'a',1,6647,0,0}, {';',0,0,2507,3}, {'r',1,6648,0,0}, {';',0,0,1440,2},
+    {'t',1,6649,0,0}, {'r',1,6650,0,0}, {'t',1,6651,2510,2}, {';',0,0,2512,3}, {'b',1,6652,0,0}, {'d',2,6653,0,0},
+    {'s',1,6655,0,0}, {'s',1,6656,0,0}, {'s',1,6657,0,0}, {'m',1,6658,0,0}, {';',0,0,2515,3}, {'a',1,6659,0,0},
+    {'r',1,6660,0,0}, {'t',1,6661,0,0}, {'h',1,6662,0,0}, {'h',1,6663,0,0}, {';',0,0,180,3}, {'e',1,6664,0,0},
+    {';',0,0,2518,5}, {';',0,0,2523,2}, {'o',1,6665,0,0}, {';',0,0,2525,3}, {'a',1,6666,0,0}, {';',0,0,2528,5},
+    {'e',1,6667,0,0}, {'n',1,6668,0,0}, {'l',1,6669,0,0}, {';',0,0,2533,3}, {'d',1,6670,0,0}, {';',0,0,2536,3},
+    {';',0,0,2539,3}, {'k',1,6671,0,0}, {';',0,0,2542,3}, {'o',1,6672,0,0}, {';',0,0,2545,5}, {'v',1,6673,0,0},
+    {'r',1,6674,0,0}, {';',0,0,2550,5}, {'t',2,6675,0,0}, {';',0,0,596,5}, {'l',1,6677,0,0}, {';',0,0,2555,3},
+    {';',0,0,2558,3}, {';',0,0,2561,3}, {';',0,0,2564,3}, {';',0,0,2567,3}, {';',0,0,2570,3}, {'a',1,6678,0,0},
+    {'r',1,6679,0,0}, {';',0,0,610,5}, {'l',1,6680,0,0}, {';',0,0,618,3}, {';',0,0,2573,3}, {';',0,0,2576,3},
+    {'e',1,6681,0,0}, {';',0,0,2579,3}, {'E',1,6682,0,0}, {'d',1,6683,0,0}, {'v',3,6684,0,0}, {';',0,0,2582,3},
+    {'v',3,6687,0,0}, {'l',1,6690,0,0}, {'l',1,6691,0,0}, {';',0,0,2585,5}, {'n',1,6692,0,0}, {'e',1,6693,0,0},
+    {';',0,0,621,3}, {'e',1,6694,0,0}, {';',0,0,2590,3}, {';',0,0,2593,3}, {'c',1,6695,0,0}, {'w',1,6696,0,0},
+    {'t',1,6697,0,0}, {';',0,0,2596,3}, {'e',1,6698,0,0}, {'e',1,6699,0,0}, {'t',2,6700,0,0}, {';',0,0,2599,3},
+    {'q',1,6702,0,0}, {';',0,0,1501,3}, {';',0,0,1508,3}, {'b',1,6703,0,0}, {'p',1,6704,0,0}, {';',0,0,2602,5},
+    {';',0,0,2607,3}, {'e',1,6705,0,0}, {';',0,0,624,3}, {'e',1,6706,0,0}, {';',0,0,2610,5}, {';',0,0,2615,3},
+    {'e',1,6707,0,0}, {'e',1,6708,2618,2}, {'n',1,6709,0,0}, {'o',1,6710,0,0}, {';',0,0,2620,3}, {'h',1,6711,0,0},
+    {'r',1,6712,0,0}, {'h',1,6713,0,0}, {'i',1,6714,0,0}, {'r',1,6715,0,0}, {'i',1,6716,0,0}, {'r',1,6717,0,0},
+    {'i',1,6718,0,0}, {';',0,0,2623,6}, {';',0,0,2629,3}, {'k',1,6719,0,0}, {';',0,0,2632,3}, {'o',1,6720,0,0},
+    {'r',1,6721,0,0}, {'e',1,6722,2635,2}, {';',0,0,1572,2}, {';',0,0,2637,3}, {'c',1,6723,0,0}, {'d',1,6724,0,0},
+    {';',0,0,2640,2}, {';',0,0,2642,3}, {'e',1,6725,2645,2}, {';',0,0,2647,3}, {';',0,0,2650,3}, {';',0,0,2653,3},
+    {'s',1,6726,0,0}, {';',0,0,2656,3}, {';',0,0,2659,2}, {';',0,0,2661,2}, {'o',1,6727,0,0}, {'s',1,6728,0,0},
+    {';',0,0,2663,3}, {';',0,0,2666,3}, {';',0,0,2669,3}, {';',0,0,1598,3}, {'o',1,6729,0,0}, {'f',1,6730,0,0},
+    {'p',1,6731,0,0}, {'h',1,6732,2672,2}, {'e',1,6733,2674,2}, {'s',2,6734,0,0}, {';',0,0,2676,3}, {'l',1,6736,0,0},
+    {'m',1,6737,0,0}, {';',0,0,2679,3}, {'t',1,6738,0,0}, {'d',1,6739,0,0}, {'l',1,6740,0,0}, {'n',1,6741,0,0},
+    {'t',1,6742,0,0}, {';',0,0,2682,3}, {'f',1,6743,0,0}, {'k',2,6744,0,0}, {'v',1,6746,0,0}, {'c',1,6747,0,0},
+    {';',0,0,2685,3}, {'i',1,6748,0,0}, {'o',1,6749,0,0}, {'u',1,6750,0,0}, {';',0,0,2688,3}, {'n',1,6751,123,2},
+    {'i',1,6752,0,0}, {'w',1,6753,0,0}, {'i',1,6754,0,0}, {';',0,0,1614,2}, {';',0,0,2691,3}, {'p',1,6755,0,0},
+    {'u',1,6756,0,0}, {'q',1,6757,0,0}, {'a',1,6758,0,0}, {'e',1,6759,0,0}, {'s',1,6760,0,0}, {'i',1,6761,0,0},
+    {';',0,0,2694,3}, {'s',1,6762,0,0}, {';',0,0,2697,3}, {'m',1,6763,0,0}, {'l',1,6764,0,0}, {'i',1,6765,0,0},
+    {'u',1,6766,0,0}, {'o',1,6767,0,0}, {';',0,0,2700,3}, {'l',1,6768,0,0}, {'p',1,6769,0,0}, {'e',1,6770,0,0},
+    {'r',1,6771,0,0}, {'n',1,6772,0,0}, {';',0,0,2703,1}, {'e',1,6773,0,0}, {';',0,0,2704,3}, {'l',1,6774,0,0},
+    {';',0,0,2707,3}, {'e',1,6775,0,0}, {';',0,0,981,3}, {'t',1,6776,0,0}, {';',0,0,2710,3}, {';',0,0,2713,3},
+    {'e',1,6777,0,0}, {';',0,0,1657,2}, {'p',1,6778,0,0}, {';',0,0,2716,3}, {'f',1,6779,0,0}, {';',0,0,2719,3},
+    {'s',1,6780,0,0}, {'k',1,6781,0,0}, {'p',1,6782,0,0}, {'l',1,6783,0,0}, {'i',1,6784,0,0}, {'l',1,6785,0,0},
+    {';',0,0,2722,3}, {'l',1,6786,0,0}, {';',0,0,2725,3}, {'n',1,6787,0,0}, {';',0,0,2728,3}, {';',0,0,2731,3},
+    {'e',1,6788,0,0}, {'k',1,6789,0,0}, {';',0,0,2734,3}, {'l',2,6790,0,0}, {'n',1,6792,0,0}, {'l',1,6793,0,0},
+    {';',0,0,2737,3}, {'a',1,6794,0,0}, {';',0,0,2740,3}, {'r',1,6795,0,0}, {'n',1,6796,0,0}, {'a',1,6797,0,0},
+    {';',0,0,969,3}, {'t',1,6798,0,0}, {'r',1,6799,0,0}, {';',0,0,2743,3}, {';',0,0,2746,3}, {'l',1,6800,0,0},
+    {'a',1,6801,0,0}, {'h',1,6802,0,0}, {'l',1,6803,0,0}, {'r',1,6804,0,0}, {'s',1,6805,0,0}, {'t',1,6806,0,0},
+    {'g',1,6807,0,0}, {';',0,0,2749,3}, {';',0,0,2752,3}, {'t',2,6808,0,0}, {';',0,0,2755,3}, {';',0,0,2758,3},
+    {';',0,0,2761,3}, {';',0,0,2764,3}, {';',0,0,2767,3}, {'s',1,6810,0,0}, {'e',1,6811,0,0}, {'t',1,6812,0,0},
+    {'i',1,6813,0,0}, {';',0,0,2770,3}, {'o',1,6814,0,0}, {';',0,0,2773,3}, {'r',1,6815,0,0}, {'e',1,6816,0,0},
+    {'s',1,6817,0,0}, {';',0,0,2776,3}, {';',0,0,2779,3}, {'t',1,6818,0,0}, {'a',1,6819,0,0}, {'e',1,6820,0,0},
+    {';',0,0,2782,3}, {'n',1,6821,0,0}, {';',0,0,2785,3}, {'l',1,6822,0,0}, {';',0,0,2788,2}, {';',0,0,2790,3},
+    {'m',1,6823,0,0}, {'i',1,6824,0,0}, {';',0,0,2793,3}, {';',0,0,2796,3}, {';',0,0,2799,3}, {';',0,0,2802,3},
+    {'k',1,6825,0,0}, {';',0,0,2805,3}, {'o',1,6826,0,0}, {'r',1,6827,0,0}, {'n',1,6828,0,0}, {';',0,0,2808,3},
+    {'n',1,6829,0,0}, {';',0,0,2811,3}, {'y',1,6830,0,0}, {'m',1,6831,0,0}, {'p',1,6832,0,0}, {';',0,0,2814,2},
+    {'f',1,6833,0,0}, {'v',1,6834,0,0}, {'t',1,6835,0,0}, {';',0,0,1704,3}, {';',0,0,2816,3}, {';',0,0,2819,3},
+    {';',0,0,2822,3}, {'u',1,6836,0,0}, {'r',1,6837,0,0}, {';',0,0,1382,3}, {'s',1,6838,0,0}, {'p',1,6839,0,0},
+    {'r',1,6840,0,0}, {';',0,0,2825,3}, {';',0,0,2828,6}, {'y',1,6841,0,0}, {'r',1,6842,0,0}, {'s',2,6843,0,0},
+    {';',0,0,2834,3}, {'s',1,6845,0,0}, {';',0,0,2837,3}, {'s',1,6846,0,0}, {';',0,0,2840,3}, {'e',1,6847,0,0},
+    {'s',1,6848,0,0}, {';',0,0,2843,3}, {'e',1,6849,0,0}, {'s',1,6850,0,0}, {'e',1,6851,0,0}, {'f',1,6852,0,0},
+    {';',0,0,1659,3}, {'n',1,6853,0,0}, {'e',1,6854,0,0}, {'f',1,6855,0,0}, {';',0,0,2846,3}, {'g',1,6856,0,0},
+    {';',0,0,546,2}, {'t',1,6857,0,0}, {'o',1,6858,0,0}, {'l',1,6859,0,0}, {';',0,0,2849,3}, {';',0,0,2852,3},
+    {'u',1,6860,0,0}, {'r',1,6861,0,0}, {'t',3,6862,0,0}, {'m',1,6865,0,0}, {'b',1,6866,0,0}, {'p',1,6867,0,0},
+    {'p',1,6868,0,0}, {'u',1,6869,0,0}, {'q',1,6870,0,0}, {'a',1,6871,0,0}, {'e',1,6872,0,0}, {'s',1,6873,0,0},
+    {'i',1,6874,0,0}, {'t',1,6875,0,0}, {'u',1,6876,0,0}, {'o',1,6877,0,0}, {'o',1,6878,0,0}, {'u',1,6879,0,0},
+    {'r',1,6880,0,0}, {'l',1,6881,0,0}, {';',0,0,2855,3}, {';',0,0,2858,3}, {'u',1,6882,0,0}, {'t',3,6883,0,0},
+    {'m',1,6886,0,0}, {'b',1,6887,0,0}, {'p',1,6888,0,0}, {';',0,0,2861,3}, {'k',1,6889,0,0}, {';',0,0,2864,3},
+    {'o',1,6890,0,0}, {'r',1,6891,0,0}, {';',0,0,1748,2}, {'t',1,6892,0,0}, {'n',1,6893,0,0}, {'l',1,6894,0,0},
+    {'c',1,6895,0,0}, {'4',1,6896,0,0}, {'f',1,6897,0,0}, {';',0,0,2867,2}, {'s',1,6898,0,0}, {'v',1,6899,0,0},
+    {'a',1,6900,0,0}, {'s',1,6901,0,0}, {'p',1,6902,0,0}, {';',0,0,51,3}, {'m',1,6903,0,0}, {';',0,0,1756,2},
+    {';',0,0,2869,2}, {';',0,0,1758,2}, {'b',2,6904,0,0}, {'d',1,6906,0,0}, {'t',1,6907,0,0}, {'r',1,6908,0,0},
+    {'r',1,6909,0,0}, {'e',1,6910,0,0}, {';',0,0,1973,3}, {'g',1,6911,0,0}, {'t',1,6912,0,0}, {'n',1,6913,0,0},
+    {'u',1,6914,0,0}, {';',0,0,2871,3}, {'m',1,6915,0,0}, {'i',1,6916,0,0}, {';',0,0,2874,2}, {'k',1,6917,0,0},
+    {';',0,0,2876,3}, {'a',1,6918,0,0}, {'e',1,6919,2879,2}, {';',0,0,2881,2}, {'e',1,6920,0,0}, {';',0,0,1791,2},
+    {';',0,0,2883,3}, {'c',1,6921,0,0}, {';',0,0,2886,3}, {'t',1,6922,0,0}, {'e',1,6923,2889,2}, {';',0,0,2891,3},
+    {';',0,0,2894,3}, {';',0,0,2897,3}, {'n',2,6924,0,0}, {'p',1,6926,0,0}, {';',0,0,2900,3}, {';',0,0,2903,2},
+    {';',0,0,2905,2}, {'o',1,6927,0,0}, {'n',1,6928,0,0}, {'p',1,6929,0,0}, {';',0,0,2907,3}, {';',0,0,1012,2},
+    {'o',1,6930,0,0}, {'r',1,6931,0,0}, {'n',2,6932,0,0}, {'p',1,6934,0,0}, {';',0,0,2910,2}, {';',0,0,2912,3},
+    {';',0,0,2915,3}, {'e',1,6935,0,0}, {';',0,0,2918,3}, {';',0,0,2921,3}, {'l',1,6936,0,0}, {';',0,0,2924,3},
+    {';',0,0,2927,3}, {'t',1,6937,0,0}, {'s',1,6938,0,0}, {'p',1,6939,0,0}, {'t',1,6940,0,0}, {'i',1,6941,0,0},
+    {';',0,0,667,2}, {'o',1,6942,0,0}, {'o',1,6943,0,0}, {'g',1,6944,0,0}, {'b',1,6945,0,0}, {'p',1,6946,0,0},
+    {'e',1,6947,0,0}, {'i',1,6948,0,0}, {';',0,0,2930,3}, {'r',1,6949,0,0}, {';',0,0,2933,3}, {'p',1,6950,0,0},
+    {'r',1,6951,0,0}, {';',0,0,2936,3}, {';',0,0,2939,6}, {';',0,0,2945,6}, {';',0,0,1625,3}, {';',0,0,2951,3},
+    {'E',1,6952,0,0}, {'e',1,6953,0,0}, {'E',1,6954,0,0}, {'e',1,6955,0,0}, {'a',1,6956,0,0}, {';',0,0,2954,2},
+    {'r',1,6957,0,0}, {';',0,0,365,3}, {'q',1,6958,0,0}, {'p',1,6959,0,0}, {'h',1,6960,0,0}, {';',0,0,2956,3},
+    {';',0,0,2959,3}, {';',0,0,2962,3}, {';',0,0,2965,3}, {';',0,0,2968,3}, {';',0,0,2971,3}, {';',0,0,2974,3},
+    {'s',1,6961,0,0}, {'e',1,6962,0,0}, {';',0,0,2977,3}, {';',0,0,2980,3}, {'p',1,6963,0,0}, {'s',1,6964,0,0},
+    {';',0,0,2983,3}, {'e',1,6965,0,0}, {'e',1,6966,2986,2}, {';',0,0,2988,2}, {'e',1,6967,0,0}, {'n',1,6968,0,0},
+    {'f',1,6969,0,0}, {'r',1,6970,0,0}, {';',0,0,1883,2}, {';',0,0,2990,2}, {';',0,0,1885,2}, {'u',1,6971,0,0},
+    {';',0,0,2992,3}, {';',0,0,1893,2}, {'a',1,6972,0,0}, {';',0,0,2995,3}, {'e',1,6973,0,0}, {'l',1,6974,0,0},
+    {';',0,0,1147,3}, {';',0,0,2998,2}, {'l',1,6975,0,0}, {'s',1,6976,0,0}, {';',0,0,3000,2}, {';',0,0,1897,2},
+    {'t',1,6977,0,0}, {'a',1,6978,0,0}, {'D',1,6979,0,0}, {'D',1,6980,0,0}, {'M',1,6981,0,0}, {'P',1,6982,0,0},
+    {'T',1,6983,0,0}, {'i',1,6984,0,0}, {'u',1,6985,0,0}, {';',0,0,3002,3}, {'e',1,6986,0,0}, {';',0,0,3005,3},
+    {'r',1,6987,0,0}, {'u',1,6988,0,0}, {'r',1,6989,0,0}, {';',0,0,3008,3}, {'h',1,6990,0,0}, {';',0,0,3011,3},
+    {';',0,0,3014,2}, {'t',1,6991,0,0}, {'d',1,6992,0,0}, {'e',1,6993,0,0}, {';',0,0,3016,3}, {'a',1,6994,0,0},
+    {'C',1,6995,0,0}, {'D',1,6996,0,0}, {'L',2,6997,0,0}, {'R',1,6999,0,0}, {'U',1,7000,0,0}, {'V',1,7001,0,0},
+    {'r',1,7002,0,0}, {'e',1,7003,0,0}, {'f',1,7004,0,0}, {'g',1,7005,0,0}, {'e',2,7006,0,0}, {'r',1,7008,0,0},
+    {';',0,0,3019,2}, {';',0,0,1912,2}, {';',0,0,3021,2}, {';',0,0,1914,2}, {'t',1,7009,0,0}, {'m',1,7010,0,0},
+    {'e',1,7011,0,0}, {'n',1,7012,0,0}, {'i',1,7013,0,0}, {'b',1,7014,0,0}, {';',0,0,2303,3}, {'n',1,7015,0,0},
+    {'S',1,7016,0,0}, {'V',1,7017,0,0}, {';',0,0,3023,3}, {'r',1,7018,0,0}, {';',0,0,3026,2}, {';',0,0,3028,2},
+    {';',0,0,3030,2}, {'r',6,7019,0,0}, {';',0,0,3032,2}, {'t',1,7025,0,0}, {'n',1,7026,0,0}, {';',0,0,3034,2},
+    {'w',1,7027,0,0}, {'u',1,7028,0,0}, {';',0,0,1933,2}, {';',0,0,1935,2}, {'a',1,7029,0,0}, {'s',1,7030,0,0},
+    {'a',1,7031,0,0}, {'e',1,7032,0,0}, {'b',1,7033,0,0}, {';',0,0,3036,2}, {';',0,0,3038,2}, {';',0,0,3040,2},
+    {';',0,0,3042,2}, {';',0,0,3044,2}, {'e',1,7034,0,0}, {';',0,0,3046,2}, {';',0,0,3048,2}, {'g',1,7035,0,0},
+    {'r',1,7036,0,0}, {'i',1,7037,0,0}, {'u',1,7038,0,0}, {'w',1,7039,0,0}, {'o',1,7040,0,0}, {'g',1,7041,0,0},
+    {'e',3,7042,0,0}, {'i',1,7045,0,0}, {'D',1,7046,0,0}, {'T',1,7047,0,0}, {'V',1,7048,0,0}, {'c',1,7049,0,0},
+    {'r',1,7050,0,0}, {'g',1,7051,0,0}, {'u',1,7052,0,0}, {'l',1,7053,0,0}, {'e',1,7054,0,0}, {'s',1,7055,0,0},
+    {'a',1,7056,0,0}, {'l',1,7057,0,0}, {'r',1,7058,0,0}, {';',0,0,3050,2}, {'f',1,7059,0,0}, {'g',1,7060,0,0},
+    {'f',1,7061,0,0}, {'g',1,7062,0,0}, {'e',1,7063,0,0}, {'i',1,7064,0,0}, {';',0,0,3052,2}, {'S',1,7065,0,0},
+    {'t',1,7066,0,0}, {'l',1,7067,0,0}, {';',0,0,3054,2}, {';',0,0,3056,2}, {';',0,0,3058,2}, {'v',1,7068,0,0},
+    {'G',1,7069,0,0}, {'L',1,7070,0,0}, {'e',1,7071,0,0}, {'k',1,7072,0,0}, {'a',1,7073,0,0}, {'g',1,7074,0,0},
+    {'C',1,7075,0,0}, {'b',1,7076,0,0}, {'m',1,7077,0,0}, {'a',1,7078,0,0}, {'s',1,7079,0,0}, {'a',1,7080,0,0},
+    {'p',2,7081,0,0}, {'t',1,7083,0,0}, {'s',6,7084,0,0}, {'t',1,7090,0,0}, {'c',1,7091,0,0}, {'e',1,7092,0,0},
+    {'h',1,7093,0,0}, {'a',1,7094,0,0}, {'s',1,7095,0,0}, {'c',1,7096,0,0}, {'e',1,7097,0,0}, {'d',1,7098,0,0},
+    {'t',1,7099,0,0}, {';',0,0,1949,2}, {';',0,0,1953,2}, {';',0,0,3060,2}, {';',0,0,1955,2}, {'n',1,7100,0,0},
+    {'r',1,7101,0,0}, {';',0,0,1959,2}, {';',0,0,1961,2}, {';',0,0,3062,3}, {'r',1,7102,0,0}, {'a',1,7103,0,0},
+    {'r',1,7104,0,0}, {'l',1,7105,0,0}, {'n',1,7106,0,0}, {'r',1,7107,0,0}, {'e',1,7108,0,0}, {'t',1,7109,0,0},
+    {'t',1,7110,0,0}, {';',0,0,3065,2}, {';',0,0,3067,3}, {';',0,0,3070,2}, {';',0,0,3072,2}, {'e',2,7111,0,0},
+    {'n',1,7113,0,0}, {'r',1,7114,0,0}, {'e',1,7115,0,0}, {'o',2,7116,0,0}, {'l',1,7118,0,0}, {'e',1,7119,0,0},
+    {'r',1,7120,0,0}, {'p',3,7121,0,0}, {'e',1,7124,0,0}, {'r',1,7125,0,0}, {'m',1,7126,0,0}, {'a',1,7127,0,0},
+    {'l',1,7128,0,0}, {';',0,0,3074,2}, {';',0,0,3076,2}, {';',0,0,3078,2}, {';',0,0,3080,2}, {';',0,0,3082,2},
+    {'o',1,7129,0,0}, {'e',1,7130,0,0}, {'i',1,7131,0,0}, {'p',1,7132,0,0}, {'i',1,7133,0,0}, {';',0,0,713,3},
+    {'I',1,7134,0,0}, {'S',1,7135,0,0}, {'U',1,7136,0,0}, {';',0,0,297,3}, {'E',1,7137,0,0}, {'d',1,7138,0,0},
+    {'a',1,7139,0,0}, {'e',1,7140,0,0}, {';',0,0,303,3}, {';',0,0,3084,2}, {';',0,0,3086,2}, {'o',1,7141,0,0},
+    {'p',1,7142,0,0}, {'a',1,7143,0,0}, {'q',1,7144,0,0}, {'u',1,7145,0,0}, {'i',1,7146,0,0}, {'D',1,7147,0,0},
+    {';',0,0,3088,2}, {';',0,0,1980,2}, {'i',1,7148,0,0}, {';',0,0,3090,2}, {';',0,0,3092,2}, {';',0,0,1984,2},
+    {'a',1,7149,0,0}, {'r',1,7150,0,0}, {'a',1,7151,0,0}, {'l',1,7152,0,0}, {'w',3,7153,0,0}, {'A',1,7156,0,0},
+    {'l',1,7157,0,0}, {'r',1,7158,0,0}, {'w',1,7159,0,0}, {'a',1,7160,0,0}, {'e',1,7161,0,0}, {'i',1,7162,0,0},
+    {'n',1,7163,0,0}, {';',0,0,3094,2}, {';',0,0,3096,3}, {';',0,0,1021,3}, {'a',1,7164,0,0}, {'i',1,7165,0,0},
+    {';',0,0,3099,3}, {';',0,0,2003,2}, {';',0,0,3102,2}, {';',0,0,3104,2}, {'d',1,7166,0,0}, {';',0,0,2007,2},
+    {';',0,0,3106,2}, {';',0,0,2009,2}, {'m',1,7167,0,0}, {';',0,0,3108,3}, {'p',1,7168,0,0}, {';',0,0,3111,3},
+    {'a',8,7169,0,0}, {'b',2,7177,0,0}, {';',0,0,3114,3}, {'r',1,7179,0,0}, {';',0,0,3117,3}, {';',0,0,51,3},
+    {'e',1,7180,0,0}, {'q',1,7181,0,0}, {';',0,0,2026,2}, {'n',1,7182,0,0}, {'n',1,7183,0,0}, {'s',1,7184,0,0},
+    {'i',1,7185,0,0}, {'m',2,7186,0,0}, {';',0,0,3120,3}, {';',0,0,3123,3}, {'g',1,7188,0,0}, {'r',1,7189,0,0},
+    {';',0,0,3126,3}, {'e',1,7190,0,0}, {'v',1,7191,0,0}, {';',0,0,801,3}, {'n',1,7192,0,0}, {';',0,0,1832,3},
+    {'c',1,7193,0,0}, {';',0,0,1835,3}, {'t',1,7194,0,0}, {'u',1,7195,0,0}, {'m',1,7196,0,0}, {'u',1,7197,0,0},
+    {'r',1,7198,0,0}, {'a',1,7199,0,0}, {'u',1,7200,0,0}, {';',0,0,325,3}, {'g',1,7201,0,0}, {';',0,0,2728,3},
+    {'o',1,7202,0,0}, {'q',1,7203,0,0}, {'r',1,7204,0,0}, {'v',1,7205,0,0}, {';',0,0,390,3}, {';',0,0,3129,3},
+    {';',0,0,3132,3}, {'u',1,7206,0,0}, {'s',1,7207,0,0}, {'e',1,7208,0,0}, {';',0,0,3135,3}, {';',0,0,2162,2},
+    {'u',1,7209,0,0}, {';',0,0,1144,3}, {';',0,0,2176,3}, {';',0,0,3138,2}, {';',0,0,3140,3}, {'u',1,7210,0,0},
+    {';',0,0,3143,3}, {';',0,0,3146,3}, {';',0,0,3149,3}, {';',0,0,3152,2}, {';',0,0,2185,2}, {'m',1,7211,0,0},
+    {'v',1,7212,0,0}, {'d',1,7213,0,0}, {'a',1,7214,0,0}, {';',0,0,1167,3}, {'a',1,7215,0,0}, {'d',5,7216,0,0},
+    {'n',1,7221,0,0}, {';',0,0,3154,3}, {'r',1,7222,0,0}, {'i',1,7223,0,0}, {';',0,0,2992,3}, {'q',1,7224,0,0},
+    {';',0,0,3157,1}, {';',0,0,3158,3}, {'m',1,7225,0,0}, {'x',1,7226,0,0}, {'t',1,7227,0,0}, {';',0,0,1582,3},
+    {';',0,0,3161,3}, {';',0,0,3164,3}, {'l',1,7228,0,0}, {'r',1,7229,0,0}, {';',0,0,3167,3}, {'p',1,7230,0,0},
+    {'a',1,7231,0,0}, {';',0,0,3170,3}, {';',0,0,3173,3}, {';',0,0,3176,3}, {';',0,0,3179,3}, {'m',1,7232,0,0},
+    {'q',2,7233,0,0}, {'e',1,7235,0,0}, {'e',1,7236,0,0}, {';',0,0,2224,2}, {'r',1,7237,0,0}, {'n',1,7238,0,0},
+    {';',0,0,3182,3}, {';',0,0,3185,3}, {';',0,0,3188,3}, {'w',1,7239,0,0}, {';',0,0,3191,2}, {'r',1,7240,0,0},
+    {'q',1,7241,0,0}, {'v',1,7242,0,0}, {';',0,0,3193,3}, {'d',2,7243,0,0}, {'a',1,7245,0,0}, {';',0,0,416,2},
+    {'o',1,7246,0,0}, {';',0,0,3196,3}, {';',0,0,3199,3}, {';',0,0,3202,3}, {';',0,0,3205,1}, {'o',1,7247,0,0},
+    {'u',1,7248,0,0}, {'s',1,7249,0,0}, {'a',1,7250,0,0}, {'b',1,7251,0,0}, {'r',1,7252,0,0}, {'w',1,7253,0,0},
+    {'r',1,7254,0,0}, {'o',1,7255,0,0}, {';',0,0,3206,3}, {';',0,0,3209,3}, {';',0,0,3212,2}, {'e',1,7256,0,0},
+    {'r',1,7257,0,0}, {';',0,0,2275,2}, {';',0,0,3214,3}, {';',0,0,3217,2}, {';',0,0,3219,3}, {';',0,0,2280,2},
+    {';',0,0,3222,3}, {'r',1,7258,0,0}, {';',0,0,3225,3}, {'e',1,7259,0,0}, {';',0,0,2284,3}, {';',0,0,3228,3},
+    {';',0,0,3231,3}, {';',0,0,3234,3}, {'n',1,7260,0,0}, {';',0,0,1234,3}, {'n',1,7261,0,0}, {'t',2,7262,0,0},
+    {';',0,0,3237,1}, {';',0,0,3238,3}, {'D',1,7264,0,0}, {'s',1,7265,0,0}, {'a',1,7266,0,0}, {'n',1,7267,0,0},
+    {'g',1,7268,0,0}, {';',0,0,3241,3}, {';',0,0,3244,3}, {';',0,0,3247,3}, {';',0,0,3023,3}, {'n',1,7269,0,0},
+    {';',0,0,1314,2}, {';',0,0,3250,3}, {';',0,0,2323,2}, {';',0,0,3253,3}, {';',0,0,3256,3}, {';',0,0,3259,3},
+    {';',0,0,3262,3}, {';',0,0,3265,3}, {';',0,0,2325,2}, {';',0,0,3268,3}, {';',0,0,3271,3}, {';',0,0,3274,3},
+    {';',0,0,3277,3}, {';',0,0,3280,3}, {';',0,0,3283,3}, {';',0,0,3286,2}, {';',0,0,3288,2}, {';',0,0,3290,2},
+    {'n',1,7270,0,0}, {';',0,0,3292,3}, {'o',2,7271,0,0}, {';',0,0,3295,3}, {'o',1,7273,0,0}, {';',0,0,3298,3},
+    {'t',1,7274,0,0}, {'r',1,7275,0,0}, {';',0,0,3301,3}, {';',0,0,2356,3}, {'e',1,7276,0,0}, {'l',1,7277,0,0},
+    {'s',1,7278,0,0}, {';',0,0,1302,3}, {'e',1,7279,0,0}, {';',0,0,3304,3}, {';',0,0,868,3}, {';',0,0,3307,2},
+    {'r',1,7280,0,0}, {';',0,0,3309,3}, {'u',1,7281,0,0}, {';',0,0,1445,3}, {';',0,0,3312,3}, {'o',1,7282,0,0},
+    {'o',1,7283,0,0}, {';',0,0,3315,3}, {'f',1,7284,0,0}, {'g',1,7285,0,0}, {';',0,0,3318,3}, {';',0,0,1319,3},
+    {';',0,0,3321,2}, {';',0,0,3323,3}, {';',0,0,1205,3}, {';',0,0,2367,2}, {';',0,0,2369,2}, {';',0,0,1632,3},
+    {';',0,0,3326,3}, {'n',1,7286,0,0}, {'r',1,7287,0,0}, {';',0,0,3329,3}, {'i',1,7288,0,0}, {';',0,0,2378,2},
+    {';',0,0,3332,3}, {'r',1,7289,0,0}, {'a',1,7290,0,0}, {'h',1,7291,0,0}, {'d',1,7292,0,0}, {';',0,0,2390,2},
+    {'t',1,7293,0,0}, {';',0,0,3335,3}, {';',0,0,3338,2}, {';',0,0,3340,2}, {';',0,0,3342,2}, {';',0,0,3344,2},
+    {';',0,0,3346,2}, {';',0,0,3348,3}, {';',0,0,3351,2}, {'y',1,7294,0,0}, {';',0,0,920,3}, {';',0,0,3353,2},
+    {';',0,0,1377,3}, {'s',1,7295,0,0}, {';',0,0,3355,3}, {';',0,0,3358,3}, {';',0,0,3361,3}, {';',0,0,3364,3},
+    {'m',1,7296,0,0}, {';',0,0,3367,3}, {';',0,0,3370,3}, {';',0,0,1388,1}, {';',0,0,1421,1}, {'d',1,7297,0,0},
+    {'u',1,7298,0,0}, {';',0,0,3373,2}, {';',0,0,3375,2}, {';',0,0,2034,3}, {'r',1,7299,0,0}, {'a',1,7300,0,0},
+    {'r',1,7301,0,0}, {'r',1,7302,0,0}, {'f',1,7303,0,0}, {'g',1,7304,0,0}, {'r',1,7305,0,0}, {'n',1,7306,0,0},
+    {';',0,0,3377,3}, {'o',2,7307,0,0}, {';',0,0,3380,3}, {'p',1,7309,0,0}, {'t',1,7310,0,0}, {'g',1,7311,0,0},
+    {'q',1,7312,0,0}, {'r',1,7313,0,0}, {'m',1,7314,0,0}, {';',0,0,3383,3}, {';',0,0,3386,3}, {';',0,0,3389,3},
+    {'e',1,7315,0,0}, {';',0,0,3392,3}, {';',0,0,3395,2}, {';',0,0,3397,3}, {'a',1,7316,0,0}, {'o',1,7317,0,0},
+    {'f',1,7318,0,0}, {'p',1,7319,0,0}, {'g',1,7320,0,0}, {'r',1,7321,0,0}, {';',0,0,3400,3}, {'s',1,7322,0,0},
+    {';',0,0,3403,3}, {';',0,0,3406,1}, {'e',1,7323,0,0}, {';',0,0,3407,3}, {'e',1,7324,0,0}, {';',0,0,3410,3},
+    {';',0,0,3413,3}, {';',0,0,2782,3}, {';',0,0,3416,2}, {';',0,0,3418,3}, {';',0,0,3421,3}, {';',0,0,3424,3},
+    {'t',1,7325,0,0}, {';',0,0,3427,3}, {'a',1,7326,0,0}, {'r',1,7327,0,0}, {'e',1,7328,0,0}, {'e',1,7329,0,0},
+    {';',0,0,548,3}, {'d',1,7330,0,0}, {'l',1,7331,0,0}, {'u',1,7332,0,0}, {';',0,0,3430,3}, {';',0,0,3433,3},
+    {'e',1,7333,0,0}, {';',0,0,377,1}, {';',0,0,3436,3}, {';',0,0,2510,2}, {';',0,0,3439,3}, {';',0,0,3442,3},
+    {'u',1,7334,0,0}, {';',0,0,100,3}, {';',0,0,3445,3}, {';',0,0,45,3}, {'a',1,7335,0,0}, {'r',1,7336,0,0},
+    {'i',1,7337,0,0}, {'a',1,7338,0,0}, {';',0,0,3448,3}, {';',0,0,3451,3}, {';',0,0,3454,2}, {'x',1,7339,0,0},
+    {'l',2,7340,0,0}, {';',0,0,3456,5}, {';',0,0,3461,2}, {';',0,0,3463,2}, {'o',1,7342,0,0}, {';',0,0,3465,3},
+    {'w',1,7343,0,0}, {';',0,0,3468,3}, {';',0,0,1763,3}, {';',0,0,3471,3}, {'s',1,7344,0,0}, {'a',1,7345,0,0},
+    {'r',1,7346,0,0}, {'i',1,7347,0,0}, {'a',1,7348,0,0}, {';',0,0,3474,3}, {';',0,0,3477,5}, {'o',1,7349,0,0},
+    {'a',1,7350,0,0}, {'b',1,7351,0,0}, {'c',1,7352,0,0}, {'a',1,7353,0,0}, {'b',1,7354,0,0}, {'c',1,7355,0,0},
+    {'l',1,7356,0,0}, {';',0,0,3482,6}, {'t',1,7357,0,0}, {';',0,0,3488,3}, {'q',1,7358,0,0}, {';',0,0,3491,5},
+    {';',0,0,3496,5}, {'a',1,7359,0,0}, {';',0,0,3501,3}, {';',0,0,3504,3}, {'m',1,7360,0,0}, {'p',1,7361,0,0},
+    {';',0,0,2599,3}, {'e',1,7362,0,0}, {'e',1,7363,0,0}, {'t',2,7364,0,0}, {'q',1,7366,0,0}, {'t',2,7367,0,0},
+    {';',0,0,2618,2}, {'g',1,7369,0,0}, {';',0,0,3507,3}, {';',0,0,3510,3}, {';',0,0,3513,3}, {';',0,0,3516,3},
+    {'n',1,7370,0,0}, {';',0,0,3519,3}, {'e',1,7371,0,0}, {';',0,0,3522,3}, {'e',1,7372,0,0}, {';',0,0,3525,3},
+    {'w',1,7373,0,0}, {';',0,0,3528,3}, {';',0,0,2635,2}, {';',0,0,3531,2}, {';',0,0,3533,3}, {';',0,0,2645,2},
+    {'s',1,7374,0,0}, {'n',1,7375,0,0}, {';',0,0,3536,3}, {'f',1,7376,0,0}, {';',0,0,3539,3}, {'e',1,7377,0,0},
+    {';',0,0,2672,2}, {';',0,0,2674,2}, {';',0,0,3542,3}, {'a',1,7378,0,0}, {'e',1,7379,0,0}, {';',0,0,3545,3},
+    {';',0,0,3548,1}, {';',0,0,3549,1}, {';',0,0,3550,3}, {'k',1,7380,0,0}, {';',0,0,927,3}, {'o',1,7381,0,0},
+    {';',0,0,1319,3}, {'h',1,7382,0,0}, {';',0,0,1319,3}, {'i',1,7383,0,0}, {'r',1,7384,0,0}, {';',0,0,3553,3},
+    {';',0,0,3556,3}, {';',0,0,123,2}, {'m',1,7385,0,0}, {'o',1,7386,0,0}, {'n',1,7387,0,0}, {'p',1,7388,0,0},
+    {'r',1,7389,0,0}, {';',0,0,672,3}, {'p',1,7390,0,0}, {'q',1,7391,0,0}, {'i',1,7392,0,0}, {'m',1,7393,0,0},
+    {';',0,0,949,3}, {';',0,0,3559,3}, {'a',1,7394,0,0}, {'n',1,7395,0,0}, {'r',1,7396,0,0}, {';',0,0,1625,3},
+    {';',0,0,3562,3}, {';',0,0,3565,3}, {';',0,0,3568,3}, {'n',1,7397,0,0}, {'t',1,7398,0,0}, {'q',1,7399,0,0},
+    {';',0,0,3571,3}, {';',0,0,3574,2}, {'y',1,7400,0,0}, {';',0,0,1654,3}, {';',0,0,3576,3}, {'s',1,7401,0,0},
+    {';',0,0,3579,3}, {';',0,0,3582,3}, {';',0,0,3585,3}, {';',0,0,3588,3}, {'m',1,7402,0,0}, {';',0,0,3591,3},
+    {';',0,0,3594,3}, {'a',1,7403,0,0}, {';',0,0,1662,1}, {';',0,0,1685,1}, {'d',1,7404,0,0}, {'u',1,7405,0,0},
+    {';',0,0,3597,2}, {';',0,0,3599,2}, {'r',1,7406,0,0}, {';',0,0,2740,3}, {'e',1,7407,0,0}, {'r',1,7408,0,0},
+    {';',0,0,3601,3}, {';',0,0,3604,3}, {';',0,0,3607,3}, {'r',1,7409,0,0}, {'a',1,7410,0,0}, {'e',1,7411,0,0},
+    {'i',1,7412,0,0}, {'q',1,7413,0,0}, {'h',1,7414,0,0}, {'d',1,7415,0,0}, {';',0,0,3610,3}, {'a',1,7416,0,0},
+    {';',0,0,3613,3}, {'s',1,7417,0,0}, {';',0,0,3616,3}, {'n',1,7418,0,0}, {';',0,0,3619,3}, {';',0,0,2773,3},
+    {';',0,0,3622,3}, {';',0,0,3625,3}, {'r',1,7419,0,0}, {'r',1,7420,0,0}, {';',0,0,3628,2}, {';',0,0,3630,2},
+    {';',0,0,3632,2}, {';',0,0,3634,3}, {'n',1,7421,0,0}, {';',0,0,3637,3}, {'w',1,7422,0,0}, {';',0,0,1770,3},
+    {'u',1,7423,0,0}, {';',0,0,2330,3}, {';',0,0,3640,2}, {'i',1,7424,0,0}, {'a',1,7425,0,0}, {';',0,0,3642,2},
+    {';',0,0,3642,2}, {';',0,0,3644,3}, {'s',1,7426,0,0}, {'r',1,7427,0,0}, {'e',1,7428,0,0}, {';',0,0,3647,3},
+    {'s',1,7429,0,0}, {';',0,0,3650,2}, {';',0,0,3652,3}, {';',0,0,3655,3}, {'u',1,7430,0,0}, {';',0,0,3658,6},
+    {';',0,0,3664,6}, {';',0,0,3670,3}, {'e',1,7431,0,0}, {';',0,0,3673,3}, {'e',1,7432,0,0}, {';',0,0,713,3},
+    {';',0,0,1723,3}, {';',0,0,2808,3}, {';',0,0,2825,3}, {';',0,0,988,3}, {'h',1,7433,0,0}, {';',0,0,3676,3},
+    {'t',1,7434,0,0}, {'t',1,7435,0,0}, {'s',1,7436,0,0}, {'r',1,7437,0,0}, {';',0,0,716,3}, {'e',1,7438,0,0},
+    {'n',1,7439,0,0}, {';',0,0,3679,3}, {';',0,0,3682,3}, {';',0,0,3685,3}, {'p',1,7440,0,0}, {'r',1,7441,0,0},
+    {';',0,0,695,3}, {'p',1,7442,0,0}, {'q',1,7443,0,0}, {'i',1,7444,0,0}, {'m',1,7445,0,0}, {';',0,0,3688,3},
+    {'b',1,7446,0,0}, {'t',1,7447,0,0}, {'l',1,7448,0,0}, {'b',1,7449,0,0}, {'r',1,7450,0,0}, {'t',1,7451,0,0},
+    {'s',1,7452,0,0}, {';',0,0,725,3}, {'e',1,7453,0,0}, {'n',1,7454,0,0}, {';',0,0,3691,3}, {';',0,0,3694,3},
+    {';',0,0,3697,3}, {';',0,0,3700,3}, {'w',1,7455,0,0}, {';',0,0,3703,3}, {';',0,0,3706,3}, {';',0,0,3709,2},
+    {';',0,0,3711,2}, {';',0,0,3713,3}, {';',0,0,3716,3}, {'o',1,7456,0,0}, {'y',1,7457,0,0}, {';',0,0,3719,2},
+    {'p',1,7458,0,0}, {'i',1,7459,0,0}, {';',0,0,3721,3}, {';',0,0,706,3}, {';',0,0,3724,3}, {'a',1,7460,0,0},
+    {';',0,0,3727,3}, {';',0,0,3730,3}, {';',0,0,3733,3}, {'k',1,7461,0,0}, {';',0,0,3736,3}, {'l',1,7462,0,0},
+    {';',0,0,3739,3}, {'u',1,7463,0,0}, {'s',1,7464,0,0}, {'e',1,7465,0,0}, {'u',1,7466,0,0}, {';',0,0,3742,2},
+    {'d',2,7467,0,0}, {';',0,0,2879,2}, {';',0,0,3744,2}, {';',0,0,3746,2}, {';',0,0,3748,3}, {';',0,0,2889,2},
+    {';',0,0,3751,3}, {'e',1,7469,0,0}, {';',0,0,3754,3}, {'w',1,7470,0,0}, {'a',1,7471,0,0}, {'o',1,7472,0,0},
+    {'n',1,7473,0,0}, {'r',1,7474,0,0}, {';',0,0,3757,3}, {'e',1,7475,0,0}, {';',0,0,3760,3}, {';',0,0,3763,2},
+    {'e',1,7476,0,0}, {';',0,0,3765,3}, {'i',1,7477,0,0}, {'p',1,7478,0,0}, {'h',1,7479,0,0}, {';',0,0,1607,2},
+    {'p',1,7480,0,0}, {';',0,0,1672,2}, {'m',1,7481,0,0}, {'s',1,7482,0,0}, {'s',1,7483,0,0}, {'t',1,7484,0,0},
+    {'a',1,7485,0,0}, {';',0,0,3768,3}, {';',0,0,3771,3}, {';',0,0,1815,1}, {';',0,0,3774,6}, {';',0,0,3780,6},
+    {';',0,0,3786,6}, {';',0,0,3792,6}, {'g',1,7486,0,0}, {';',0,0,3798,3}, {';',0,0,3801,3}, {';',0,0,138,3},
+    {';',0,0,141,3}, {';',0,0,3804,3}, {';',0,0,3807,3}, {';',0,0,3810,3}, {';',0,0,3813,3}, {';',0,0,2000,3},
+    {';',0,0,2986,2}, {';',0,0,3816,2}, {';',0,0,3818,2}, {';',0,0,348,3}, {'r',1,7487,0,0}, {'n',1,7488,0,0},
+    {'s',1,7489,0,0}, {';',0,0,3126,3}, {'l',1,7490,0,0}, {'D',1,7491,0,0}, {';',0,0,170,3}, {';',0,0,3820,3},
+    {';',0,0,1158,2}, {'o',1,7492,0,0}, {'o',1,7493,0,0}, {'i',1,7494,0,0}, {'l',1,7495,0,0}, {'i',1,7496,0,0},
+    {'s',1,7497,0,0}, {'r',1,7498,0,0}, {'n',1,7499,0,0}, {'I',1,7500,0,0}, {'c',1,7501,0,0}, {'C',1,7502,0,0},
+    {'d',1,7503,0,0}, {'i',1,7504,0,0}, {';',0,0,1208,3}, {'n',1,7505,0,0}, {'l',1,7506,0,0}, {'o',1,7507,0,0},
+    {'o',2,7508,0,0}, {'e',1,7510,0,0}, {'o',1,7511,0,0}, {'i',1,7512,0,0}, {'p',2,7513,0,0}, {'e',1,7515,0,0},
+    {'o',1,7516,0,0}, {'v',1,7517,0,0}, {'t',3,7518,0,0}, {'h',1,7521,0,0}, {';',0,0,736,3}, {'A',1,7522,0,0},
+    {'o',1,7523,0,0}, {';',0,0,85,3}, {'a',1,7524,0,0}, {'r',1,7525,0,0}, {';',0,0,3823,2}, {'l',1,7526,0,0},
+    {'r',1,7527,0,0}, {'t',1,7528,0,0}, {'m',1,7529,0,0}, {'e',1,7530,0,0}, {'t',1,7531,0,0}, {'E',1,7532,0,0},
+    {'F',1,7533,0,0}, {'G',1,7534,0,0}, {'L',1,7535,0,0}, {'S',1,7536,0,0}, {'T',1,7537,0,0}, {'S',1,7538,0,0},
+    {'t',1,7539,0,0}, {'n',1,7540,0,0}, {'a',1,7541,0,0}, {'r',1,7542,0,0}, {';',0,0,1643,3}, {'l',1,7543,0,0},
+    {'c',1,7544,0,0}, {'l',1,7545,0,0}, {'t',1,7546,0,0}, {'l',1,7547,0,0}, {'o',1,7548,0,0}, {'l',1,7549,0,0},
+    {'b',1,7550,0,0}, {'n',2,7551,0,0}, {'o',1,7553,0,0}, {'h',1,7554,0,0}, {';',0,0,2235,3}, {'A',1,7555,0,0},
+    {'V',1,7556,0,0}, {'a',1,7557,0,0}, {'o',1,7558,0,0}, {'e',1,7559,0,0}, {'e',1,7560,0,0}, {'t',1,7561,0,0},
+    {'o',1,7562,0,0}, {'h',1,7563,0,0}, {'a',1,7564,0,0}, {'l',1,7565,0,0}, {'a',1,7566,0,0}, {'s',1,7567,0,0},
+    {'n',1,7568,0,0}, {'d',1,7569,0,0}, {'r',1,7570,0,0}, {'t',2,7571,0,0}, {'h',1,7573,0,0}, {'t',2,7574,0,0},
+    {'h',1,7576,0,0}, {'f',1,7577,0,0}, {'g',1,7578,0,0}, {'p',1,7579,0,0}, {'r',1,7580,0,0}, {'u',1,7581,0,0},
+    {'e',3,7582,0,0}, {'r',1,7585,0,0}, {'e',1,7586,0,0}, {';',0,0,3825,1}, {';',0,0,3826,3}, {'k',1,7587,0,0},
+    {'r',1,7588,0,0}, {'a',1,7589,0,0}, {'l',1,7590,0,0}, {'e',1,7591,0,0}, {'l',2,7592,0,0}, {'t',1,7594,0,0},
+    {'t',1,7595,0,0}, {'D',1,7596,0,0}, {'E',1,7597,0,0}, {'T',1,7598,0,0}, {';',0,0,618,3}, {'E',1,7599,0,0},
+    {'G',1,7600,0,0}, {'L',1,7601,0,0}, {'S',1,7602,0,0}, {'T',1,7603,0,0}, {'e',1,7604,0,0}, {'e',1,7605,0,0},
+    {'r',1,7606,0,0}, {'t',1,7607,0,0}, {'r',1,7608,0,0}, {'e',1,7609,0,0}, {'e',1,7610,0,0}, {'r',1,7611,0,0},
+    {'e',4,7612,0,0}, {'i',1,7616,0,0}, {';',0,0,3829,2}, {'l',1,7617,0,0}, {';',0,0,2656,3}, {'c',2,7618,0,0},
+    {'e',1,7620,0,0}, {'D',1,7621,0,0}, {'u',1,7622,0,0}, {'e',1,7623,0,0}, {'s',4,7624,0,0}, {';',0,0,1622,3},
+    {'i',1,7628,0,0}, {'E',2,7629,0,0}, {'U',1,7631,0,0}, {'g',1,7632,0,0}, {'r',1,7633,0,0}, {'i',1,7634,0,0},
+    {'u',1,7635,0,0}, {'w',1,7636,0,0}, {'o',1,7637,0,0}, {'e',3,7638,0,0}, {'i',1,7641,0,0}, {'D',1,7642,0,0},
+    {'T',1,7643,0,0}, {'V',1,7644,0,0}, {'c',1,7645,0,0}, {'r',1,7646,0,0}, {'p',1,7647,0,0}, {'r',1,7648,0,0},
+    {'a',1,7649,0,0}, {'w',1,7650,0,0}, {'f',1,7651,0,0}, {'g',1,7652,0,0}, {'A',1,7653,0,0}, {'r',1,7654,0,0},
+    {'n',1,7655,0,0}, {'u',2,7656,0,0}, {'n',1,7658,0,0}, {'q',1,7659,0,0}, {'s',4,7660,0,0}, {'t',1,7664,0,0},
+    {'t',2,7665,0,0}, {'r',1,7667,0,0}, {'a',1,7668,0,0}, {'c',1,7669,0,0}, {'u',1,7670,0,0}, {'l',1,7671,0,0},
+    {'l',1,7672,0,0}, {'o',1,7673,0,0}, {'r',1,7674,0,0}, {'r',1,7675,0,0}, {'a',1,7676,0,0}, {'r',1,7677,0,0},
+    {'u',1,7678,0,0}, {';',0,0,1788,3}, {'B',1,7679,0,0}, {'D',1,7680,0,0}, {'r',1,7681,0,0}, {'i',1,7682,0,0},
+    {'r',1,7683,0,0}, {';',0,0,1782,3}, {'r',1,7684,0,0}, {'f',1,7685,0,0}, {'g',1,7686,0,0}, {';',0,0,3831,2},
+    {'l',4,7687,0,0}, {'n',1,7691,0,0}, {'t',1,7692,0,0}, {';',0,0,2011,3}, {'e',1,7693,0,0}, {'a',1,7694,0,0},
+    {'b',1,7695,0,0}, {'c',1,7696,0,0}, {'d',1,7697,0,0}, {'e',1,7698,0,0}, {'f',1,7699,0,0}, {'g',1,7700,0,0},
+    {'h',1,7701,0,0}, {';',0,0,3833,3}, {'d',1,7702,0,0}, {';',0,0,3836,3}, {'q',1,7703,0,0}, {';',0,0,3008,3},
+    {'t',1,7704,0,0}, {'g',1,7705,0,0}, {'i',1,7706,0,0}, {'m',1,7707,0,0}, {';',0,0,1140,3}, {'e',1,7708,0,0},
+    {'e',1,7709,0,0}, {'k',1,7710,0,0}, {';',0,0,3126,3}, {';',0,0,3839,3}, {';',0,0,2876,3}, {';',0,0,2956,3},
+    {';',0,0,2974,3}, {'s',1,7711,0,0}, {'e',1,7712,0,0}, {'p',1,7713,0,0}, {';',0,0,2846,3}, {'n',1,7714,0,0},
+    {'s',1,7715,0,0}, {'e',1,7716,0,0}, {'z',1,7717,0,0}, {'u',1,7718,0,0}, {'i',1,7719,0,0}, {';',0,0,3842,6},
+    {'s',1,7720,0,0}, {';',0,0,2685,3}, {'s',1,7721,0,0}, {'b',1,7722,0,0}, {'p',1,7723,0,0}, {';',0,0,3848,3},
+    {';',0,0,3851,3}, {'o',1,7724,0,0}, {'r',1,7725,0,0}, {'r',1,7726,0,0}, {'R',1,7727,0,0}, {'S',1,7728,0,0},
+    {'a',1,7729,0,0}, {'c',1,7730,0,0}, {'d',1,7731,0,0}, {'t',1,7732,0,0}, {';',0,0,3854,3}, {'t',1,7733,0,0},
+    {';',0,0,2992,3}, {'e',1,7734,0,0}, {'e',1,7735,0,0}, {';',0,0,3857,3}, {';',0,0,3860,3}, {';',0,0,3863,3},
+    {';',0,0,3866,3}, {'p',1,7736,0,0}, {';',0,0,3869,3}, {'p',1,7737,0,0}, {'s',1,7738,0,0}, {'e',1,7739,0,0},
+    {'d',1,7740,0,0}, {'r',1,7741,0,0}, {'t',1,7742,0,0}, {';',0,0,2707,3}, {';',0,0,3011,3}, {';',0,0,2272,3},
+    {';',0,0,3872,3}, {';',0,0,1208,3}, {'s',1,7743,0,0}, {';',0,0,3288,2}, {'n',1,7744,0,0}, {'t',1,7745,0,0},
+    {'s',1,7746,0,0}, {';',0,0,3553,3}, {'r',1,7747,0,0}, {'a',1,7748,0,0}, {'o',1,7749,0,0}, {'n',1,7750,0,0},
+    {'p',1,7751,0,0}, {'w',1,7752,0,0}, {';',0,0,3875,3}, {'r',1,7753,0,0}, {'s',1,7754,0,0}, {'t',1,7755,0,0},
+    {';',0,0,1254,2}, {';',0,0,3219,3}, {'g',1,7756,0,0}, {'l',1,7757,0,0}, {';',0,0,3878,3}, {'l',1,7758,0,0},
+    {'t',1,7759,0,0}, {'t',1,7760,0,0}, {'d',1,7761,0,0}, {'t',1,7762,0,0}, {'t',1,7763,0,0}, {';',0,0,3881,3},
+    {'l',1,7764,0,0}, {'x',1,7765,0,0}, {';',0,0,3884,3}, {'o',1,7766,0,0}, {'s',1,7767,0,0}, {'e',1,7768,0,0},
+    {';',0,0,76,3}, {'q',1,7769,0,0}, {';',0,0,3887,3}, {'i',1,7770,0,0}, {'w',1,7771,0,0}, {'w',1,7772,0,0},
+    {'t',1,7773,0,0}, {'h',1,7774,0,0}, {'e',1,7775,0,0}, {'t',1,7776,0,0}, {'e',1,7777,0,0}, {'s',1,7778,0,0},
+    {'l',1,7779,0,0}, {'k',1,7780,0,0}, {';',0,0,2387,3}, {';',0,0,3890,3}, {'v',1,7781,0,0}, {';',0,0,3893,3},
+    {';',0,0,3896,3}, {';',0,0,3899,3}, {';',0,0,3902,3}, {';',0,0,3905,3}, {'r',1,7782,0,0}, {'o',1,7783,0,0},
+    {'p',1,7784,0,0}, {'t',1,7785,0,0}, {'h',1,7786,0,0}, {'e',1,7787,0,0}, {'t',1,7788,0,0}, {';',0,0,3908,3},
+    {'r',1,7789,0,0}, {'r',1,7790,0,0}, {';',0,0,2495,3}, {'t',1,7791,0,0}, {'g',1,7792,0,0}, {';',0,0,97,3},
+    {';',0,0,1418,3}, {'r',1,7793,0,0}, {'c',1,7794,0,0}, {'x',1,7795,0,0}, {'t',2,7796,0,0}, {'s',1,7798,0,0},
+    {'h',1,7799,0,0}, {'o',1,7800,0,0}, {';',0,0,3911,3}, {';',0,0,540,3}, {'r',1,7801,0,0}, {';',0,0,3914,3},
+    {'r',1,7802,0,0}, {';',0,0,3917,3}, {'q',1,7803,0,0}, {';',0,0,1437,3}, {'o',1,7804,0,0}, {'e',1,7805,0,0},
+    {'p',1,7806,0,0}, {'d',1,7807,0,0}, {';',0,0,3920,3}, {'p',1,7808,0,0}, {'r',1,7809,0,0}, {'g',1,7810,0,0},
+    {'r',1,7811,0,0}, {';',0,0,585,3}, {';',0,0,2525,3}, {'s',1,7812,0,0}, {'t',1,7813,0,0}, {';',0,0,2542,3},
+    {';',0,0,3471,3}, {'n',1,7814,0,0}, {'r',1,7815,0,0}, {'g',1,7816,0,0}, {'n',1,7817,0,0}, {'t',1,7818,0,0},
+    {';',0,0,2579,3}, {';',0,0,3923,3}, {';',0,0,3926,3}, {';',0,0,2582,3}, {';',0,0,3929,3}, {';',0,0,3932,3},
+    {'e',1,7819,0,0}, {';',0,0,3935,3}, {';',0,0,1511,5}, {'r',1,7820,0,0}, {'i',1,7821,0,0}, {'a',1,7822,0,0},
+    {';',0,0,3938,3}, {';',0,0,3941,3}, {';',0,0,2939,6}, {'e',1,7823,0,0}, {';',0,0,1516,5}, {';',0,0,2945,6},
+    {'e',1,7824,0,0}, {'l',1,7825,0,0}, {';',0,0,3944,3}, {';',0,0,3947,6}, {';',0,0,3953,6}, {';',0,0,2632,3},
+    {';',0,0,3959,3}, {';',0,0,3962,2}, {';',0,0,1598,3}, {';',0,0,3964,3}, {'s',1,7826,0,0}, {'l',1,7827,0,0},
+    {';',0,0,3967,3}, {'r',1,7828,0,0}, {';',0,0,3970,3}, {'r',1,7829,0,0}, {';',0,0,3973,3}, {';',0,0,3976,3},
+    {';',0,0,3979,3}, {'t',1,7830,0,0}, {'r',1,7831,0,0}, {'l',1,7832,0,0}, {'p',1,7833,0,0}, {'q',1,7834,0,0},
+    {'m',1,7835,0,0}, {';',0,0,2700,3}, {'r',1,7836,0,0}, {'e',1,7837,0,0}, {'f',1,7838,0,0}, {'i',1,7839,0,0},
+    {';',0,0,3982,3}, {';',0,0,3238,3}, {'v',1,7840,0,0}, {';',0,0,3985,3}, {';',0,0,3988,3}, {'l',1,7841,0,0},
+    {';',0,0,3991,3}, {';',0,0,3994,3}, {';',0,0,3997,3}, {';',0,0,972,3}, {'t',1,7842,0,0}, {'r',1,7843,0,0},
+    {'r',1,7844,0,0}, {'f',1,7845,0,0}, {'g',1,7846,0,0}, {'u',1,7847,0,0}, {'r',1,7848,0,0}, {'o',1,7849,0,0},
+    {'c',1,7850,0,0}, {';',0,0,4000,3}, {'t',1,7851,0,0}, {'i',1,7852,0,0}, {';',0,0,4003,3}, {'t',1,7853,0,0},
+    {';',0,0,2805,3}, {'s',1,7854,0,0}, {'d',1,7855,0,0}, {'r',1,7856,0,0}, {';',0,0,4006,3}, {';',0,0,4009,3},
+    {'t',1,7857,0,0}, {'l',1,7858,0,0}, {'i',1,7859,0,0}, {'t',2,7860,0,0}, {'t',2,7862,0,0}, {'t',2,7864,0,0},
+    {';',0,0,4012,3}, {';',0,0,4015,3}, {';',0,0,4018,3}, {';',0,0,4021,3}, {'q',2,7866,0,0}, {'e',1,7868,0,0},
+    {'r',1,7869,0,0}, {'l',1,7870,0,0}, {'p',1,7871,0,0}, {'q',1,7872,0,0}, {'m',1,7873,0,0}, {';',0,0,2793,3},
+    {';',0,0,4024,3}, {';',0,0,4027,3}, {';',0,0,4030,3}, {';',0,0,4033,3}, {';',0,0,4036,3}, {';',0,0,4039,3},
+    {';',0,0,4042,3}, {'q',2,7874,0,0}, {'e',1,7876,0,0}, {';',0,0,2864,3}, {'r',1,7877,0,0}, {'m',1,7878,0,0},
+    {'p',1,7879,0,0}, {'m',1,7880,0,0}, {'r',1,7881,0,0}, {';',0,0,4045,3}, {'e',5,7882,0,0}, {'s',1,7887,0,0},
+    {';',0,0,4048,3}, {';',0,0,4051,3}, {'m',1,7888,0,0}, {'l',1,7889,0,0}, {'r',1,7890,0,0}, {'r',1,7891,0,0},
+    {';',0,0,1788,3}, {'r',1,7892,0,0}, {'o',1,7893,0,0}, {';',0,0,1797,2}, {'o',1,7894,0,0}, {'r',1,7895,0,0},
+    {';',0,0,4054,3}, {'l',1,7896,0,0}, {'a',1,7897,0,0}, {'i',1,7898,0,0}, {'t',1,7899,0,0}, {'a',1,7900,0,0},
+    {'e',1,7901,0,0}, {'e',1,7902,0,0}, {'a',1,7903,0,0}, {'n',1,7904,0,0}, {';',0,0,4057,3}, {';',0,0,4060,3},
+    {'c',1,7905,0,0}, {'h',1,7906,0,0}, {'i',1,7907,0,0}, {'i',1,7908,0,0}, {'t',1,7909,0,0}, {'t',1,7910,0,0},
+    {'n',1,7911,0,0}, {'u',1,7912,0,0}, {'m',1,7913,0,0}, {'e',1,7914,0,0}, {'l',1,7915,0,0}, {'t',1,7916,0,0},
+    {'n',1,7917,0,0}, {'t',1,7918,0,0}, {'l',1,7919,0,0}, {';',0,0,4063,3}, {'c',1,7920,0,0}, {'t',1,7921,0,0},
+    {';',0,0,2257,3}, {'n',1,7922,0,0}, {'t',1,7923,0,0}, {'w',1,7924,0,0}, {'f',1,7925,0,0}, {'n',1,7926,0,0},
+    {'g',1,7927,0,0}, {'A',1,7928,0,0}, {'D',1,7929,0,0}, {'r',1,7930,0,0}, {'w',3,7931,0,0}, {'e',1,7934,0,0},
+    {'R',1,7935,0,0}, {'T',1,7936,0,0}, {'V',1,7937,0,0}, {'t',2,7938,0,0}, {'r',1,7940,0,0}, {'w',1,7941,0,0},
+    {'l',1,7942,0,0}, {'y',1,7943,0,0}, {'d',1,7944,0,0}, {'i',1,7945,0,0}, {'i',1,7946,0,0}, {'a',1,7947,0,0},
+    {'r',1,7948,0,0}, {'r',1,7949,0,0}, {'q',1,7950,0,0}, {'u',1,7951,0,0}, {'r',1,7952,0,0}, {'e',1,7953,0,0},
+    {'l',1,7954,0,0}, {'i',1,7955,0,0}, {'p',1,7956,0,0}, {'a',1,7957,0,0}, {'H',1,7958,0,0}, {'l',1,7959,0,0},
+    {'y',1,7960,0,0}, {';',0,0,493,3}, {'t',1,7961,0,0}, {'e',2,7962,0,0}, {'r',1,7964,0,0}, {'e',1,7965,0,0},
+    {'w',3,7966,0,0}, {'i',1,7969,0,0}, {'l',1,7970,0,0}, {'T',1,7971,0,0}, {'V',1,7972,0,0}, {'r',1,7973,0,0},
+    {'t',2,7974,0,0}, {'r',1,7976,0,0}, {'e',1,7977,0,0}, {'n',1,7978,0,0}, {'w',1,7979,0,0}, {'e',1,7980,0,0},
+    {'c',1,7981,0,0}, {'o',1,7982,0,0}, {'w',1,7983,0,0}, {'t',1,7984,0,0}, {'l',1,7985,0,0}, {'E',1,7986,0,0},
+    {'t',1,7987,0,0}, {';',0,0,4066,3}, {'t',1,7988,0,0}, {'e',1,7989,0,0}, {'o',1,7990,0,0}, {'A',1,7991,0,0},
+    {'R',1,7992,0,0}, {'t',1,7993,0,0}, {'a',1,7994,0,0}, {'r',1,7995,0,0}, {'t',1,7996,0,0}, {'t',1,7997,0,0},
+    {'h',1,7998,0,0}, {'a',1,7999,0,0}, {'f',1,8000,0,0}, {'s',1,8001,0,0}, {'M',1,8002,0,0}, {'T',1,8003,0,0},
+    {'V',1,8004,0,0}, {'e',1,8005,0,0}, {'s',1,8006,0,0}, {'i',1,8007,0,0}, {'u',1,8008,0,0}, {'p',1,8009,0,0},
+    {'e',1,8010,0,0}, {'n',1,8011,0,0}, {';',0,0,105,3}, {'T',1,8012,0,0}, {'s',1,8013,0,0}, {'e',1,8014,0,0},
+    {'o',1,8015,0,0}, {'q',1,8016,0,0}, {'r',1,8017,0,0}, {'q',1,8018,0,0}, {'r',1,8019,0,0}, {'e',1,8020,0,0},
+    {'l',1,8021,0,0}, {'i',1,8022,0,0}, {'d',2,8023,0,0}, {'d',1,8025,0,0}, {'s',1,8026,0,0}, {'T',1,8027,0,0},
+    {'e',1,8028,0,0}, {'t',2,8029,0,0}, {'e',1,8031,0,0}, {'s',1,8032,0,0}, {';',0,0,1525,3}, {'E',1,8033,0,0},
+    {'F',1,8034,0,0}, {'T',1,8035,0,0}, {'c',1,8036,0,0}, {'y',2,8037,0,0}, {'e',1,8039,0,0}, {'k',1,8040,0,0},
+    {'n',1,8041,0,0}, {';',0,0,1604,3}, {'s',1,8042,0,0}, {'p',1,8043,0,0}, {';',0,0,125,3}, {'E',1,8044,0,0},
+    {'S',1,8045,0,0}, {'T',1,8046,0,0}, {'o',1,8047,0,0}, {'l',1,8048,0,0}, {'q',1,8049,0,0}, {'p',1,8050,0,0},
+    {'l',1,8051,0,0}, {'o',1,8052,0,0}, {'l',1,8053,0,0}, {'b',1,8054,0,0}, {'n',2,8055,0,0}, {'o',1,8057,0,0},
+    {';',0,0,2930,3}, {'A',1,8058,0,0}, {'V',1,8059,0,0}, {'a',1,8060,0,0}, {'o',1,8061,0,0}, {'e',1,8062,0,0},
+    {'e',1,8063,0,0}, {'t',1,8064,0,0}, {'o',1,8065,0,0}, {'l',1,8066,0,0}, {'r',1,8067,0,0}, {'y',1,8068,0,0},
+    {'n',1,8069,0,0}, {'t',1,8070,0,0}, {'h',1,8071,0,0}, {'r',1,8072,0,0}, {'c',1,8073,0,0}, {'t',1,8074,0,0},
+    {'b',1,8075,0,0}, {'p',1,8076,0,0}, {'i',1,8077,0,0}, {'u',1,8078,0,0}, {';',0,0,131,3}, {'E',1,8079,0,0},
+    {'S',1,8080,0,0}, {'T',1,8081,0,0}, {';',0,0,108,3}, {';',0,0,725,3}, {'E',1,8082,0,0}, {'e',1,8083,0,0},
+    {'c',1,8084,0,0}, {'e',1,8085,0,0}, {'a',1,8086,0,0}, {'l',1,8087,0,0}, {'d',1,8088,0,0}, {'t',1,8089,0,0},
+    {';',0,0,4069,3}, {';',0,0,3406,1}, {'c',2,8090,0,0}, {'e',1,8092,0,0}, {'s',1,8093,0,0}, {'a',1,8094,0,0},
+    {'o',1,8095,0,0}, {'r',1,8096,0,0}, {'b',1,8097,0,0}, {'o',1,8098,0,0}, {'r',1,8099,0,0}, {'t',1,8100,0,0},
+    {'h',1,8101,0,0}, {'B',1,8102,0,0}, {'L',1,8103,0,0}, {'S',1,8104,0,0}, {'T',1,8105,0,0}, {'S',1,8106,0,0},
+    {'h',1,8107,0,0}, {';',0,0,4072,3}, {';',0,0,4075,3}, {';',0,0,4078,3}, {';',0,0,4081,3}, {';',0,0,4084,3},
+    {';',0,0,4087,3}, {';',0,0,4090,3}, {';',0,0,4093,3}, {';',0,0,4096,3}, {';',0,0,4099,3}, {';',0,0,374,3},
+    {';',0,0,4102,3}, {';',0,0,2031,3}, {'l',1,8108,0,0}, {'e',1,8109,0,0}, {'q',1,8110,0,0}, {';',0,0,3123,3},
+    {';',0,0,4105,3}, {';',0,0,3804,3}, {'s',1,8111,0,0}, {';',0,0,3810,3}, {'g',1,8112,0,0}, {';',0,0,3813,3},
+    {';',0,0,2000,3}, {'e',1,8113,0,0}, {'a',1,8114,0,0}, {'a',1,8115,0,0}, {';',0,0,3439,3}, {';',0,0,3724,3},
+    {';',0,0,4108,3}, {';',0,0,4111,3}, {'t',1,8116,0,0}, {'k',1,8117,0,0}, {'r',1,8118,0,0}, {';',0,0,35,2},
+    {';',0,0,115,3}, {'s',1,8119,0,0}, {'i',1,8120,0,0}, {'a',1,8121,0,0}, {';',0,0,4114,3}, {';',0,0,2195,3},
+    {'n',1,8122,0,0}, {'s',1,8123,0,0}, {';',0,0,4117,3}, {'r',1,8124,0,0}, {'u',1,8125,0,0}, {';',0,0,2226,3},
+    {'g',1,8126,0,0}, {'o',1,8127,0,0}, {';',0,0,4120,3}, {'u',1,8128,0,0}, {'t',1,8129,0,0}, {';',0,0,1231,3},
+    {';',0,0,3442,3}, {'e',1,8130,0,0}, {'r',1,8131,0,0}, {'w',1,8132,0,0}, {'a',1,8133,0,0}, {'o',1,8134,0,0},
+    {';',0,0,1966,3}, {';',0,0,4123,3}, {';',0,0,4126,3}, {';',0,0,2284,3}, {'t',1,8135,0,0}, {'e',1,8136,0,0},
+    {';',0,0,4129,3}, {'i',1,8137,0,0}, {'i',1,8138,0,0}, {'o',1,8139,0,0}, {';',0,0,4132,3}, {';',0,0,458,3},
+    {';',0,0,4135,3}, {';',0,0,1292,3}, {'x',1,8140,0,0}, {'s',1,8141,0,0}, {'s',1,8142,0,0}, {'q',1,8143,0,0},
+    {'t',1,8144,0,0}, {';',0,0,3637,3}, {';',0,0,3700,3}, {'a',1,8145,0,0}, {'t',1,8146,0,0}, {';',0,0,885,3},
+    {';',0,0,14,3}, {';',0,0,4138,3}, {';',0,0,1070,3}, {';',0,0,3332,3}, {';',0,0,4141,3}, {';',0,0,4144,3},
+    {';',0,0,4147,3}, {'w',2,8147,0,0}, {'o',1,8149,0,0}, {'a',1,8150,0,0}, {'t',3,8151,0,0}, {'e',1,8154,0,0},
+    {';',0,0,524,3}, {';',0,0,4150,3}, {'o',1,8155,0,0}, {'r',1,8156,0,0}, {'t',1,8157,0,0}, {';',0,0,3199,3},
+    {'h',1,8158,0,0}, {';',0,0,1403,3}, {'a',1,8159,0,0}, {'r',1,8160,0,0}, {'t',1,8161,0,0}, {'t',1,8162,0,0},
+    {'w',2,8163,0,0}, {';',0,0,3206,3}, {';',0,0,4153,3}, {'q',1,8165,0,0}, {'w',1,8166,0,0}, {'f',1,8167,0,0},
+    {';',0,0,4156,3}, {'a',1,8168,0,0}, {';',0,0,2515,3}, {'o',1,8169,0,0}, {'h',1,8170,0,0}, {'r',1,8171,0,0},
+    {';',0,0,932,3}, {';',0,0,4159,5}, {'t',1,8172,0,0}, {'o',1,8173,0,0}, {'h',1,8174,0,0}, {'t',1,8175,0,0},
+    {';',0,0,4164,5}, {'l',1,8176,0,0}, {'r',1,8177,0,0}, {'d',1,8178,0,0}, {'r',1,8179,0,0}, {'q',2,8180,0,0},
+    {'q',2,8182,0,0}, {'e',2,8184,0,0}, {';',0,0,4169,3}, {';',0,0,654,3}, {'k',1,8186,0,0}, {';',0,0,4172,3},
+    {';',0,0,4175,3}, {'o',1,8187,0,0}, {'y',1,8188,0,0}, {'r',1,8189,0,0}, {';',0,0,1619,3}, {';',0,0,3559,3},
+    {';',0,0,4178,3}, {';',0,0,4181,3}, {';',0,0,4184,3}, {'o',1,8190,0,0}, {';',0,0,4187,3}, {'s',1,8191,0,0},
+    {';',0,0,37,3}, {'o',1,8192,0,0}, {'p',1,8193,0,0}, {'t',2,8194,0,0}, {'h',1,8196,0,0}, {'i',1,8197,0,0},
+    {'e',1,8198,0,0}, {'t',1,8199,0,0}, {'h',1,8200,0,0}, {';',0,0,4190,3}, {';',0,0,4193,3}, {';',0,0,4196,3},
+    {';',0,0,2808,3}, {';',0,0,560,3}, {'a',1,8201,0,0}, {'m',1,8202,0,0}, {';',0,0,4199,3}, {'t',1,8203,0,0},
+    {';',0,0,2840,3}, {'e',1,8204,0,0}, {';',0,0,2843,3}, {'e',1,8205,0,0}, {'e',1,8206,0,0}, {'p',1,8207,0,0},
+    {';',0,0,1736,3}, {'q',1,8208,0,0}, {'q',2,8209,0,0}, {'o',1,8211,0,0}, {'y',1,8212,0,0}, {'r',1,8213,0,0},
+    {';',0,0,1692,3}, {';',0,0,3634,3}, {';',0,0,1745,3}, {'q',1,8214,0,0}, {'q',2,8215,0,0}, {'e',1,8217,0,0},
+    {';',0,0,3719,2}, {'r',1,8218,0,0}, {';',0,0,706,3}, {';',0,0,4202,3}, {';',0,0,1803,3}, {'d',1,8219,0,0},
+    {'l',1,8220,0,0}, {'q',1,8221,0,0}, {'r',1,8222,0,0}, {';',0,0,4205,3}, {';',0,0,4208,3}, {'e',1,8223,0,0},
+    {'i',1,8224,0,0}, {';',0,0,3751,3}, {'r',1,8225,0,0}, {'n',2,8226,0,0}, {'w',1,8228,0,0}, {';',0,0,3757,3},
+    {'o',1,8229,0,0}, {';',0,0,3342,2}, {'n',1,8230,0,0}, {'o',1,8231,0,0}, {';',0,0,3642,2}, {'t',1,8232,0,0},
+    {'t',1,8233,0,0}, {';',0,0,3719,2}, {'g',1,8234,0,0}, {'t',1,8235,0,0}, {';',0,0,2808,3}, {'s',1,8236,0,0},
+    {'f',1,8237,0,0}, {';',0,0,2510,2}, {';',0,0,1577,3}, {'u',1,8238,0,0}, {'s',1,8239,0,0}, {'e',1,8240,0,0},
+    {'C',1,8241,0,0}, {'y',2,8242,0,0}, {';',0,0,2294,3}, {'t',1,8244,0,0}, {';',0,0,3161,3}, {'o',1,8245,0,0},
+    {'a',1,8246,0,0}, {'i',1,8247,0,0}, {'t',1,8248,0,0}, {';',0,0,136,2}, {'n',1,8249,0,0}, {'t',3,8250,0,0},
+    {'g',2,8253,0,0}, {'h',1,8255,0,0}, {'r',1,8256,0,0}, {'o',1,8257,0,0}, {'t',1,8258,0,0}, {';',0,0,1202,3},
+    {'B',1,8259,0,0}, {'U',1,8260,0,0}, {';',0,0,4211,2}, {'i',1,8261,0,0}, {'e',1,8262,0,0}, {'e',1,8263,0,0},
+    {'T',1,8264,0,0}, {'V',1,8265,0,0}, {'r',1,8266,0,0}, {';',0,0,1196,3}, {'l',1,8267,0,0}, {'S',1,8268,0,0},
+    {'e',1,8269,0,0}, {'u',1,8270,0,0}, {'a',1,8271,0,0}, {'l',1,8272,0,0}, {'y',1,8273,0,0}, {'f',1,8274,0,0},
+    {'u',1,8275,0,0}, {'l',1,8276,0,0}, {'e',1,8277,0,0}, {'s',1,8278,0,0}, {'a',1,8279,0,0}, {'l',1,8280,0,0},
+    {'a',1,8281,0,0}, {'l',1,8282,0,0}, {'u',1,8283,0,0}, {';',0,0,2176,3}, {'I',1,8284,0,0}, {'i',1,8285,0,0},
+    {'C',1,8286,0,0}, {'T',1,8287,0,0}, {'f',1,8288,0,0}, {'B',1,8289,0,0}, {';',0,0,1382,3}, {'B',1,8290,0,0},
+    {'R',1,8291,0,0}, {'n',1,8292,0,0}, {'e',1,8293,0,0}, {'e',1,8294,0,0}, {'e',1,8295,0,0}, {';',0,0,3386,3},
+    {'A',1,8296,0,0}, {'V',1,8297,0,0}, {'r',1,8298,0,0}, {'c',1,8299,0,0}, {'g',1,8300,0,0}, {'n',1,8301,0,0},
+    {'V',1,8302,0,0}, {'t',1,8303,0,0}, {'r',2,8304,0,0}, {';',0,0,1371,3}, {'a',1,8306,0,0}, {'G',1,8307,0,0},
+    {'q',1,8308,0,0}, {'e',1,8309,0,0}, {'E',1,8310,0,0}, {';',0,0,1418,3}, {'w',1,8311,0,0}, {'r',1,8312,0,0},
+    {'i',1,8313,0,0}, {'A',1,8314,0,0}, {'r',1,8315,0,0}, {'i',1,8316,0,0}, {'a',1,8317,0,0}, {'A',1,8318,0,0},
+    {'t',1,8319,0,0}, {'c',1,8320,0,0}, {';',0,0,927,3}, {';',0,0,100,3}, {'e',1,8321,0,0}, {'h',1,8322,0,0},
+    {'e',1,8323,0,0}, {'a',1,8324,0,0}, {'s',1,8325,0,0}, {'n',1,8326,0,0}, {'e',1,8327,0,0}, {';',0,0,4213,3},
+    {'V',1,8328,0,0}, {'t',1,8329,0,0}, {'i',1,8330,0,0}, {';',0,0,3471,3}, {'r',7,8331,0,0}, {'w',1,8338,0,0},
+    {'u',1,8339,0,0}, {'i',1,8340,0,0}, {'u',1,8341,0,0}, {'e',1,8342,0,0}, {'s',1,8343,0,0}, {'a',1,8344,0,0},
+    {'l',1,8345,0,0}, {'G',1,8346,0,0}, {'L',1,8347,0,0}, {'e',1,8348,0,0}, {'e',1,8349,0,0}, {'r',1,8350,0,0},
+    {'S',1,8351,0,0}, {';',0,0,2939,6}, {'E',1,8352,0,0}, {'d',1,8353,0,0}, {'e',1,8354,0,0}, {'q',1,8355,0,0},
+    {'u',1,8356,0,0}, {'i',1,8357,0,0}, {'a',1,8358,0,0}, {'D',1,8359,0,0}, {'Q',1,8360,0,0}, {';',0,0,4216,3},
+    {'e',1,8361,0,0}, {'t',1,8362,0,0}, {';',0,0,123,2}, {'l',1,8363,0,0}, {'q',1,8364,0,0}, {'l',1,8365,0,0},
+    {'i',1,8366,0,0}, {'n',2,8367,0,0}, {'e',1,8369,0,0}, {'u',1,8370,0,0}, {'E',1,8371,0,0}, {'e',1,8372,0,0},
+    {'w',3,8373,0,0}, {'i',1,8376,0,0}, {'l',1,8377,0,0}, {'T',1,8378,0,0}, {'V',1,8379,0,0}, {'r',1,8380,0,0},
+    {'r',1,8381,0,0}, {'e',1,8382,0,0}, {'n',1,8383,0,0}, {'w',1,8384,0,0}, {'e',1,8385,0,0}, {'c',1,8386,0,0},
+    {'o',1,8387,0,0}, {'w',1,8388,0,0}, {'i',1,8389,0,0}, {'o',1,8390,0,0}, {'e',1,8391,0,0}, {'A',1,8392,0,0},
+    {'A',1,8393,0,0}, {'t',1,8394,0,0}, {'r',1,8395,0,0}, {'l',1,8396,0,0}, {'e',1,8397,0,0}, {'s',1,8398,0,0},
+    {'e',1,8399,0,0}, {'o',1,8400,0,0}, {'a',1,8401,0,0}, {'q',1,8402,0,0}, {'l',1,8403,0,0}, {'i',1,8404,0,0},
+    {'q',1,8405,0,0}, {';',0,0,3716,3}, {'e',1,8406,0,0}, {';',0,0,3721,3}, {'l',1,8407,0,0}, {'E',1,8408,0,0},
+    {'e',1,8409,0,0}, {';',0,0,1753,3}, {'e',1,8410,0,0}, {'k',1,8411,0,0}, {'n',1,8412,0,0}, {';',0,0,2907,3},
+    {'r',1,8413,0,0}, {'w',1,8414,0,0}, {'o',1,8415,0,0}, {'r',1,8416,0,0}, {'w',1,8417,0,0}, {'o',1,8418,0,0},
+    {'A',1,8419,0,0}, {'t',1,8420,0,0}, {'a',1,8421,0,0}, {'i',1,8422,0,0}, {'e',1,8423,0,0}, {'i',1,8424,0,0},
+    {'p',1,8425,0,0}, {'S',1,8426,0,0}, {'o',1,8427,0,0}, {';',0,0,3135,3}, {';',0,0,2167,3}, {';',0,0,3807,3},
+    {'l',1,8428,0,0}, {'n',1,8429,0,0}, {'r',1,8430,0,0}, {'n',1,8431,0,0}, {';',0,0,2510,2}, {';',0,0,2192,3},
+    {'o',1,8432,0,0}, {'t',1,8433,0,0}, {'r',1,8434,0,0}, {'s',1,8435,0,0}, {'t',1,8436,0,0}, {';',0,0,808,3},
+    {'e',1,8437,0,0}, {'c',1,8438,0,0}, {'e',1,8439,0,0}, {'w',2,8440,0,0}, {'i',1,8442,0,0}, {'i',1,8443,0,0},
+    {';',0,0,2796,3}, {'w',1,8444,0,0}, {';',0,0,1202,3}, {'r',1,8445,0,0}, {'o',1,8446,0,0}, {'r',1,8447,0,0},
+    {'s',1,8448,0,0}, {'o',1,8449,0,0}, {'a',1,8450,0,0}, {'t',1,8451,0,0}, {';',0,0,450,3}, {';',0,0,455,3},
+    {'s',1,8452,0,0}, {';',0,0,1308,6}, {';',0,0,3309,3}, {'r',1,8453,0,0}, {'a',1,8454,0,0}, {';',0,0,1382,3},
+    {'t',1,8455,0,0}, {'o',1,8456,0,0}, {'r',1,8457,0,0}, {'a',1,8458,0,0}, {'h',1,8459,0,0}, {'s',1,8460,0,0},
+    {'t',1,8461,0,0}, {'x',1,8462,0,0}, {';',0,0,521,3}, {'r',1,8463,0,0}, {'e',1,8464,0,0}, {'r',1,8465,0,0},
+    {'i',1,8466,0,0}, {'o',1,8467,0,0}, {'a',1,8468,0,0}, {'l',1,8469,0,0}, {'r',1,8470,0,0}, {';',0,0,1428,6},
+    {'n',1,8471,0,0}, {'t',1,8472,0,0}, {'n',1,8473,0,0}, {'w',1,8474,0,0}, {'t',1,8475,0,0}, {'o',1,8476,0,0},
+    {';',0,0,1483,5}, {'w',1,8477,0,0}, {'t',1,8478,0,0}, {';',0,0,1496,5}, {';',0,0,1508,3}, {'o',1,8479,0,0},
+    {';',0,0,1501,3}, {'a',1,8480,0,0}, {';',0,0,2607,3}, {'q',1,8481,0,0}, {';',0,0,2615,3}, {'q',1,8482,0,0},
+    {'l',1,8483,0,0}, {'r',1,8484,0,0}, {';',0,0,1275,3}, {'x',1,8485,0,0}, {'e',1,8486,0,0}, {'o',1,8487,0,0},
+    {'n',1,8488,0,0}, {';',0,0,956,3}, {'w',2,8489,0,0}, {'o',1,8491,0,0}, {'a',1,8492,0,0}, {'h',1,8493,0,0},
+    {'t',1,8494,0,0}, {'g',1,8495,0,0}, {'e',1,8496,0,0}, {'s',1,8497,0,0}, {'e',1,8498,0,0}, {'l',1,8499,0,0},
+    {'i',1,8500,0,0}, {';',0,0,3655,3}, {'q',1,8501,0,0}, {'q',1,8502,0,0}, {'p',1,8503,0,0}, {'h',1,8504,0,0},
+    {';',0,0,1733,3}, {';',0,0,2852,3}, {'q',1,8505,0,0}, {'x',1,8506,0,0}, {'e',1,8507,0,0}, {'o',1,8508,0,0},
+    {';',0,0,1742,3}, {';',0,0,2858,3}, {'q',1,8509,0,0}, {';',0,0,3716,3}, {'o',1,8510,0,0}, {'o',1,8511,0,0},
+    {'e',1,8512,0,0}, {';',0,0,1773,3}, {'i',1,8513,0,0}, {'f',1,8514,0,0}, {'g',1,8515,0,0}, {'o',1,8516,0,0},
+    {'l',1,8517,0,0}, {'r',1,8518,0,0}, {'s',1,8519,0,0}, {'n',1,8520,0,0}, {'g',1,8521,0,0}, {';',0,0,1625,3},
+    {'n',1,8522,0,0}, {'n',1,8523,0,0}, {'l',1,8524,0,0}, {'i',1,8525,0,0}, {';',0,0,801,3}, {'f',1,8526,0,0},
+    {'s',1,8527,0,0}, {';',0,0,2666,3}, {'s',1,8528,0,0}, {'o',1,8529,0,0}, {'D',1,8530,0,0}, {'Q',1,8531,0,0},
+    {'e',1,8532,0,0}, {'c',1,8533,0,0}, {'l',4,8534,0,0}, {'a',1,8538,0,0}, {'o',1,8539,0,0}, {'A',1,8540,0,0},
+    {'A',1,8541,0,0}, {'R',1,8542,0,0}, {'T',1,8543,0,0}, {'L',1,8544,0,0}, {'R',1,8545,0,0}, {'t',2,8546,0,0},
+    {'r',1,8548,0,0}, {'w',1,8549,0,0}, {'i',1,8550,0,0}, {'a',1,8551,0,0}, {'p',1,8552,0,0}, {'g',1,8553,0,0},
+    {'e',1,8554,0,0}, {'c',1,8555,0,0}, {'e',1,8556,0,0}, {'e',1,8557,0,0}, {'o',1,8558,0,0}, {'S',1,8559,0,0},
+    {'m',1,8560,0,0}, {';',0,0,1259,3}, {'m',1,8561,0,0}, {'l',1,8562,0,0}, {'l',1,8563,0,0}, {'S',1,8564,0,0},
+    {';',0,0,850,3}, {'a',1,8565,0,0}, {'l',1,8566,0,0}, {'a',1,8567,0,0}, {'s',1,8568,0,0}, {'n',1,8569,0,0},
+    {'d',1,8570,0,0}, {'c',1,8571,0,0}, {'L',1,8572,0,0}, {'m',1,8573,0,0}, {';',0,0,82,3}, {'o',1,8574,0,0},
+    {'o',1,8575,0,0}, {'i',1,8576,0,0}, {';',0,0,920,3}, {'r',1,8577,0,0}, {'a',1,8578,0,0}, {'i',1,8579,0,0},
+    {'g',1,8580,0,0}, {'B',1,8581,0,0}, {'e',1,8582,0,0}, {'c',1,8583,0,0}, {'r',1,8584,0,0}, {'e',1,8585,0,0},
+    {'o',1,8586,0,0}, {'t',1,8587,0,0}, {'l',1,8588,0,0}, {'V',1,8589,0,0}, {'e',1,8590,0,0}, {'o',1,8591,0,0},
+    {';',0,0,2447,3}, {'B',1,8592,0,0}, {'r',1,8593,0,0}, {'r',1,8594,0,0}, {'u',1,8595,0,0}, {'r',1,8596,0,0},
+    {'q',1,8597,0,0}, {';',0,0,2408,3}, {'r',1,8598,0,0}, {'g',1,8599,0,0}, {'r',1,8600,0,0}, {'r',1,8601,0,0},
+    {'g',1,8602,0,0}, {'r',1,8603,0,0}, {'r',1,8604,0,0}, {'A',1,8605,0,0}, {'e',1,8606,0,0}, {'d',1,8607,0,0},
+    {'i',2,8608,0,0}, {'r',1,8610,0,0}, {'t',1,8611,0,0}, {'L',1,8612,0,0}, {'g',1,8613,0,0}, {'n',1,8614,0,0},
+    {'e',1,8615,0,0}, {';',0,0,2579,3}, {'l',1,8616,0,0}, {';',0,0,604,3}, {'E',1,8617,0,0}, {'F',1,8618,0,0},
+    {'G',1,8619,0,0}, {'L',1,8620,0,0}, {'S',1,8621,0,0}, {'T',1,8622,0,0}, {'n',1,8623,0,0}, {'a',1,8624,0,0},
+    {'a',1,8625,0,0}, {'a',1,8626,0,0}, {'a',1,8627,0,0}, {'s',1,8628,0,0}, {'n',1,8629,0,0}, {'d',1,8630,0,0},
+    {'r',1,8631,0,0}, {'e',1,8632,0,0}, {'s',3,8633,0,0}, {'E',1,8636,0,0}, {'i',1,8637,0,0}, {'u',2,8638,0,0},
+    {'q',1,8640,0,0}, {'s',4,8641,0,0}, {'t',2,8645,0,0}, {'u',1,8647,0,0}, {'l',1,8648,0,0}, {'l',1,8649,0,0},
+    {'l',1,8650,0,0}, {'o',1,8651,0,0}, {'u',1,8652,0,0}, {'t',1,8653,0,0}, {'h',1,8654,0,0}, {'a',1,8655,0,0},
+    {'u',1,8656,0,0}, {'a',1,8657,0,0}, {'l',1,8658,0,0}, {';',0,0,1901,3}, {'a',1,8659,0,0}, {'m',1,8660,0,0},
+    {'i',1,8661,0,0}, {'q',1,8662,0,0}, {'B',1,8663,0,0}, {';',0,0,1659,3}, {'B',1,8664,0,0}, {'L',1,8665,0,0},
+    {'n',1,8666,0,0}, {'e',1,8667,0,0}, {'e',1,8668,0,0}, {'e',1,8669,0,0}, {';',0,0,3604,3}, {'r',1,8670,0,0},
+    {'c',1,8671,0,0}, {'g',1,8672,0,0}, {'n',1,8673,0,0}, {'V',1,8674,0,0}, {'t',1,8675,0,0}, {'r',2,8676,0,0},
+    {';',0,0,1643,3}, {'e',1,8678,0,0}, {'w',1,8679,0,0}, {'d',1,8680,0,0}, {'r',1,8681,0,0}, {'r',1,8682,0,0},
+    {'A',1,8683,0,0}, {'o',1,8684,0,0}, {'e',1,8685,0,0}, {'r',1,8686,0,0}, {'e',1,8687,0,0}, {'r',1,8688,0,0},
+    {'n',1,8689,0,0}, {'l',1,8690,0,0}, {'u',1,8691,0,0}, {'a',1,8692,0,0}, {'l',1,8693,0,0}, {'u',1,8694,0,0},
+    {';',0,0,4219,6}, {';',0,0,1704,3}, {'q',1,8695,0,0}, {';',0,0,51,3}, {';',0,0,4225,3}, {'e',1,8696,0,0},
+    {'t',1,8697,0,0}, {';',0,0,4228,3}, {'n',1,8698,0,0}, {'w',1,8699,0,0}, {'i',1,8700,0,0}, {';',0,0,4156,3},
+    {'w',1,8701,0,0}, {'r',1,8702,0,0}, {'A',1,8703,0,0}, {'r',1,8704,0,0}, {'n',1,8705,0,0}, {'p',1,8706,0,0},
+    {'l',1,8707,0,0}, {'a',1,8708,0,0}, {'p',1,8709,0,0}, {'n',1,8710,0,0}, {'e',2,8711,0,0}, {'g',1,8713,0,0},
+    {'e',1,8714,0,0}, {'g',1,8715,0,0}, {'w',2,8716,0,0}, {';',0,0,1566,3}, {'c',1,8718,0,0}, {'h',1,8719,0,0},
+    {';',0,0,1170,3}, {'c',1,8720,0,0}, {'c',1,8721,0,0}, {';',0,0,2229,3}, {'l',1,8722,0,0}, {'r',1,8723,0,0},
+    {'t',1,8724,0,0}, {'m',1,8725,0,0}, {'e',1,8726,0,0}, {'r',1,8727,0,0}, {'n',2,8728,0,0}, {';',0,0,426,3},
+    {'s',1,8730,0,0}, {'n',1,8731,0,0}, {'l',1,8732,0,0}, {'s',1,8733,0,0}, {';',0,0,447,3}, {'r',1,8734,0,0},
+    {'r',1,8735,0,0}, {'a',1,8736,0,0}, {'n',2,8737,0,0}, {'r',1,8739,0,0}, {'r',1,8740,0,0}, {'a',1,8741,0,0},
+    {'q',1,8742,0,0}, {'i',1,8743,0,0}, {';',0,0,513,3}, {';',0,0,510,3}, {';',0,0,3397,3}, {'r',1,8744,0,0},
+    {'g',1,8745,0,0}, {';',0,0,1838,3}, {'r',1,8746,0,0}, {'e',1,8747,0,0}, {'i',1,8748,0,0}, {';',0,0,4231,3},
+    {';',0,0,4234,3}, {'g',1,8749,0,0}, {';',0,0,2567,3}, {'a',1,8750,0,0}, {'w',1,8751,0,0}, {';',0,0,2570,3},
+    {'a',1,8752,0,0}, {'w',1,8753,0,0}, {'l',1,8754,0,0}, {';',0,0,2602,5}, {';',0,0,2610,5}, {'e',1,8755,0,0},
+    {'i',1,8756,0,0}, {';',0,0,1616,3}, {'q',1,8757,0,0}, {'x',1,8758,0,0}, {'s',1,8759,0,0}, {';',0,0,1659,3},
+    {'t',1,8760,0,0}, {'o',1,8761,0,0}, {'r',1,8762,0,0}, {'a',1,8763,0,0}, {'a',1,8764,0,0}, {'a',1,8765,0,0},
+    {'t',1,8766,0,0}, {'e',1,8767,0,0}, {';',0,0,3610,3}, {'l',1,8768,0,0}, {'n',1,8769,0,0}, {';',0,0,3670,3},
+    {';',0,0,3673,3}, {'s',1,8770,0,0}, {'i',1,8771,0,0}, {';',0,0,2849,3}, {';',0,0,1689,3}, {'q',1,8772,0,0},
+    {'x',1,8773,0,0}, {';',0,0,2855,3}, {'x',1,8774,0,0}, {'w',1,8775,0,0}, {'f',1,8776,0,0}, {'g',1,8777,0,0},
+    {'t',1,8778,0,0}, {'h',1,8779,0,0}, {'w',1,8780,0,0}, {'e',1,8781,0,0}, {'i',1,8782,0,0}, {';',0,0,2921,3},
+    {';',0,0,2292,2}, {';',0,0,2284,3}, {'e',1,8783,0,0}, {'e',1,8784,0,0}, {'e',2,8785,0,0}, {'o',1,8787,0,0},
+    {'e',1,8788,0,0}, {';',0,0,3536,3}, {';',0,0,3542,3}, {'n',1,8789,0,0}, {'o',1,8790,0,0}, {'u',1,8791,0,0},
+    {'g',1,8792,0,0}, {'k',1,8793,0,0}, {'A',1,8794,0,0}, {'D',1,8795,0,0}, {'G',1,8796,0,0}, {'T',1,8797,0,0},
+    {'l',1,8798,0,0}, {'u',1,8799,0,0}, {'r',1,8800,0,0}, {'r',1,8801,0,0}, {'i',1,8802,0,0}, {'e',1,8803,0,0},
+    {'e',1,8804,0,0}, {'i',1,8805,0,0}, {'A',1,8806,0,0}, {'T',1,8807,0,0}, {'o',1,8808,0,0}, {'n',1,8809,0,0},
+    {'c',1,8810,0,0}, {'r',1,8811,0,0}, {'A',1,8812,0,0}, {'h',1,8813,0,0}, {'V',1,8814,0,0}, {'t',1,8815,0,0},
+    {'e',1,8816,0,0}, {'c',1,8817,0,0}, {'w',1,8818,0,0}, {'q',1,8819,0,0}, {'a',1,8820,0,0}, {';',0,0,2752,3},
+    {'E',1,8821,0,0}, {'S',1,8822,0,0}, {'m',1,8823,0,0}, {'l',2,8824,0,0}, {'E',1,8826,0,0}, {'t',1,8827,0,0},
+    {';',0,0,76,3}, {'t',1,8828,0,0}, {'e',1,8829,0,0}, {'e',1,8830,0,0}, {'i',1,8831,0,0}, {'p',1,8832,0,0},
+    {'n',1,8833,0,0}, {'m',1,8834,0,0}, {'m',1,8835,0,0}, {'a',1,8836,0,0}, {'r',1,8837,0,0}, {'g',1,8838,0,0},
+    {';',0,0,2435,3}, {'r',1,8839,0,0}, {'V',1,8840,0,0}, {'t',1,8841,0,0}, {'r',1,8842,0,0}, {'c',1,8843,0,0},
+    {'w',1,8844,0,0}, {'o',1,8845,0,0}, {'e',3,8846,0,0}, {'e',1,8849,0,0}, {'c',1,8850,0,0}, {'r',2,8851,0,0},
+    {'a',1,8853,0,0}, {'r',1,8854,0,0}, {'e',1,8855,0,0}, {'a',1,8856,0,0}, {';',0,0,97,3}, {'u',1,8857,0,0},
+    {'o',1,8858,0,0}, {'h',1,8859,0,0}, {'r',1,8860,0,0}, {'o',1,8861,0,0}, {'h',1,8862,0,0}, {'r',1,8863,0,0},
+    {'r',1,8864,0,0}, {'r',1,8865,0,0}, {';',0,0,4237,3}, {'i',1,8866,0,0}, {'c',1,8867,0,0}, {'n',1,8868,0,0},
+    {'y',1,8869,0,0}, {'e',1,8870,0,0}, {'e',1,8871,0,0}, {'S',1,8872,0,0}, {'t',1,8873,0,0}, {'r',1,8874,0,0},
+    {'d',1,8875,0,0}, {'q',1,8876,0,0}, {'u',1,8877,0,0}, {'r',1,8878,0,0}, {'e',1,8879,0,0}, {'l',1,8880,0,0},
+    {'i',1,8881,0,0}, {'H',1,8882,0,0}, {'l',1,8883,0,0}, {'n',1,8884,0,0}, {'l',1,8885,0,0}, {'t',1,8886,0,0},
+    {';',0,0,1461,5}, {'t',1,8887,0,0}, {'e',1,8888,0,0}, {'e',1,8889,0,0}, {'s',1,8890,0,0}, {';',0,0,621,3},
+    {'E',1,8891,0,0}, {'S',1,8892,0,0}, {'l',1,8893,0,0}, {'a',1,8894,0,0}, {'b',1,8895,0,0}, {'p',1,8896,0,0},
+    {'u',1,8897,0,0}, {';',0,0,624,3}, {'E',1,8898,0,0}, {'S',1,8899,0,0}, {'T',1,8900,0,0}, {';',0,0,2945,6},
+    {'E',1,8901,0,0}, {'a',1,8902,0,0}, {'l',1,8903,0,0}, {'d',1,8904,0,0}, {'B',1,8905,0,0}, {'u',1,8906,0,0},
+    {'o',1,8907,0,0}, {';',0,0,1750,3}, {'e',1,8908,0,0}, {'n',1,8909,0,0}, {'a',1,8910,0,0}, {'n',1,8911,0,0},
+    {'d',1,8912,0,0}, {'l',1,8913,0,0}, {'e',1,8914,0,0}, {'l',1,8915,0,0}, {'u',1,8916,0,0}, {'r',1,8917,0,0},
+    {'a',1,8918,0,0}, {'e',1,8919,0,0}, {'g',1,8920,0,0}, {'B',1,8921,0,0}, {'e',1,8922,0,0}, {'c',1,8923,0,0},
+    {'o',1,8924,0,0}, {'t',1,8925,0,0}, {'l',1,8926,0,0}, {'V',1,8927,0,0}, {'e',1,8928,0,0}, {'o',1,8929,0,0},
+    {';',0,0,2746,3}, {'B',1,8930,0,0}, {'s',1,8931,0,0}, {';',0,0,2704,3}, {';',0,0,4240,3}, {'r',1,8932,0,0},
+    {'r',1,8933,0,0}, {'r',1,8934,0,0}, {'w',1,8935,0,0}, {';',0,0,3158,3}, {'s',1,8936,0,0}, {'t',2,8937,0,0},
+    {'s',1,8939,0,0}, {';',0,0,2837,3}, {';',0,0,1736,3}, {'a',1,8940,0,0}, {'n',1,8941,0,0}, {'d',1,8942,0,0},
+    {'a',1,8943,0,0}, {'u',1,8944,0,0}, {'t',1,8945,0,0}, {'h',1,8946,0,0}, {'A',1,8947,0,0}, {';',0,0,1812,3},
+    {'u',1,8948,0,0}, {';',0,0,1806,3}, {'r',1,8949,0,0}, {'r',1,8950,0,0}, {';',0,0,560,3}, {'e',1,8951,0,0},
+    {'a',1,8952,0,0}, {'d',1,8953,0,0}, {'c',1,8954,0,0}, {'a',1,8955,0,0}, {';',0,0,2037,2}, {'d',1,8956,0,0},
+    {'u',1,8957,0,0}, {'e',1,8958,0,0}, {';',0,0,1723,3}, {'l',1,8959,0,0}, {'l',1,8960,0,0}, {'r',1,8961,0,0},
+    {';',0,0,1569,3}, {';',0,0,2637,3}, {';',0,0,2215,3}, {';',0,0,2218,3}, {'e',1,8962,0,0}, {'i',1,8963,0,0},
+    {';',0,0,2251,3}, {'e',1,8964,0,0}, {'d',1,8965,0,0}, {'o',1,8966,0,0}, {'l',1,8967,0,0}, {'r',1,8968,0,0},
+    {';',0,0,432,3}, {';',0,0,840,3}, {'e',1,8969,0,0}, {'e',1,8970,0,0}, {'o',1,8971,0,0}, {'r',1,8972,0,0},
+    {'i',1,8973,0,0}, {'d',1,8974,0,0}, {'u',1,8975,0,0}, {'o',1,8976,0,0}, {'r',1,8977,0,0}, {'r',1,8978,0,0},
+    {'u',1,8979,0,0}, {'m',1,8980,0,0}, {'o',1,8981,0,0}, {'h',1,8982,0,0}, {'r',1,8983,0,0}, {'f',1,8984,0,0},
+    {'g',1,8985,0,0}, {'l',1,8986,0,0}, {'r',1,8987,0,0}, {';',0,0,2590,3}, {'r',1,8988,0,0}, {';',0,0,2593,3},
+    {'l',1,8989,0,0}, {'f',1,8990,0,0}, {'g',1,8991,0,0}, {';',0,0,2691,3}, {';',0,0,2697,3}, {';',0,0,865,3},
+    {'a',1,8992,0,0}, {'n',2,8993,0,0}, {'r',1,8995,0,0}, {'r',1,8996,0,0}, {'r',1,8997,0,0}, {'r',1,8998,0,0},
+    {'i',1,8999,0,0}, {'q',1,9000,0,0}, {'e',1,9001,0,0}, {'u',1,9002,0,0}, {'i',1,9003,0,0}, {';',0,0,1607,2},
+    {';',0,0,2785,3}, {';',0,0,2790,3}, {';',0,0,51,3}, {'n',1,9004,0,0}, {'t',2,9005,0,0}, {'h',1,9007,0,0},
+    {'a',1,9008,0,0}, {'t',1,9009,0,0}, {';',0,0,1812,3}, {'f',1,9010,0,0}, {'g',1,9011,0,0}, {'q',2,9012,0,0},
+    {'q',2,9014,0,0}, {'l',1,9016,0,0}, {'r',1,9017,0,0}, {'n',1,9018,0,0}, {'r',1,9019,0,0}, {'t',1,9020,0,0},
+    {'u',1,9021,0,0}, {'o',1,9022,0,0}, {'r',1,9023,0,0}, {'w',1,9024,0,0}, {'c',1,9025,0,0}, {'o',2,9026,0,0},
+    {'r',1,9028,0,0}, {'i',1,9029,0,0}, {'D',1,9030,0,0}, {'r',1,9031,0,0}, {'r',1,9032,0,0}, {'r',1,9033,0,0},
+    {'g',1,9034,0,0}, {'e',1,9035,0,0}, {'f',1,9036,0,0}, {'g',1,9037,0,0}, {'r',1,9038,0,0}, {'e',1,9039,0,0},
+    {'w',1,9040,0,0}, {'A',1,9041,0,0}, {'a',1,9042,0,0}, {';',0,0,4243,3}, {'r',1,9043,0,0}, {'t',1,9044,0,0},
+    {'e',1,9045,0,0}, {'o',1,9046,0,0}, {'V',1,9047,0,0}, {'t',1,9048,0,0}, {';',0,0,4231,3}, {'u',1,9049,0,0},
+    {'l',1,9050,0,0}, {';',0,0,59,3}, {'q',1,9051,0,0}, {'a',1,9052,0,0}, {';',0,0,73,3}, {'L',1,9053,0,0},
+    {'q',1,9054,0,0}, {'e',1,9055,0,0}, {'E',1,9056,0,0}, {';',0,0,1302,3}, {';',0,0,868,3}, {'n',1,9057,0,0},
+    {';',0,0,1147,3}, {';',0,0,1832,3}, {'m',1,9058,0,0}, {'e',1,9059,0,0}, {'c',1,9060,0,0}, {';',0,0,2417,3},
+    {'h',1,9061,0,0}, {'a',1,9062,0,0}, {'e',1,9063,0,0}, {'o',1,9064,0,0}, {'o',1,9065,0,0}, {'t',1,9066,0,0},
+    {';',0,0,4234,3}, {'r',1,9067,0,0}, {';',0,0,2936,3}, {'B',1,9068,0,0}, {'E',1,9069,0,0}, {'c',1,9070,0,0},
+    {'t',1,9071,0,0}, {';',0,0,2891,3}, {'B',1,9072,0,0}, {'r',1,9073,0,0}, {'o',1,9074,0,0}, {'a',1,9075,0,0},
+    {'l',1,9076,0,0}, {'a',1,9077,0,0}, {'w',1,9078,0,0}, {'t',1,9079,0,0}, {'o',1,9080,0,0}, {'w',1,9081,0,0},
+    {'t',1,9082,0,0}, {'o',1,9083,0,0}, {'o',1,9084,0,0}, {'r',1,9085,0,0}, {'u',1,9086,0,0}, {'k',1,9087,0,0},
+    {'S',1,9088,0,0}, {'T',1,9089,0,0}, {'r',1,9090,0,0}, {'s',1,9091,0,0}, {'p',1,9092,0,0}, {';',0,0,3468,3},
+    {'t',1,9093,0,0}, {'e',1,9094,0,0}, {'u',1,9095,0,0}, {'l',1,9096,0,0}, {'e',1,9097,0,0}, {'s',1,9098,0,0},
+    {'a',1,9099,0,0}, {'l',1,9100,0,0}, {'u',1,9101,0,0}, {';',0,0,3456,5}, {'g',1,9102,0,0}, {';',0,0,615,3},
+    {'e',1,9103,0,0}, {'E',1,9104,0,0}, {';',0,0,2573,3}, {'a',1,9105,0,0}, {'s',1,9106,0,0}, {'q',1,9107,0,0},
+    {'l',1,9108,0,0}, {'e',1,9109,0,0}, {'n',1,9110,0,0}, {'s',1,9111,0,0}, {'e',1,9112,0,0}, {'a',1,9113,0,0},
+    {'q',1,9114,0,0}, {'l',1,9115,0,0}, {'i',1,9116,0,0}, {'q',1,9117,0,0}, {'l',1,9118,0,0}, {'E',1,9119,0,0},
+    {'e',1,9120,0,0}, {'a',1,9121,0,0}, {'b',1,9122,0,0}, {'t',1,9123,0,0}, {'s',1,9124,0,0}, {'e',1,9125,0,0},
+    {'l',1,9126,0,0}, {'t',1,9127,0,0}, {'e',1,9128,0,0}, {';',0,0,1625,3}, {'n',1,9129,0,0}, {'i',1,9130,0,0},
+    {'i',1,9131,0,0}, {'a',1,9132,0,0}, {'r',1,9133,0,0}, {'f',1,9134,0,0}, {';',0,0,2737,3}, {'r',1,9135,0,0},
+    {'V',1,9136,0,0}, {'t',1,9137,0,0}, {'w',1,9138,0,0}, {'o',1,9139,0,0}, {'e',3,9140,0,0}, {'e',1,9143,0,0},
+    {'c',1,9144,0,0}, {'r',2,9145,0,0}, {'a',1,9147,0,0}, {';',0,0,4246,3}, {'o',1,9148,0,0}, {'o',1,9149,0,0},
+    {'r',1,9150,0,0}, {';',0,0,1788,3}, {'e',1,9151,0,0}, {';',0,0,2840,3}, {'E',1,9152,0,0}, {'e',1,9153,0,0},
+    {'l',1,9154,0,0}, {'t',1,9155,0,0}, {'e',1,9156,0,0}, {'l',1,9157,0,0}, {'a',1,9158,0,0}, {';',0,0,1109,3},
+    {'e',1,9159,0,0}, {'r',1,9160,0,0}, {'m',1,9161,0,0}, {'o',1,9162,0,0}, {'r',1,9163,0,0}, {';',0,0,1815,1},
+    {'r',1,9164,0,0}, {'e',1,9165,0,0}, {'e',1,9166,0,0}, {'c',1,9167,0,0}, {'o',1,9168,0,0}, {'p',1,9169,0,0},
+    {';',0,0,1410,3}, {'e',4,9170,0,0}, {'e',1,9174,0,0}, {'i',1,9175,0,0}, {'f',1,9176,0,0}, {'g',1,9177,0,0},
+    {'s',1,9178,0,0}, {'g',1,9179,0,0}, {'w',1,9180,0,0}, {'e',1,9181,0,0}, {'i',1,9182,0,0}, {';',0,0,59,3},
+    {'q',1,9183,0,0}, {'w',1,9184,0,0}, {'o',1,9185,0,0}, {'l',1,9186,0,0}, {'o',1,9187,0,0}, {'p',1,9188,0,0},
+    {'w',1,9189,0,0}, {'o',1,9190,0,0}, {'p',1,9191,0,0}, {'i',1,9192,0,0}, {'e',1,9193,0,0}, {'w',1,9194,0,0},
+    {'t',1,9195,0,0}, {'o',1,9196,0,0}, {'t',1,9197,0,0}, {'h',1,9198,0,0}, {'e',1,9199,0,0}, {'r',1,9200,0,0},
+    {'r',1,9201,0,0}, {'e',1,9202,0,0}, {'t',2,9203,0,0}, {'h',1,9205,0,0}, {'i',1,9206,0,0}, {'d',1,9207,0,0},
+    {'u',1,9208,0,0}, {'o',1,9209,0,0}, {'p',1,9210,0,0}, {'r',1,9211,0,0}, {'r',1,9212,0,0}, {'m',1,9213,0,0},
+    {';',0,0,2297,3}, {'l',1,9214,0,0}, {'s',1,9215,0,0}, {'l',1,9216,0,0}, {';',0,0,1226,3}, {';',0,0,1425,3},
+    {'e',1,9217,0,0}, {'t',2,9218,0,0}, {'r',1,9220,0,0}, {'a',1,9221,0,0}, {'t',1,9222,0,0}, {'h',1,9223,0,0},
+    {';',0,0,3780,6}, {'q',1,9224,0,0}, {';',0,0,3792,6}, {'q',1,9225,0,0}, {'e',1,9226,0,0}, {'i',1,9227,0,0},
+    {';',0,0,48,3}, {'e',1,9228,0,0}, {'o',1,9229,0,0}, {'b',1,9230,0,0}, {'t',1,9231,0,0}, {'a',1,9232,0,0},
+    {'i',1,9233,0,0}, {'u',1,9234,0,0}, {'t',1,9235,0,0}, {'u',1,9236,0,0}, {'a',1,9237,0,0}, {'l',1,9238,0,0},
+    {';',0,0,54,3}, {'I',1,9239,0,0}, {'o',1,9240,0,0}, {'o',1,9241,0,0}, {'h',1,9242,0,0}, {';',0,0,1907,3},
+    {'t',2,9243,0,0}, {'h',1,9245,0,0}, {'r',1,9246,0,0}, {'e',1,9247,0,0}, {';',0,0,1782,3}, {'r',1,9248,0,0},
+    {'l',1,9249,0,0}, {'r',1,9250,0,0}, {'V',1,9251,0,0}, {'c',1,9252,0,0}, {'r',2,9253,0,0}, {'e',1,9255,0,0},
+    {'o',1,9256,0,0}, {'a',1,9257,0,0}, {'l',1,9258,0,0}, {'u',1,9259,0,0}, {'l',1,9260,0,0}, {'e',1,9261,0,0},
+    {'u',1,9262,0,0}, {'r',1,9263,0,0}, {'q',1,9264,0,0}, {'e',1,9265,0,0}, {'a',1,9266,0,0}, {'s',1,9267,0,0},
+    {'k',1,9268,0,0}, {'t',1,9269,0,0}, {'c',1,9270,0,0}, {'c',1,9271,0,0}, {'r',2,9272,0,0}, {'w',1,9274,0,0},
+    {'o',1,9275,0,0}, {';',0,0,4249,3}, {'a',1,9276,0,0}, {'q',1,9277,0,0}, {'t',1,9278,0,0}, {'o',1,9279,0,0},
+    {'a',1,9280,0,0}, {';',0,0,4252,3}, {'w',1,9281,0,0}, {'t',1,9282,0,0}, {';',0,0,91,3}, {'l',1,9283,0,0},
+    {';',0,0,2971,3}, {'A',1,9284,0,0}, {'w',1,9285,0,0}, {';',0,0,2968,3}, {'a',1,9286,0,0}, {'w',1,9287,0,0},
+    {'w',1,9288,0,0}, {'o',1,9289,0,0}, {'m',1,9290,0,0}, {'S',1,9291,0,0}, {'p',1,9292,0,0}, {'h',1,9293,0,0},
+    {'G',1,9294,0,0}, {'s',1,9295,0,0}, {'a',1,9296,0,0}, {'i',1,9297,0,0}, {';',0,0,2550,5}, {'a',1,9298,0,0},
+    {'l',1,9299,0,0}, {'a',1,9300,0,0}, {'s',1,9301,0,0}, {'n',1,9302,0,0}, {'d',1,9303,0,0}, {'m',1,9304,0,0},
+    {'l',1,9305,0,0}, {'r',1,9306,0,0}, {'q',1,9307,0,0}, {'t',1,9308,0,0}, {'L',1,9309,0,0}, {'u',1,9310,0,0},
+    {'a',1,9311,0,0}, {'m',1,9312,0,0}, {'g',1,9313,0,0}, {'e',1,9314,0,0}, {'r',1,9315,0,0}, {'l',1,9316,0,0},
+    {'u',1,9317,0,0}, {'a',1,9318,0,0}, {'l',1,9319,0,0}, {'u',1,9320,0,0}, {';',0,0,2599,3}, {'q',1,9321,0,0},
+    {';',0,0,585,3}, {'r',1,9322,0,0}, {'l',1,9323,0,0}, {'e',1,9324,0,0}, {'i',1,9325,0,0}, {';',0,0,212,3},
+    {';',0,0,672,3}, {'E',1,9326,0,0}, {';',0,0,2700,3}, {'t',1,9327,0,0}, {'b',1,9328,0,0}, {'l',1,9329,0,0},
+    {'c',1,9330,0,0}, {';',0,0,2716,3}, {'t',1,9331,0,0}, {'a',1,9332,0,0}, {'e',1,9333,0,0}, {'o',1,9334,0,0},
+    {';',0,0,548,3}, {'r',1,9335,0,0}, {';',0,0,2951,3}, {'B',1,9336,0,0}, {'E',1,9337,0,0}, {'c',1,9338,0,0},
+    {'t',1,9339,0,0}, {';',0,0,2894,3}, {'B',1,9340,0,0}, {'r',1,9341,0,0}, {'w',1,9342,0,0}, {'w',1,9343,0,0},
+    {'o',1,9344,0,0}, {'c',1,9345,0,0}, {'q',1,9346,0,0}, {'t',2,9347,0,0}, {';',0,0,695,3}, {'E',1,9349,0,0},
+    {';',0,0,2793,3}, {';',0,0,1745,3}, {'l',1,9350,0,0}, {'s',1,9351,0,0}, {'r',1,9352,0,0}, {';',0,0,2886,3},
+    {'w',1,9353,0,0}, {'o',1,9354,0,0}, {'a',1,9355,0,0}, {';',0,0,141,3}, {';',0,0,3304,3}, {'e',1,9356,0,0},
+    {'w',1,9357,0,0}, {';',0,0,2983,3}, {';',0,0,2918,3}, {'d',1,9358,0,0}, {'l',1,9359,0,0}, {'r',1,9360,0,0},
+    {'f',1,9361,0,0}, {'g',1,9362,0,0}, {'t',1,9363,0,0}, {'h',1,9364,0,0}, {';',0,0,3196,3}, {'e',1,9365,0,0},
+    {'s',1,9366,0,0}, {'f',1,9367,0,0}, {'g',1,9368,0,0}, {';',0,0,2277,3}, {';',0,0,3358,3}, {'w',1,9369,0,0},
+    {';',0,0,3367,3}, {'w',1,9370,0,0}, {';',0,0,2447,3}, {'s',1,9371,0,0}, {'w',2,9372,0,0}, {'o',1,9374,0,0},
+    {'g',1,9375,0,0}, {'s',1,9376,0,0}, {';',0,0,2971,3}, {'a',1,9377,0,0}, {'w',1,9378,0,0}, {';',0,0,3361,3},
+    {'t',1,9379,0,0}, {';',0,0,3111,3}, {'o',1,9380,0,0}, {'o',1,9381,0,0}, {'l',1,9382,0,0}, {';',0,0,2576,3},
+    {'e',1,9383,0,0}, {'t',2,9384,0,0}, {'l',1,9386,0,0}, {'o',1,9387,0,0}, {'p',1,9388,0,0}, {'w',1,9389,0,0},
+    {'o',1,9390,0,0}, {'o',1,9391,0,0}, {'o',1,9392,0,0}, {'e',1,9393,0,0}, {';',0,0,654,3}, {';',0,0,2808,3},
+    {'o',1,9394,0,0}, {'q',1,9395,0,0}, {';',0,0,1686,3}, {'e',1,9396,0,0}, {'r',1,9397,0,0}, {'r',1,9398,0,0},
+    {';',0,0,2891,3}, {'t',1,9399,0,0}, {';',0,0,3774,6}, {';',0,0,3786,6}, {'f',1,9400,0,0}, {'g',1,9401,0,0},
+    {'n',1,9402,0,0}, {'u',1,9403,0,0}, {'l',1,9404,0,0}, {'e',1,9405,0,0}, {'l',1,9406,0,0}, {'s',1,9407,0,0},
+    {'t',1,9408,0,0}, {';',0,0,418,2}, {'b',1,9409,0,0}, {'v',1,9410,0,0}, {'d',1,9411,0,0}, {'n',1,9412,0,0},
+    {'w',1,9413,0,0}, {'w',1,9414,0,0}, {'t',1,9415,0,0}, {'A',1,9416,0,0}, {'R',1,9417,0,0}, {'t',1,9418,0,0},
+    {'o',1,9419,0,0}, {';',0,0,2927,3}, {'r',1,9420,0,0}, {'B',1,9421,0,0}, {'o',1,9422,0,0}, {'e',1,9423,0,0},
+    {'t',1,9424,0,0}, {';',0,0,2444,3}, {'B',1,9425,0,0}, {'c',1,9426,0,0}, {'r',2,9427,0,0}, {'r',1,9429,0,0},
+    {'S',1,9430,0,0}, {'a',1,9431,0,0}, {'l',1,9432,0,0}, {'s',1,9433,0,0}, {'a',1,9434,0,0}, {';',0,0,4255,3},
+    {'u',1,9435,0,0}, {';',0,0,1130,3}, {';',0,0,79,3}, {';',0,0,88,3}, {'e',1,9436,0,0}, {'A',1,9437,0,0},
+    {'k',1,9438,0,0}, {'t',1,9439,0,0}, {';',0,0,2245,3}, {'B',1,9440,0,0}, {';',0,0,1316,3}, {'r',1,9441,0,0},
+    {'r',1,9442,0,0}, {'u',1,9443,0,0}, {'o',1,9444,0,0}, {'r',1,9445,0,0}, {'r',1,9446,0,0}, {';',0,0,486,3},
+    {'e',1,9447,0,0}, {';',0,0,524,3}, {'r',1,9448,0,0}, {';',0,0,2980,3}, {'r',1,9449,0,0}, {';',0,0,2977,3},
+    {';',0,0,2864,3}, {'w',1,9450,0,0}, {'S',1,9451,0,0}, {'p',1,9452,0,0}, {'a',1,9453,0,0}, {'i',1,9454,0,0},
+    {'r',1,9455,0,0}, {';',0,0,20,3}, {'c',1,9456,0,0}, {'c',1,9457,0,0}, {'l',1,9458,0,0}, {'E',1,9459,0,0},
+    {'t',1,9460,0,0}, {';',0,0,1534,3}, {'t',1,9461,0,0}, {'e',1,9462,0,0}, {'p',1,9463,0,0}, {'e',3,9464,0,0},
+    {';',0,0,1537,3}, {'u',1,9467,0,0}, {'e',1,9468,0,0}, {'e',1,9469,0,0}, {'a',1,9470,0,0}, {'n',1,9471,0,0},
+    {'e',1,9472,0,0}, {'l',1,9473,0,0}, {'t',2,9474,0,0}, {'s',1,9476,0,0}, {';',0,0,2607,3}, {'a',1,9477,0,0},
+    {'n',1,9478,0,0}, {'d',1,9479,0,0}, {'a',1,9480,0,0}, {'u',1,9481,0,0}, {';',0,0,1501,3}, {'e',1,9482,0,0},
+    {';',0,0,2489,3}, {'s',1,9483,0,0}, {'q',1,9484,0,0}, {';',0,0,108,3}, {'r',1,9485,0,0}, {'i',1,9486,0,0},
+    {'k',1,9487,0,0}, {'A',1,9488,0,0}, {'c',1,9489,0,0}, {'c',1,9490,0,0}, {'r',2,9491,0,0}, {';',0,0,4258,3},
+    {'a',1,9493,0,0}, {'q',1,9494,0,0}, {'t',1,9495,0,0}, {'o',1,9496,0,0}, {'a',1,9497,0,0}, {';',0,0,4261,3},
+    {';',0,0,1202,3}, {';',0,0,1382,3}, {'w',1,9498,0,0}, {'t',1,9499,0,0}, {'u',1,9500,0,0}, {';',0,0,2843,3},
+    {'E',1,9501,0,0}, {'q',1,9502,0,0}, {';',0,0,1173,3}, {'i',1,9503,0,0}, {'o',1,9504,0,0}, {';',0,0,2632,3},
+    {'w',1,9505,0,0}, {'t',1,9506,0,0}, {';',0,0,4264,3}, {'n',1,9507,0,0}, {'o',1,9508,0,0}, {'e',1,9509,0,0},
+    {'i',1,9510,0,0}, {'t',1,9511,0,0}, {'h',1,9512,0,0}, {';',0,0,3167,3}, {'t',1,9513,0,0}, {';',0,0,2995,3},
+    {';',0,0,2240,3}, {'t',1,9514,0,0}, {'h',1,9515,0,0}, {';',0,0,3582,3}, {'n',1,9516,0,0}, {';',0,0,2453,3},
+    {';',0,0,1316,3}, {'s',1,9517,0,0}, {'o',1,9518,0,0}, {'a',1,9519,0,0}, {';',0,0,3418,3}, {'r',1,9520,0,0},
+    {';',0,0,2980,3}, {';',0,0,3585,3}, {'w',1,9521,0,0}, {'w',1,9522,0,0}, {';',0,0,1508,3}, {'q',1,9523,0,0},
+    {';',0,0,2596,3}, {'e',1,9524,0,0}, {';',0,0,3591,3}, {'w',1,9525,0,0}, {';',0,0,2746,3}, {'s',1,9526,0,0},
+    {'o',1,9527,0,0}, {'w',1,9528,0,0}, {'w',1,9529,0,0}, {'s',1,9530,0,0}, {'n',1,9531,0,0}, {';',0,0,2498,3},
+    {'q',1,9532,0,0}, {'o',1,9533,0,0}, {'r',1,9534,0,0}, {';',0,0,2894,3}, {'t',1,9535,0,0}, {'h',1,9536,0,0},
+    {'t',1,9537,0,0}, {'r',1,9538,0,0}, {'e',1,9539,0,0}, {';',0,0,2773,3}, {';',0,0,1582,3}, {'e',1,9540,0,0},
+    {'e',1,9541,0,0}, {'l',1,9542,0,0}, {'e',1,9543,0,0}, {'e',1,9544,0,0}, {'t',1,9545,0,0}, {';',0,0,1196,3},
+    {';',0,0,1371,3}, {'A',1,9546,0,0}, {'r',1,9547,0,0}, {'i',1,9548,0,0}, {'A',1,9549,0,0}, {'w',1,9550,0,0},
+    {'o',1,9551,0,0}, {'a',1,9552,0,0}, {'w',1,9553,0,0}, {'c',1,9554,0,0}, {'o',1,9555,0,0}, {'a',1,9556,0,0},
+    {'t',1,9557,0,0}, {';',0,0,2743,3}, {'B',1,9558,0,0}, {'e',1,9559,0,0}, {'q',1,9560,0,0}, {'r',1,9561,0,0},
+    {'S',1,9562,0,0}, {'s',1,9563,0,0}, {'l',1,9564,0,0}, {'a',1,9565,0,0}, {'t',1,9566,0,0}, {'r',1,9567,0,0},
+    {'e',1,9568,0,0}, {'o',1,9569,0,0}, {'a',1,9570,0,0}, {';',0,0,4267,3}, {';',0,0,4270,3}, {'a',1,9571,0,0},
+    {'r',1,9572,0,0}, {';',0,0,4273,3}, {';',0,0,4276,3}, {'r',1,9573,0,0}, {'r',1,9574,0,0}, {'r',1,9575,0,0},
+    {';',0,0,2805,3}, {'p',1,9576,0,0}, {'a',1,9577,0,0}, {'c',1,9578,0,0}, {'n',1,9579,0,0}, {'e',1,9580,0,0},
+    {'e',1,9581,0,0}, {'a',1,9582,0,0}, {';',0,0,601,3}, {'q',1,9583,0,0}, {'e',1,9584,0,0}, {'E',1,9585,0,0},
+    {';',0,0,2555,3}, {';',0,0,2528,5}, {';',0,0,2576,3}, {'B',1,9586,0,0}, {'E',1,9587,0,0}, {'a',1,9588,0,0},
+    {'r',1,9589,0,0}, {'s',1,9590,0,0}, {'l',1,9591,0,0}, {'t',1,9592,0,0}, {'n',1,9593,0,0}, {'e',3,9594,0,0},
+    {';',0,0,4279,5}, {'E',1,9597,0,0}, {'e',1,9598,0,0}, {'l',1,9599,0,0}, {'t',1,9600,0,0}, {'e',1,9601,0,0},
+    {'l',1,9602,0,0}, {'a',1,9603,0,0}, {'Q',1,9604,0,0}, {';',0,0,4284,3}, {'u',1,9605,0,0}, {'i',1,9606,0,0},
+    {'b',1,9607,0,0}, {'e',1,9608,0,0}, {'r',1,9609,0,0}, {'k',1,9610,0,0}, {'t',1,9611,0,0}, {';',0,0,2248,3},
+    {'B',1,9612,0,0}, {'r',1,9613,0,0}, {'u',1,9614,0,0}, {'o',1,9615,0,0}, {'r',1,9616,0,0}, {'r',1,9617,0,0},
+    {';',0,0,1659,3}, {'i',1,9618,0,0}, {'a',1,9619,0,0}, {'q',1,9620,0,0}, {'u',1,9621,0,0}, {'s',1,9622,0,0},
+    {'w',1,9623,0,0}, {';',0,0,2542,3}, {'o',1,9624,0,0}, {';',0,0,2959,3}, {'w',1,9625,0,0}, {'f',1,9626,0,0},
+    {'g',1,9627,0,0}, {';',0,0,2650,3}, {'t',1,9628,0,0}, {';',0,0,3179,3}, {';',0,0,2245,3}, {'t',1,9629,0,0},
+    {';',0,0,2444,3}, {';',0,0,2474,3}, {'n',1,9630,0,0}, {'r',1,9631,0,0}, {'r',1,9632,0,0}, {';',0,0,2558,3},
+    {';',0,0,2561,3}, {';',0,0,3474,3}, {'q',1,9633,0,0}, {'n',1,9634,0,0}, {';',0,0,2749,3}, {'n',1,9635,0,0},
+    {'s',1,9636,0,0}, {';',0,0,2722,3}, {';',0,0,3622,3}, {';',0,0,2292,2}, {';',0,0,2776,3}, {'w',1,9637,0,0},
+    {'o',1,9638,0,0}, {';',0,0,2936,3}, {'t',1,9639,0,0}, {'i',1,9640,0,0}, {'I',1,9641,0,0}, {'Q',1,9642,0,0},
+    {'C',1,9643,0,0}, {';',0,0,1079,2}, {'e',1,9644,0,0}, {';',0,0,2346,1}, {';',0,0,2869,2}, {'e',1,9645,0,0},
+    {'r',1,9646,0,0}, {'r',1,9647,0,0}, {'g',1,9648,0,0}, {'r',1,9649,0,0}, {';',0,0,1643,3}, {'w',1,9650,0,0},
+    {'r',1,9651,0,0}, {';',0,0,2266,3}, {'t',1,9652,0,0}, {'r',1,9653,0,0}, {'r',1,9654,0,0}, {'o',1,9655,0,0},
+    {'a',1,9656,0,0}, {';',0,0,4287,3}, {'u',1,9657,0,0}, {'e',1,9658,0,0}, {'q',1,9659,0,0}, {';',0,0,455,3},
+    {';',0,0,70,3}, {'l',1,9660,0,0}, {';',0,0,1377,3}, {'r',1,9661,0,0}, {'t',1,9662,0,0}, {'r',1,9663,0,0},
+    {'r',1,9664,0,0}, {'l',1,9665,0,0}, {';',0,0,4290,3}, {';',0,0,521,3}, {'o',1,9666,0,0}, {'o',1,9667,0,0},
+    {'a',1,9668,0,0}, {'c',1,9669,0,0}, {'e',1,9670,0,0}, {'S',1,9671,0,0}, {'a',1,9672,0,0}, {';',0,0,588,2},
+    {'l',1,9673,0,0}, {'u',1,9674,0,0}, {'r',1,9675,0,0}, {'q',1,9676,0,0}, {'a',1,9677,0,0}, {'q',1,9678,0,0},
+    {'l',1,9679,0,0}, {'G',1,9680,0,0}, {'s',1,9681,0,0}, {';',0,0,1511,5}, {'E',1,9682,0,0}, {'t',1,9683,0,0},
+    {';',0,0,2596,3}, {'B',1,9684,0,0}, {'E',1,9685,0,0}, {'q',1,9686,0,0}, {'t',2,9687,0,0}, {';',0,0,1516,5},
+    {'E',1,9689,0,0}, {';',0,0,4293,5}, {';',0,0,2615,3}, {'l',1,9690,0,0}, {'u',1,9691,0,0}, {'a',1,9692,0,0},
+    {'u',1,9693,0,0}, {'r',1,9694,0,0}, {'t',1,9695,0,0}, {'r',1,9696,0,0}, {'e',1,9697,0,0}, {'o',1,9698,0,0},
+    {'a',1,9699,0,0}, {';',0,0,4298,3}, {'a',1,9700,0,0}, {'r',1,9701,0,0}, {';',0,0,4301,3}, {';',0,0,4304,3},
+    {'o',1,9702,0,0}, {'l',1,9703,0,0}, {'u',1,9704,0,0}, {'a',1,9705,0,0}, {';',0,0,4307,3}, {';',0,0,2883,3},
+    {'r',1,9706,0,0}, {'n',1,9707,0,0}, {'t',1,9708,0,0}, {'h',1,9709,0,0}, {';',0,0,2669,3}, {';',0,0,2248,3},
+    {'s',1,9710,0,0}, {'r',1,9711,0,0}, {'o',1,9712,0,0}, {';',0,0,3501,3}, {';',0,0,2743,3}, {'s',1,9713,0,0},
+    {';',0,0,2770,3}, {';',0,0,913,3}, {'w',1,9714,0,0}, {';',0,0,2951,3}, {'a',1,9715,0,0}, {'n',1,9716,0,0},
+    {'u',1,9717,0,0}, {'o',1,9718,0,0}, {'A',1,9719,0,0}, {'g',1,9720,0,0}, {'r',1,9721,0,0}, {'o',1,9722,0,0},
+    {'h',1,9723,0,0}, {'r',1,9724,0,0}, {';',0,0,1806,3}, {';',0,0,654,3}, {'o',1,9725,0,0}, {';',0,0,4310,3},
+    {';',0,0,4313,3}, {'r',1,9726,0,0}, {'r',1,9727,0,0}, {'a',1,9728,0,0}, {';',0,0,4316,3}, {'u',1,9729,0,0},
+    {';',0,0,458,3}, {'o',1,9730,0,0}, {';',0,0,2468,3}, {';',0,0,4319,3}, {';',0,0,4322,3}, {';',0,0,2498,3},
+    {'w',1,9731,0,0}, {'w',1,9732,0,0}, {'c',1,9733,0,0}, {'e',1,9734,0,0}, {';',0,0,4264,3}, {'p',1,9735,0,0},
+    {'t',1,9736,0,0}, {'B',1,9737,0,0}, {'a',1,9738,0,0}, {';',0,0,1456,5}, {'u',1,9739,0,0}, {'r',1,9740,0,0},
+    {'u',1,9741,0,0}, {';',0,0,1496,5}, {'r',1,9742,0,0}, {';',0,0,4325,5}, {'q',1,9743,0,0}, {';',0,0,2582,3},
+    {'a',1,9744,0,0}, {'q',1,9745,0,0}, {'u',1,9746,0,0}, {';',0,0,4330,5}, {'E',1,9747,0,0}, {'q',1,9748,0,0},
+    {';',0,0,2533,3}, {'o',1,9749,0,0}, {'l',1,9750,0,0}, {'m',1,9751,0,0}, {'i',1,9752,0,0}, {';',0,0,1654,3},
+    {'o',1,9753,0,0}, {'t',1,9754,0,0}, {'r',1,9755,0,0}, {'r',1,9756,0,0}, {'l',1,9757,0,0}, {';',0,0,4335,3},
+    {'n',1,9758,0,0}, {';',0,0,3670,3}, {'a',1,9759,0,0}, {'l',1,9760,0,0}, {';',0,0,4338,3}, {';',0,0,2263,3},
+    {';',0,0,2501,3}, {'t',1,9761,0,0}, {';',0,0,2477,3}, {'o',1,9762,0,0}, {'w',1,9763,0,0}, {';',0,0,2752,3},
+    {';',0,0,966,3}, {'l',1,9764,0,0}, {'t',1,9765,0,0}, {'o',1,9766,0,0}, {'n',1,9767,0,0}, {'c',1,9768,0,0},
+    {'r',1,9769,0,0}, {'o',1,9770,0,0}, {'w',1,9771,0,0}, {'t',1,9772,0,0}, {'o',1,9773,0,0}, {'r',1,9774,0,0},
+    {';',0,0,4341,3}, {';',0,0,4344,3}, {'r',1,9775,0,0}, {'a',1,9776,0,0}, {'w',1,9777,0,0}, {';',0,0,2965,3},
+    {';',0,0,2962,3}, {'e',1,9778,0,0}, {';',0,0,4264,3}, {'a',1,9779,0,0}, {'e',1,9780,0,0}, {'a',1,9781,0,0},
+    {'l',1,9782,0,0}, {'a',1,9783,0,0}, {';',0,0,4347,5}, {'a',1,9784,0,0}, {'e',1,9785,0,0}, {'u',1,9786,0,0},
+    {'r',1,9787,0,0}, {'u',1,9788,0,0}, {'a',1,9789,0,0}, {'q',1,9790,0,0}, {'u',1,9791,0,0}, {'t',1,9792,0,0},
+    {';',0,0,2691,3}, {';',0,0,2477,3}, {'u',1,9793,0,0}, {'w',1,9794,0,0}, {';',0,0,2764,3}, {';',0,0,4352,3},
+    {';',0,0,4355,3}, {';',0,0,2776,3}, {';',0,0,2834,3}, {'l',1,9795,0,0}, {';',0,0,2785,3}, {';',0,0,2779,3},
+    {'w',1,9796,0,0}, {';',0,0,2965,3}, {'D',1,9797,0,0}, {'e',1,9798,0,0}, {'t',1,9799,0,0}, {'t',1,9800,0,0},
+    {'u',1,9801,0,0}, {'a',1,9802,0,0}, {'w',1,9803,0,0}, {';',0,0,2968,3}, {'A',1,9804,0,0}, {'w',1,9805,0,0},
+    {';',0,0,4358,3}, {'e',1,9806,0,0}, {'r',1,9807,0,0}, {';',0,0,2474,3}, {';',0,0,4264,3}, {'c',1,9808,0,0},
+    {'r',1,9809,0,0}, {'r',1,9810,0,0}, {';',0,0,596,5}, {'l',1,9811,0,0}, {'l',1,9812,0,0}, {'a',1,9813,0,0},
+    {'a',1,9814,0,0}, {';',0,0,4361,5}, {'a',1,9815,0,0}, {'l',1,9816,0,0}, {'u',1,9817,0,0}, {'a',1,9818,0,0},
+    {'e',1,9819,0,0}, {'m',1,9820,0,0}, {';',0,0,2749,3}, {';',0,0,3673,3}, {';',0,0,2359,3}, {';',0,0,3,3},
+    {'g',1,9821,0,0}, {'e',1,9822,0,0}, {'o',1,9823,0,0}, {'t',1,9824,0,0}, {'l',1,9825,0,0}, {';',0,0,486,3},
+    {'r',1,9826,0,0}, {';',0,0,2977,3}, {';',0,0,4366,3}, {'e',1,9827,0,0}, {'e',1,9828,0,0}, {';',0,0,11,3},
+    {';',0,0,1508,3}, {';',0,0,1483,5}, {';',0,0,3474,3}, {'t',1,9829,0,0}, {'l',1,9830,0,0}, {'l',1,9831,0,0},
+    {';',0,0,3938,3}, {'a',1,9832,0,0}, {'l',1,9833,0,0}, {';',0,0,2438,3}, {';',0,0,2269,3}, {'r',1,9834,0,0},
+    {';',0,0,2740,3}, {'u',1,9835,0,0}, {'e',1,9836,0,0}, {';',0,0,3005,3}, {'r',1,9837,0,0}, {';',0,0,1723,3},
+    {';',0,0,4264,3}, {'e',1,9838,0,0}, {';',0,0,3488,3}, {';',0,0,3501,3}, {'l',1,9839,0,0}, {';',0,0,3504,3},
+    {'a',1,9840,0,0}, {'r',1,9841,0,0}, {';',0,0,2238,2}, {'o',1,9842,0,0}, {'r',1,9843,0,0}, {';',0,0,3941,3},
+    {'l',1,9844,0,0}, {'I',1,9845,0,0}, {'w',1,9846,0,0}, {';',0,0,4369,5}, {';',0,0,4120,3}, {'n',1,9847,0,0},
+    {';',0,0,2962,3}, {'t',1,9848,0,0}, {'e',1,9849,0,0}, {'g',1,9850,0,0}, {'r',1,9851,0,0}, {'a',1,9852,0,0},
+    {'l',1,9853,0,0}, {';',0,0,4102,3},
+    };
+
+    const char kEntityValues[] =
+    "\x3E\x3C\x26\xE2\x85\x85\xC3\x90\xE2\x8B\x99\xE2\x89\xAB\xE2\x84\x91\xE2\x8B\x98\xE2\x89\xAA\xCE"
+    "\x9C\xCE\x9D\xE2\xA9\x94\xCE\xA0\xE2\xAA\xBB\xC2\xAE\xE2\x84\x9C\xE2\xAA\xBC\xCE\x9E\xE2\x88\xBE"
+    "\xE2\x81\xA1\xE2\x89\x88\xE2\x85\x86\xC2\xB0\xE2\x85\x87\xE2\xAA\x9A\xE2\xAA\x99\xC3\xB0\xE2\x89"
+    "\xA7\xE2\x89\xA5\xE2\x89\xB7\xE2\x81\xA3\xE2\x85\x88\xE2\x88\x88\xE2\x81\xA2\xE2\x89\xA6\xE2\x89"
+    "\xA4\xE2\x89\xB6\xE2\x88\x93\xCE\xBC\xE2\x89\xA0\xE2\x88\x8B\xC2\xAC\xCE\xBD\xE2\x93\x88\xE2\x88"
+    "\xA8\xCF\x80\xC2\xB1\xE2\x89\xBA\xE2\x84\x9E\xE2\x89\xBB\xC2\xAD\xC2\xA8\xE2\x84\x98\xE2\x89\x80"
+    "\xCE\xBE\xC2\xA5\xD0\x90\xF0\x9D\x94\x84\xE2\xA9\x93\xC3\x84\xD0\x91\xF0\x9D\x94\x85\xC2\xA9\xE2"
+    "\x8B\x92\xE2\x84\xAD\xCE\xA7\xE2\x8B\x93\xD0\x94\xE2\x88\x87\xF0\x9D\x94\x87\xC5\x8A\xD0\xAD\xF0"
+    "\x9D\x94\x88\xCE\x97\xC3\x8B\xD0\xA4\xF0\x9D\x94\x89\xD0\x93\xF0\x9D\x94\x8A\x5E\xE2\x84\x8C\xD0"
+    "\x98\xE2\x88\xAC\xC3\x8F\xD0\x99\xF0\x9D\x94\x8D\xD0\x9A\xF0\x9D\x94\x8E\xD0\x9B\xF0\x9D\x94\x8F"
+    "\xE2\x86\xB0\xE2\xA4\x85\xD0\x9C\xF0\x9D\x94\x90\xD0\x9D\xF0\x9D\x94\x91\xE2\xAB\xAC\xD0\x9E\xF0"
+    "\x9D\x94\x92\xC3\x96\xD0\x9F\xF0\x9D\x94\x93\xCE\xA6\xCE\xA8\x22\xF0\x9D\x94\x94\xD0\xA0\xCE\xA1"
+    "\xE2\x86\xB1\xD0\xA1\xF0\x9D\x94\x96\xE2\x8B\x90\xE2\x88\x91\xE2\x8B\x91\x09\xCE\xA4\xD0\xA2\xF0"
+    "\x9D\x94\x97\xD0\xA3\xF0\x9D\x94\x98\xC3\x9C\xD0\x92\xE2\x8B\x81\xF0\x9D\x94\x99\xF0\x9D\x94\x9A"
+    "\xF0\x9D\x94\x9B\xD0\xAB\xF0\x9D\x94\x9C\xD0\x97\xE2\x84\xA8\xE2\x88\xBE\xCC\xB3\xE2\x88\xBF\xD0"
+    "\xB0\xF0\x9D\x94\x9E\xE2\x88\xA7\xE2\x88\xA0\xE2\xA9\xB0\xE2\x89\x8A\x2A\xC3\xA4\xD0\xB1\xF0\x9D"
+    "\x94\x9F\x3D\xE2\x83\xA5\xE2\x8A\xA5\xE2\x88\xA9\xC2\xA2\xF0\x9D\x94\xA0\xCF\x87\xE2\x97\x8B\xE2"
+    "\x88\xAA\xD0\xB4\xF0\x9D\x94\xA1\xC3\xB7\xCB\x99\xD1\x8D\xF0\x9D\x94\xA2\xE2\xAA\x96\xE2\x84\x93"
+    "\xE2\xAA\x95\xC5\x8B\xCE\xB7\xC3\xAB\xD1\x84\xF0\x9D\x94\xA3\xE2\xAA\x8C\xE2\xAA\x86\xD0\xB3\xE2"
+    "\x8B\x9B\xE2\xA9\xBE\xF0\x9D\x94\xA4\xE2\xAA\x92\xE2\xAA\xA5\xE2\xAA\xA4\xE2\x89\xA9\xE2\xAA\x88"
+    "\xF0\x9D\x94\xA5\xD0\xB8\xE2\x87\x94\xF0\x9D\x94\xA6\xE2\x88\xAB\xC3\xAF\xD0\xB9\xF0\x9D\x94\xA7"
+    "\xD0\xBA\xF0\x9D\x94\xA8\xE2\xAA\x8B\xE2\xAA\x85\xE2\xAA\xAB\xD0\xBB\xE2\x8B\x9A\xE2\xA9\xBD\xF0"
+    "\x9D\x94\xA9\xE2\xAA\x91\xE2\x89\xA8\xE2\xAA\x87\xE2\x97\x8A\xE2\x80\x8E\xC2\xAF\xE2\x86\xA6\xD0"
+    "\xBC\xF0\x9D\x94\xAA\xE2\x84\xA7\xE2\x88\xA3\xE2\x8B\x99\xCC\xB8\xE2\x89\xAB\xE2\x83\x92\xE2\x8B"
+    "\x98\xCC\xB8\xE2\x89\xAA\xE2\x83\x92\xE2\x89\x89\xC2\xA0\xD0\xBD\xF0\x9D\x94\xAB\xE2\x89\xA7\xCC"
+    "\xB8\xE2\x89\xB1\xE2\x89\xAF\xE2\x8B\xBC\xE2\x89\xA6\xCC\xB8\xE2\x89\xB0\xE2\x89\xAE\xE2\x8A\x80"
+    "\xE2\x8A\x81\x23\xD0\xBE\xF0\x9D\x94\xAC\xE2\xA7\x81\xCE\xA9\xE2\xA7\x80\xE2\xA9\x9D\xC2\xAA\xC2"
+    "\xBA\xE2\xA9\x9B\xC3\xB6\xE2\x88\xA5\xC2\xB6\xD0\xBF\xF0\x9D\x94\xAD\xCF\x86\xCF\x96\xE2\xAA\xB3"
+    "\xE2\xAA\xAF\xCF\x88\xF0\x9D\x94\xAE\xD1\x80\xF0\x9D\x94\xAF\xCF\x81\xE2\x80\x8F\xE2\xAA\xB4\xE2"
+    "\xAA\xB0\xD1\x81\xC2\xA7\xF0\x9D\x94\xB0\xE2\x88\xBC\xE2\xAA\xAA\x2F\xE2\x96\xA1\xE2\x8A\x82\xC2"
+    "\xB9\xC2\xB2\xC2\xB3\xE2\x8A\x83\xCF\x84\xD1\x82\xF0\x9D\x94\xB1\xE2\x8A\xA4\xD1\x83\xF0\x9D\x94"
+    "\xB2\xC3\xBC\xD0\xB2\xF0\x9D\x94\xB3\xF0\x9D\x94\xB4\xF0\x9D\x94\xB5\xD1\x8B\xF0\x9D\x94\xB6\xC3"
+    "\xBF\xD0\xB7\xF0\x9D\x94\xB7\xE2\x80\x8D\xC3\x86\xC3\x82\xF0\x9D\x94\xB8\xC3\x85\xF0\x9D\x92\x9C"
+    "\xE2\xAB\xA7\xCE\x92\xF0\x9D\x94\xB9\xE2\x84\xAC\xD0\xA7\xC4\x8A\xE2\x84\x82\xF0\x9D\x92\x9E\xD0"
+    "\x82\xD0\x85\xD0\x8F\xE2\x86\xA1\xF0\x9D\x94\xBB\xF0\x9D\x92\x9F\xC3\x8A\xC4\x96\xF0\x9D\x94\xBC"
+    "\xE2\x84\xB0\xE2\xA9\xB3\xF0\x9D\x94\xBD\xE2\x84\xB1\xD0\x83\xC4\xA0\xF0\x9D\x94\xBE\xF0\x9D\x92"
+    "\xA2\xE2\x84\x8D\xE2\x84\x8B\xD0\x95\xD0\x81\xC3\x8E\xC4\xB0\xF0\x9D\x95\x80\xCE\x99\xE2\x84\x90"
+    "\xF0\x9D\x95\x81\xF0\x9D\x92\xA5\xD0\xA5\xD0\x8C\xF0\x9D\x95\x82\xF0\x9D\x92\xA6\xD0\x89\xE2\x9F"
+    "\xAA\xE2\x86\x9E\xF0\x9D\x95\x83\xE2\x84\x92\xF0\x9D\x95\x84\xE2\x84\xB3\xD0\x8A\xE2\x84\x95\xF0"
+    "\x9D\x92\xA9\xC3\x94\xF0\x9D\x95\x86\xF0\x9D\x92\xAA\xE2\x84\x99\xF0\x9D\x92\xAB\xE2\x84\x9A\xF0"
+    "\x9D\x92\xAC\xE2\x9F\xAB\xE2\x86\xA0\xE2\x84\x9D\xE2\x84\x9B\xD0\xA8\xF0\x9D\x95\x8A\xE2\x88\x9A"
+    "\xF0\x9D\x92\xAE\xE2\x8B\x86\xC3\x9E\xD0\xA6\xF0\x9D\x95\x8B\xF0\x9D\x92\xAF\xE2\x86\x9F\xC3\x9B"
+    "\xF0\x9D\x95\x8C\xCF\x92\xF0\x9D\x92\xB0\xE2\xAB\xAB\xE2\x80\x96\xF0\x9D\x95\x8D\xF0\x9D\x92\xB1"
+    "\xF0\x9D\x95\x8E\xF0\x9D\x92\xB2\xF0\x9D\x95\x8F\xF0\x9D\x92\xB3\xD0\xAF\xD0\x87\xD0\xAE\xF0\x9D"
+    "\x95\x90\xF0\x9D\x92\xB4\xC5\xB8\xD0\x96\xC5\xBB\xCE\x96\xE2\x84\xA4\xF0\x9D\x92\xB5\xC3\xA2\xC2"
+    "\xB4\xC3\xA6\xE2\xA9\x9C\xE2\xA9\x9A\xE2\xA6\xA4\xF0\x9D\x95\x92\xE2\x89\x8B\x27\xC3\xA5\xF0\x9D"
+    "\x92\xB6\xE2\xAB\xAD\xE2\x8E\xB5\xCE\xB2\xE2\x84\xB6\xE2\x8C\x90\xF0\x9D\x95\x93\xE2\x95\x90\xE2"
+    "\x95\x91\xE2\x94\x80\xE2\x94\x82\xF0\x9D\x92\xB7\xE2\x88\xBD\x5C\xE2\x80\xA2\xE2\x89\x8E\xE2\x88"
+    "\xA9\xEF\xB8\x80\xC4\x8B\xC2\xB8\xD1\x87\xE2\xA7\x83\xCB\x86\xE2\x89\x97\xE2\x88\x81\xE2\x89\x85"
+    "\xF0\x9D\x95\x94\xF0\x9D\x92\xB8\xE2\xAB\x8F\xE2\xAB\x90\xE2\x88\xAA\xEF\xB8\x80\xE2\x87\x93\xE2"
+    "\xA5\xA5\xE2\x86\x93\xE2\x80\x90\xE2\x8B\x84\xD1\x92\xF0\x9D\x95\x95\xF0\x9D\x92\xB9\xD1\x95\xE2"
+    "\xA7\xB6\xE2\x96\xBF\xD1\x9F\xE2\x89\x91\xE2\x89\x96\xC3\xAA\xC4\x97\xE2\x80\x83\xE2\x80\x82\xF0"
+    "\x9D\x95\x96\xE2\x8B\x95\xCE\xB5\xE2\x84\xAF\xE2\x89\x82\xE2\x82\xAC\x21\xE2\x99\xAD\xC6\x92\xF0"
+    "\x9D\x95\x97\xE2\x8B\x94\xF0\x9D\x92\xBB\xC4\xA1\xE2\x8B\x9B\xEF\xB8\x80\xD1\x93\xE2\xAA\x8A\xF0"
+    "\x9D\x95\x98\xE2\x84\x8A\xE2\x89\xB3\xE2\xAA\xA7\xE2\x89\xA9\xEF\xB8\x80\xC2\xBD\xE2\x86\x94\xE2"
+    "\x84\x8F\xF0\x9D\x95\x99\xF0\x9D\x92\xBD\xC3\xAE\xD0\xB5\xC2\xA1\xE2\x8A\xB7\xD1\x91\xF0\x9D\x95"
+    "\x9A\xCE\xB9\xF0\x9D\x92\xBE\xF0\x9D\x95\x9B\xF0\x9D\x92\xBF\xD1\x85\xD1\x9C\xF0\x9D\x95\x9C\xF0"
+    "\x9D\x93\x80\xE2\x87\x90\xE2\xA5\xA2\xE2\x9F\xA8\xC2\xAB\xE2\x86\x90\xE2\xAA\xAD\x7B\xE2\xA4\xB6"
+    "\xE2\x86\xB2\xE2\x8B\x9A\xEF\xB8\x80\xD1\x99\xE2\xAA\x89\xF0\x9D\x95\x9D\xE2\xA7\xAB\x28\xF0\x9D"
+    "\x93\x81\xE2\x89\xB2\x5B\xE2\xAA\xA6\xE2\x97\x83\xE2\x89\xA8\xEF\xB8\x80\xE2\x99\x82\xE2\x9C\xA0"
+    "\xC2\xB5\xE2\xAB\x9B\xE2\x80\xA6\xF0\x9D\x95\x9E\xF0\x9D\x93\x82\xE2\x89\xAB\xCC\xB8\xE2\x89\xAA"
+    "\xCC\xB8\xE2\x88\xA0\xE2\x83\x92\xE2\xA9\xB0\xCC\xB8\xE2\xA9\x83\xE2\xA9\x82\xE2\xA9\xBE\xCC\xB8"
+    "\xE2\x8B\xBA\xD1\x9A\xE2\x80\xA5\xE2\xA9\xBD\xCC\xB8\xE2\x88\xA4\xF0\x9D\x95\x9F\xE2\x88\xA6\xE2"
+    "\xAA\xAF\xCC\xB8\xE2\xAA\xB0\xCC\xB8\xF0\x9D\x93\x83\xE2\x89\x81\xE2\x8A\x84\xE2\x8A\x85\xE2\x89"
+    "\xB9\xE2\x89\xB8\xE2\x89\x8D\xE2\x83\x92\xE2\x89\xA5\xE2\x83\x92\x3E\xE2\x83\x92\xE2\x89\xA4\xE2"
+    "\x83\x92\x3C\xE2\x83\x92\xE2\x8A\x9B\xE2\x8A\x9A\xC3\xB4\xE2\xA8\xB8\xE2\x8A\x99\xCB\x9B\xE2\x88"
+    "\xAE\xE2\xA6\xB6\xF0\x9D\x95\xA0\xE2\xA6\xB7\xE2\xA9\x96\xE2\x84\xB4\xE2\x8A\x98\xE2\x88\x82\xCF"
+    "\x95\x2B\xF0\x9D\x95\xA1\xC2\xA3\xE2\xAA\xB7\xE2\xAA\xB5\xE2\x88\x8F\xE2\x88\x9D\xF0\x9D\x93\x85"
+    "\xE2\xA8\x8C\xF0\x9D\x95\xA2\xF0\x9D\x93\x86\xE2\x87\x92\xE2\xA5\xA4\xE2\x88\xBD\xCC\xB1\xE2\x9F"
+    "\xA9\xC2\xBB\xE2\x86\x92\x7D\xE2\xA4\xB7\xE2\x86\xB3\xE2\x96\xAD\xCF\xB1\xCB\x9A\xF0\x9D\x95\xA3"
+    "\x29\xF0\x9D\x93\x87\x5D\xE2\x96\xB9\xE2\xAA\xB8\xE2\xAA\xB6\xE2\x8B\x85\x3B\xE2\x9C\xB6\xD1\x88"
+    "\xE2\x89\x83\xE2\xAA\x9E\xE2\xAA\x9D\xE2\xAA\xAC\xE2\xA7\x84\xF0\x9D\x95\xA4\xE2\x96\xAA\xF0\x9D"
+    "\x93\x88\xE2\x98\x86\xE2\xAB\x85\xE2\x8A\x86\xE2\x99\xAA\xE2\xAB\x86\xE2\x8A\x87\xC3\x9F\xE2\x8E"
+    "\xB4\xE2\x83\x9B\xC3\xBE\xC3\x97\xE2\x88\xAD\xE2\xA4\xA8\xF0\x9D\x95\xA5\xE2\xA4\xA9\xE2\x89\x9C"
+    "\xF0\x9D\x93\x89\xD1\x86\xE2\x87\x91\xE2\xA5\xA3\xE2\x86\x91\xC3\xBB\xF0\x9D\x95\xA6\xCF\x85\xF0"
+    "\x9D\x93\x8A\xE2\x96\xB5\xE2\x87\x95\xE2\xAB\xA8\xE2\x86\x95\x7C\xF0\x9D\x95\xA7\xF0\x9D\x93\x8B"
+    "\xF0\x9D\x95\xA8\xF0\x9D\x93\x8C\xE2\x8B\x82\xE2\x8B\x83\xE2\x9F\xBC\xE2\x8B\xBB\xF0\x9D\x95\xA9"
+    "\xF0\x9D\x93\x8D\xD1\x8F\xD1\x97\xF0\x9D\x95\xAA\xF0\x9D\x93\x8E\xD1\x8E\xC5\xBC\xCE\xB6\xD0\xB6"
+    "\xF0\x9D\x95\xAB\xF0\x9D\x93\x8F\xE2\x80\x8C\xC3\x81\xC3\x80\xCE\x91\xC4\x80\xC4\x84\xC3\x83\xCB"
+    "\x98\xC3\x87\xC4\x88\xE2\x88\xB7\xE2\xA8\xAF\xE2\xAB\xA4\xCE\x94\xC3\x89\xC3\x88\xC4\x92\xC4\x98"
+    "\xE2\xA9\xB5\xCE\x93\xC4\x9C\xCB\x87\xC4\xA4\xC4\xB2\xC3\x8D\xC3\x8C\xC4\xAA\xC4\xAE\xD0\x86\xC4"
+    "\xB4\xD0\x84\xCE\x9A\xC3\x91\xC5\x92\xC3\x93\xC3\x92\xC5\x8C\xC3\x98\xC3\x95\xE2\x80\xB3\xE2\xA4"
+    "\x90\xC5\x9C\xCE\xA3\xE2\x84\xA2\xD0\x8B\xCE\x98\xC3\x9A\xD0\x8E\xC3\x99\xC5\xAA\xC5\xB2\xC5\xAE"
+    "\xE2\x8A\xAB\xE2\x8A\xA9\xC5\xB4\xE2\x8B\x80\xC3\x9D\xC5\xB6\xC3\xA1\xC3\xA0\xE2\x84\xB5\xCE\xB1"
+    "\xC4\x81\xE2\xA8\xBF\xE2\x88\x9F\xC4\x85\xC3\xA3\xE2\xA8\x91\xE2\x89\x8C\xE2\x80\x9E\xCF\xB6\xE2"
+    "\x90\xA3\xE2\x96\x92\xE2\x96\x91\xE2\x96\x93\xE2\x96\x88\xE2\x95\x97\xE2\x95\x94\xE2\x95\x96\xE2"
+    "\x95\x93\xE2\x95\xA6\xE2\x95\xA9\xE2\x95\xA4\xE2\x95\xA7\xE2\x95\x9D\xE2\x95\x9A\xE2\x95\x9C\xE2"
+    "\x95\x99\xE2\x95\xAC\xE2\x95\xA3\xE2\x95\xA0\xE2\x95\xAB\xE2\x95\xA2\xE2\x95\x9F\xE2\x95\x95\xE2"
+    "\x95\x92\xE2\x94\x90\xE2\x94\x8C\xE2\x95\xA5\xE2\x95\xA8\xE2\x94\xAC\xE2\x94\xB4\xE2\x95\x9B\xE2"
+    "\x95\x98\xE2\x94\x98\xE2\x94\x94\xE2\x95\xAA\xE2\x95\xA1\xE2\x95\x9E\xE2\x94\xBC\xE2\x94\xA4\xE2"
+    "\x94\x9C\xC2\xA6\xE2\x81\x8F\xE2\x8B\x8D\xE2\xA7\x85\xE2\xAA\xAE\xE2\x89\x8F\xE2\x81\x81\xE2\xA9"
+    "\x8D\xC3\xA7\xC4\x89\xE2\xA9\x8C\xE2\x9C\x93\xE2\x99\xA3\x3A\x2C\xE2\x86\xB5\xE2\x9C\x97\xE2\xAB"
+    "\x91\xE2\xAB\x92\xE2\x8B\xAF\xE2\x8B\x9E\xE2\x8B\x9F\xE2\xA9\x85\xC2\xA4\xE2\x8B\x8E\xE2\x8B\x8F"
+    "\xE2\x88\xB1\xE2\x8A\xA3\xCB\x9D\xE2\x87\x8A\xCE\xB4\xE2\x87\x83\xE2\x87\x82\xE2\x99\xA6\xE2\x8B"
+    "\xB2\xE2\x89\x90\xE2\x8B\xB1\xE2\x96\xBE\xE2\x87\xB5\xE2\xA5\xAF\xE2\xA9\xB7\xC3\xA9\xE2\x89\x92"
+    "\xC3\xA8\xC4\x93\xE2\x88\x85\xC4\x99\xE2\xA9\xB1\xCF\xB5\xE2\x89\xA1\xE2\x89\x93\xE2\xA5\xB1\xE2"
+    "\x88\x83\xEF\xAC\x80\xEF\xAC\x81\x66\x6A\xEF\xAC\x82\xE2\x96\xB1\xE2\xAB\x99\xC2\xBC\xC2\xBE\xE2"
+    "\x81\x84\xE2\x8C\xA2\xCE\xB3\xC4\x9D\xE2\xAA\xA9\xE2\x84\xB7\xE2\x8B\xA7\x60\xE2\xAA\x8E\xE2\xAA"
+    "\x90\xE2\xA9\xBA\xE2\x8B\x97\xE2\x86\xAD\xC4\xA5\xE2\x87\xBF\xC3\xAD\xC3\xAC\xE2\x84\xA9\xC4\xB3"
+    "\xC4\xAB\xC4\xB1\xC6\xB5\xE2\x88\x9E\xC4\xAF\xE2\xA8\xBC\xC2\xBF\xE2\x8B\xB9\xE2\x8B\xB4\xD1\x96"
+    "\xC4\xB5\xC8\xB7\xD1\x94\xCE\xBA\xE2\x87\x9A\xE2\xA4\x8E\xE2\xA6\x91\xE2\x87\xA4\xE2\xAA\xAD\xEF"
+    "\xB8\x80\xE2\xA4\x8C\xE2\x9D\xB2\xE2\xA6\x8B\xE2\x8C\x88\xE2\x80\x9C\xE2\xAA\xA8\xE2\x86\xBD\xE2"
+    "\x86\xBC\xE2\x96\x84\xE2\x87\x87\xE2\x97\xBA\xE2\x8B\xA6\xE2\x9F\xAC\xE2\x87\xBD\xE2\x9F\xA6\xE2"
+    "\xA6\x85\xE2\x87\x86\xE2\x87\x8B\xE2\x8A\xBF\xE2\xAA\x8D\xE2\xAA\x8F\xE2\x80\x98\xE2\xA9\xB9\xE2"
+    "\x8B\x96\xE2\x8A\xB4\xE2\x97\x82\xE2\x88\xBA\xE2\x80\x94\xC2\xB7\xE2\x88\x92\xE2\x8A\xB8\xE2\x89"
+    "\x8B\xCC\xB8\xC5\x89\xE2\x99\xAE\xE2\x89\x8E\xCC\xB8\xE2\x89\x87\xE2\x80\x93\xE2\x87\x97\xE2\x86"
+    "\x97\xE2\x89\x90\xCC\xB8\xE2\x89\x82\xCC\xB8\xE2\x89\xB5\xE2\x87\x8E\xE2\x86\xAE\xE2\xAB\xB2\xE2"
+    "\x87\x8D\xE2\x86\x9A\xE2\x89\xB4\xE2\x8B\xAA\xE2\x88\x89\xE2\x88\x8C\xE2\x88\x82\xCC\xB8\xE2\x87"
+    "\x8F\xE2\x86\x9B\xE2\x8B\xAB\xE2\x89\x84\xE2\xAB\x85\xCC\xB8\xE2\x8A\x88\xE2\xAB\x86\xCC\xB8\xE2"
+    "\x8A\x89\xC3\xB1\xE2\x80\x87\xE2\x88\xBC\xE2\x83\x92\xE2\x87\x96\xE2\x86\x96\xC3\xB3\xE2\x8A\x9D"
+    "\xC5\x93\xE2\xA6\xBF\xC3\xB2\xE2\xA6\xB5\xE2\x86\xBA\xE2\xA6\xBE\xE2\x80\xBE\xC5\x8D\xCF\x89\xE2"
+    "\xA6\xB9\xE2\x8A\x95\xE2\x86\xBB\xC3\xB8\xC3\xB5\xE2\x8C\xBD\xE2\xAB\xBD\xE2\x98\x8E\xE2\x8A\x9E"
+    "\xE2\xA9\xB2\xE2\x89\xBC\xE2\x80\xB2\xE2\xAA\xB9\xE2\x89\xBE\x3F\xE2\x87\x9B\xE2\xA4\x8F\xE2\xA6"
+    "\x92\xE2\xA6\xA5\xE2\x87\xA5\xE2\xA4\xB3\xE2\x86\x9D\xE2\x88\xB6\xE2\xA4\x8D\xE2\x9D\xB3\xE2\xA6"
+    "\x8C\xE2\x8C\x89\xE2\x80\x9D\xE2\x87\x81\xE2\x87\x80\xE2\x87\x84\xE2\x87\x8C\xE2\xAB\xAE\xE2\x9F"
+    "\xAD\xE2\x87\xBE\xE2\x9F\xA7\xE2\xA6\x86\xE2\x87\x89\xE2\x80\x99\xE2\x8A\xB5\xE2\x96\xB8\xE2\x80"
+    "\x9A\xE2\x89\xBD\xC5\x9D\xE2\xAA\xBA\xE2\x89\xBF\xE2\x8A\xA1\xE2\xA9\xA6\xE2\x87\x98\xE2\x86\x98"
+    "\xE2\x88\x96\xE2\x99\xAF\xCF\x83\xE2\xAA\xA0\xE2\xAA\x9F\xE2\x89\x86\xE2\x8C\xA3\xE2\xAA\xAC\xEF"
+    "\xB8\x80\xE2\x8A\x93\xE2\x8A\x94\xE2\x8A\x8F\xE2\x8A\x90\xE2\x98\x85\xE2\xAB\x8B\xE2\x8A\x8A\xE2"
+    "\xAB\x8C\xE2\x8A\x8B\xE2\x87\x99\xE2\x86\x99\xCE\xB8\xCB\x9C\xE2\xA7\x8D\xD1\x9B\xE2\x89\xAC\xC3"
+    "\xBA\xD1\x9E\xE2\x87\x85\xE2\xA5\xAE\xC3\xB9\xE2\x86\xBF\xE2\x86\xBE\xE2\x96\x80\xE2\x97\xB8\xC5"
+    "\xAB\xC5\xB3\xE2\x8A\x8E\xC5\xAF\xE2\x97\xB9\xE2\x8B\xB0\xE2\x96\xB4\xE2\x87\x88\xE2\xAB\xA9\xE2"
+    "\x8A\xA8\xE2\x8A\xA2\xE2\x89\x9A\xE2\x8A\xB2\xE2\x8A\x82\xE2\x83\x92\xE2\x8A\x83\xE2\x83\x92\xE2"
+    "\x8A\xB3\xC5\xB5\xE2\x97\xAF\xE2\x96\xBD\xE2\x9F\xBA\xE2\x9F\xB7\xE2\x9F\xB8\xE2\x9F\xB5\xE2\xA8"
+    "\x80\xE2\x9F\xB9\xE2\x9F\xB6\xE2\x96\xB3\xC3\xBD\xC5\xB7\xC4\x82\xE2\x89\x94\xE2\x8C\x86\xC4\x86"
+    "\xC4\x8C\xE2\xA9\xB4\xE2\x88\xAF\xE2\x89\x8D\xE2\x80\xA1\xC4\x8E\xE2\x83\x9C\xC4\x90\xC4\x9A\xE2"
+    "\x88\x80\xCF\x9C\xC4\x9E\xC4\xA2\xD0\xAA\xC4\xA6\xC4\xA8\xD0\x88\xC4\xB6\xC4\xB9\xCE\x9B\xC4\xBD"
+    "\xC4\xBB\xC4\xBF\xC5\x81\xC5\x83\xC5\x87\xC5\x85\xC5\x90\xE2\xA8\xB7\xC5\x94\xE2\xA4\x96\xC5\x98"
+    "\xC5\x96\xD0\xA9\xD0\xAC\xC5\x9A\xC5\xA0\xC5\x9E\xC5\xA4\xC5\xA2\xC5\xA6\xC5\xAC\xC5\xB0\xC5\xA8"
+    "\xE2\xAB\xA6\xE2\x8A\xAA\xC5\xB9\xC5\xBD\xC4\x83\xE2\xA9\x95\xE2\x88\xA1\xE2\x88\xA2\xE2\xA9\xAF"
+    "\xE2\x8A\xBD\xE2\x8C\x85\xE2\x88\xB5\xE2\x8B\x88\xE2\xA7\x89\xE2\x80\xB5\xC4\x87\xE2\xA9\x84\xE2"
+    "\xA9\x8B\xE2\xA9\x87\xE2\xA9\x80\xC4\x8D\xE2\xAB\xAF\x40\xE2\x88\x98\xE2\x88\x90\xE2\x84\x97\xE2"
+    "\x86\xB6\xE2\xA9\x86\xE2\xA9\x8A\xE2\x8A\x8D\xE2\x86\xB7\xE2\x8C\xAD\xE2\x80\xA0\xE2\x84\xB8\xC4"
+    "\x8F\xE2\xA5\xBF\xE2\x8B\x87\xE2\x8C\x9E\xE2\x8C\x8D\x24\xE2\x8C\x9F\xE2\x8C\x8C\xC4\x91\xE2\xA9"
+    "\xAE\xC4\x9B\xE2\x89\x95\xE2\xAA\x98\xE2\xAA\x97\xE2\x80\x84\xE2\x80\x85\xE2\xA7\xA3\x3D\xE2\x89"
+    "\x9F\xE2\x99\x80\xEF\xAC\x83\xEF\xAC\x84\xE2\x85\x93\xE2\x85\x95\xE2\x85\x99\xE2\x85\x9B\xE2\x85"
+    "\x94\xE2\x85\x96\xE2\x85\x97\xE2\x85\x9C\xE2\x85\x98\xE2\x85\x9A\xE2\x85\x9D\xE2\x85\x9E\xC7\xB5"
+    "\xCF\x9D\xC4\x9F\xE2\xAA\x80\xE2\xAA\x94\xE2\xA6\x95\xE2\xA5\xB8\xE2\x80\x8A\xD1\x8A\xE2\x99\xA5"
+    "\xE2\x8A\xB9\xE2\x88\xBB\xE2\x80\x95\xC4\xA7\xE2\x81\x83\xE2\xA7\x9C\xE2\x84\x85\xE2\x8A\xBA\xE2"
+    "\x8B\xB3\xC4\xA9\xD1\x98\xCF\xB0\xC4\xB7\xC4\xB8\xE2\xA4\x9B\xC4\xBA\xCE\xBB\xE2\xA4\x9D\xE2\x86"
+    "\xA9\xE2\x86\xAB\xE2\xA4\xB9\xE2\x86\xA2\xE2\xA4\x99\xC4\xBE\xC4\xBC\xE2\xA9\xBF\xE2\xAA\x93\xE2"
+    "\xA5\xBC\xE2\x8C\x8A\xE2\xA5\xAA\xE2\xA5\xAB\xC5\x80\xE2\x8E\xB0\xE2\xA8\xAD\xE2\x88\x97\x5F\xE2"
+    "\xA6\x93\xE2\xA5\xAD\xE2\x80\xB9\xC5\x82\xE2\x8B\x8B\xE2\x8B\x89\xE2\xA5\xB6\xE2\xA6\x96\xE2\x96"
+    "\xAE\xE2\xA8\xA9\xE2\xAB\xB0\xE2\x8A\x9F\xE2\x88\xB8\xE2\x8A\xA7\xE2\x8A\xAF\xE2\x8A\xAE\xC5\x84"
+    "\xE2\x89\x8F\xCC\xB8\xC5\x88\xC5\x86\xE2\xA4\xA4\xE2\x89\xA2\xE2\x88\x84\xE2\x8B\xAC\xE2\x8B\xB9"
+    "\xCC\xB8\xE2\xAB\xBD\xE2\x83\xA5\xE2\x8B\xA0\xE2\xA4\xB3\xCC\xB8\xE2\x86\x9D\xCC\xB8\xE2\x8B\xAD"
+    "\xE2\x8B\xA1\xE2\x84\x96\xE2\x8A\xAD\xE2\xA4\x84\xE2\x8A\xAC\xE2\xA4\x82\xE2\xA4\x83\xE2\xA4\xA3"
+    "\xE2\xA4\xA7\xC5\x91\xE2\xA6\xBC\xE2\x8A\x96\xE2\x8A\xB6\xE2\x8A\x97\xE2\xAB\xB3\x25\x2E\xE2\x80"
+    "\xB0\xE2\x88\x94\xE2\xA8\xA5\xE2\x8B\xA8\xE2\x8A\xB0\xE2\x80\x88\xE2\x81\x97\xE2\xA4\x9C\xC5\x95"
+    "\xE2\xA5\xB5\xE2\xA4\x9E\xE2\x86\xAA\xE2\x86\xAC\xE2\xA5\x85\xE2\x86\xA3\xE2\xA4\x9A\xC5\x99\xC5"
+    "\x97\xE2\xA5\xBD\xE2\x8C\x8B\xE2\xA5\xAC\xE2\x8E\xB1\xE2\xA8\xAE\xE2\xA6\x94\xE2\x80\xBA\xE2\x8B"
+    "\x8C\xE2\x8B\x8A\xC5\x9B\xC5\xA1\xC5\x9F\xE2\x8B\xA9\xE2\xA4\xA5\xD1\x89\xCF\x82\xE2\xA9\xAA\xE2"
+    "\xA8\xB3\xD1\x8C\xE2\x8C\xBF\xE2\x99\xA0\xE2\x8A\x93\xEF\xB8\x80\xE2\x8A\x94\xEF\xB8\x80\xE2\x8A"
+    "\x91\xE2\x8A\x92\xE2\xAA\xBD\xE2\xAB\x87\xE2\xAB\x95\xE2\xAB\x93\xE2\xAA\xBE\xE2\xAB\x88\xE2\xAB"
+    "\x94\xE2\xAB\x96\xE2\xA4\xA6\xE2\xA4\xAA\xE2\x8C\x96\xC5\xA5\xC5\xA3\xE2\x8C\x95\xE2\x88\xB4\xCF"
+    "\x91\xE2\x80\x89\xE2\x8A\xA0\xE2\xA8\xB0\xE2\x8C\xB6\xE2\xAB\xB1\xE2\x80\xB4\xE2\x97\xAC\xC5\xA7"
+    "\xC5\xAD\xC5\xB1\xE2\xA5\xBE\xE2\x8C\x9C\xE2\x8C\x8F\xE2\x8C\x9D\xE2\x8C\x8E\xC5\xA9\xE2\xA6\x9C"
+    "\xE2\x8A\xBB\xE2\x8B\xAE\xE2\xAB\x8B\xEF\xB8\x80\xE2\x8A\x8A\xEF\xB8\x80\xE2\xAB\x8C\xEF\xB8\x80"
+    "\xE2\x8A\x8B\xEF\xB8\x80\xE2\xA9\x9F\xE2\x89\x99\xE2\xA8\x81\xE2\xA8\x82\xE2\xA8\x86\xE2\xA8\x84"
+    "\xC5\xBA\xC5\xBE\xE2\x88\xB0\xCE\x95\x0A\xE2\x81\xA0\xCE\x9F\xCE\xA5\xE2\x8A\xBE\xE2\x8D\xBC\xE2"
+    "\xA6\xB0\xE2\x89\xA1\xE2\x83\xA5\xE2\xA9\x90\xE2\xA6\xB2\xE2\xA7\x82\xE2\xA9\xAD\xE2\xA4\xB8\xE2"
+    "\xA4\xB5\xE2\xA4\xBD\xE2\xA4\xBC\xE2\xA6\xB1\xE2\xA6\xA6\xE2\xA9\xB8\xE2\xAA\x82\xE2\xA9\xBC\xE2"
+    "\xA5\x88\xE2\x8B\xB5\xE2\xA4\x9F\xE2\xA5\xB3\xE2\xA6\x8F\xE2\xA6\x8D\xE2\xA5\xA7\xE2\xAA\x81\xE2"
+    "\xA8\xB4\xE2\xA9\xBB\xE2\xA5\xA6\xE2\xA8\xAA\xE2\x8B\xB7\xE2\x8B\xB6\xE2\x8B\xBE\xE2\x8B\xBD\xE2"
+    "\xA8\x94\xE2\x8B\xA2\xE2\x8B\xA3\xE2\xA7\x9E\xE2\x8A\xB4\xE2\x83\x92\xE2\x8A\xB5\xE2\x83\x92\xE2"
+    "\xA6\xBB\xCE\xBF\xE2\xA9\x97\xE2\x80\xB1\xE2\x84\x8E\xE2\xA8\xA2\xE2\xA8\xA6\xE2\xA8\xA7\xE2\xA8"
+    "\x96\xE2\xA4\xA0\xE2\xA5\xB4\xE2\xA6\x8E\xE2\xA6\x90\xE2\xA5\xA9\xE2\xA8\xB5\xE2\xA5\xA8\xE2\xA8"
+    "\xA4\xE2\xA5\xB2\xE2\xAB\x83\xE2\xAB\x81\xE2\xAA\xBF\xE2\xA5\xB9\xE2\xAB\x98\xE2\xAB\x84\xE2\x9F"
+    "\x89\xE2\xAB\x97\xE2\xA5\xBB\xE2\xAB\x82\xE2\xAB\x80\xE2\xAB\x9A\xE2\xA8\xB9\xE2\xA8\xBB\xE2\xA6"
+    "\xA7\xE2\xA6\x9A\xE2\x87\x9D\xE2\xA4\x91\xE2\xAA\xA1\xE2\xA5\x89\xE2\xA9\x98\xE2\xA6\xA8\xE2\xA6"
+    "\xA9\xE2\xA6\xAA\xE2\xA6\xAB\xE2\xA6\xAC\xE2\xA6\xAD\xE2\xA6\xAE\xE2\xA6\xAF\xE2\xA6\x9D\xE2\x88"
+    "\xB3\xE2\x8E\xB6\xE2\x9F\x88\xE2\xA9\x89\xE2\xA8\x90\xE2\xA9\x88\xE2\x88\xB2\xE2\x9F\xBF\xE2\x8F"
+    "\xA7\xE2\xA7\xA5\xE2\xA8\x8D\xE2\xAA\x84\xE2\xA7\x9D\xE2\xA8\x97\xE2\xA6\xB4\xE2\xA5\x8B\xE2\xAA"
+    "\x83\xE2\xA5\x8A\xE2\x86\xA5\xE2\xA9\xAD\xCC\xB8\xE2\x8B\xB5\xCC\xB8\xE2\xA8\xB6\xE2\xA8\xA3\xE2"
+    "\xA8\x95\xE2\x8C\xAE\xE2\x8C\x92\xE2\x8C\x93\xE2\xA6\xB3\xE2\xA8\x92\xE2\xA7\x8E\xE2\xA8\x93\xE2"
+    "\xA7\xA4\xE2\xA8\xB1\xE2\xA8\xBA\xE2\x8F\xA2\xCC\x91\xE2\x89\xAD\xE2\x8F\x9E\xE2\x81\x9F\xE2\x80"
+    "\x8A\xE2\x8F\x9F\xE2\xA4\x92\xE2\x86\xA7\xE2\x86\xA4\xE2\x81\x9F\xE2\xA7\xB4\xE2\xA4\x93\xE2\xA5"
+    "\xB0\xE2\xA5\x9A\xE2\xA5\x92\xE2\xAA\xA2\xE2\xA5\x9B\xE2\xA5\x93\xE2\x80\x8B\xE2\xA5\x8E\xE2\xA7"
+    "\x8F\xE2\xA5\xA0\xE2\xA5\x98\xE2\x8A\x8F\xCC\xB8\xE2\x8F\x9C\xE2\x97\xBB\xE2\xA5\x91\xE2\x89\xBF"
+    "\xCC\xB8\xE2\xA7\x90\xE2\xA5\x9C\xE2\xA5\x94\xE2\x8F\x9D\xE2\xA5\x9E\xE2\xA5\x96\xE2\x97\xBC\xE2"
+    "\xA5\xA1\xE2\xA5\x99\xE2\xAA\xA1\xCC\xB8\xE2\x8A\x90\xCC\xB8\xE2\xA5\x8F\xE2\x9D\x98\xE2\xA5\x9F"
+    "\xE2\xA5\x97\xE2\xA7\x8F\xCC\xB8\xE2\xA5\x9D\xE2\xA5\x95\xE2\xA5\x90\xE2\xA7\x90\xCC\xB8\xE2\x96"
+    "\xAB\xE2\xAA\xA2\xCC\xB8";
+
+    // Names in the trie: the nodes a name ends at
+    constexpr size_t entityNameCount()
+    {
+        size_t count = 0;
+        for (const EntityNode & node : kEntityNodes)
+            count += node.valueLength != 0;
+        return count;
+    }
+
+    const size_t kEntityNameCount = 2231;
+    static_assert(entityNameCount() == kEntityNameCount, "every entity name has a node");
+}
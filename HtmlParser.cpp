@@ -1,4 +1,6 @@
 
+#include <HtmlParser.hpp>
+
 #include <boost/config/warning_disable.hpp>
 #include <boost/spirit/include/qi.hpp>
 #include <boost/spirit/include/phoenix_core.hpp>
@@ -8,7 +10,9 @@
 #include <boost/fusion/include/adapt_struct.hpp>
 #include <boost/variant/recursive_variant.hpp>
 #include <boost/foreach.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -20,7 +24,7 @@
 #define HTML_PARSER_DEBUG
 #undef HTML_PARSER_DEBUG
 
-// #region obsolete_AST_based_version
+// #region spirit_AST_based_version
 namespace client
 {
     namespace fusion = boost::fusion;
@@ -50,11 +54,20 @@ namespace client
 {
     const int tabsize = 4;
 
-    // TODO: Need a thread-safe approach iif it is to work
-    // in a multi-threaded manner - requires more work
-    static int gNumLeafNodes = 0;
-    static int gNumNodes = 0;
-    static int gDivNodeCount = 0;
+    // Deepest element the grammar nests; a start tag below it is read as
+    // text. Each level costs a few stack frames while parsing and one
+    // recursion when the AST is walked or freed, so a page of unclosed
+    // elements (<li> after <li>) cannot exhaust the stack: at this depth
+    // parsing takes well under the 1 MB of a default Windows thread stack.
+    const unsigned max_depth = 256;
+
+    // Counts of one parseHtml call
+    struct html_counts
+    {
+        uint64_t nodes = 0;
+        uint64_t leaves = 0;
+        uint64_t divs = 0;
+    };
 
     void tab(int indent)
     {
@@ -63,40 +76,33 @@ namespace client
             std::cout << ' ';
 #endif
     }
-    void incrLeafCount()
-    {
-        gNumLeafNodes++;
-    }
-    void incrNodeCount()
-    {
-        gNumNodes++;
-    }
-    void incrDivCount()
-    {
-        gDivNodeCount ++;
-    }
-    struct mini_html_printer
+
+    // Walks the AST, counting into the caller's html_counts. A leaf is an
+    // element without child elements (text does not count), as for the
+    // tokenizer.
+    struct mini_html_counter
     {
-        mini_html_printer(int indent = 0)
-          : indent(indent)
+        mini_html_counter(html_counts & counts, int indent = 0)
+          : counts(counts), indent(indent)
         {
         }
 
         void operator()(mini_html const& html) const;
 
+        html_counts & counts;
         int indent;
     };
 
-    struct mini_html_node_printer : boost::static_visitor<>
+    struct mini_html_node_counter : boost::static_visitor<>
     {
-        mini_html_node_printer(int indent = 0)
-          : indent(indent)
+        mini_html_node_counter(html_counts & counts, int indent = 0)
+          : counts(counts), indent(indent)
         {
         }
 
         void operator()(mini_html const& html) const
         {
-            mini_html_printer(indent+tabsize)(html);
+            mini_html_counter(counts, indent+tabsize)(html);
         }
 
         void operator()(std::string const& text) const
@@ -107,24 +113,27 @@ namespace client
 #endif
         }
 
+        html_counts & counts;
         int indent;
     };
 
-    void mini_html_printer::operator()(mini_html const& html) const
+    void mini_html_counter::operator()(mini_html const& html) const
     {
         tab(indent);
 #ifdef HTML_PARSER_DEBUG
         std::cout << "tag: " << html.tag_name ;
 #endif
-         if (html.tag_name == "div") {
-             // Found div increment div count
-            incrDivCount();
-         }
-         if (html.children.size() == 0) {
-            // No children - increment leaf count
-            incrLeafCount();
-         }
-         incrNodeCount();
+        if (boost::algorithm::iequals(html.tag_name, "div")) {
+            // Found div increment div count
+            ++counts.divs;
+        }
+        const bool hasChildElements = std::any_of(html.children.begin(), html.children.end(),
+            [](mini_html_node const& node) { return node.which() == 0; });
+        if (!hasChildElements) {
+            // No child elements - increment leaf count
+            ++counts.leaves;
+        }
+        ++counts.nodes;
 #ifdef HTML_PARSER_DEBUG
         std::cout << std::endl;
 #endif
@@ -134,7 +143,7 @@ namespace client
 #endif
         BOOST_FOREACH(mini_html_node const& node, html.children)
         {
-            boost::apply_visitor(mini_html_node_printer(indent), node);
+            boost::apply_visitor(mini_html_node_counter(counts, indent), node);
         }
 
         tab(indent);
@@ -144,64 +153,175 @@ namespace client
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Skips what is not part of the tree between tokens: whitespace,
+    // comments, and doctypes, processing instructions and CDATA sections
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    struct mini_html_skipper : qi::grammar<Iterator>
+    {
+        mini_html_skipper()
+          : mini_html_skipper::base_type(skip)
+        {
+            using qi::standard::char_;
+            using ascii::space;
+            using qi::lit;
+
+            comment = "<!--" >> *(char_ - "-->") >> "-->";
+            cdata = "<![CDATA[" >> *(char_ - "]]>") >> "]]>";
+            declaration = '<' >> char_("!?") >> *(char_ - '>') >> '>';
+            skip = space | comment | cdata | declaration;
+        }
+
+        qi::rule<Iterator> skip, comment, cdata, declaration;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // Html grammar definition
+    //
+    // Tolerates what real pages do: attributes (quoted values may contain
+    // '>'), upper-case and mismatched-case end tags, void elements without
+    // an end tag (<br>, <img ...>), self-closing tags, <script> and <style>
+    // contents with '<' in them, a '<' in text that does not start a tag,
+    // missing end tags (the element ends where its parent does) and stray
+    // end tags (skipped). Elements nest up to max_depth; deeper start tags
+    // are flat text.
     ///////////////////////////////////////////////////////////////////////////
     template <typename Iterator>
     struct mini_html_grammar
-      : qi::grammar<Iterator, mini_html(), qi::locals<std::string>, ascii::space_type>
+      : qi::grammar<Iterator, std::vector<mini_html_node>(), mini_html_skipper<Iterator> >
     {
+        typedef mini_html_skipper<Iterator> skipper_type;
+
         mini_html_grammar()
-          : mini_html_grammar::base_type(html)
+          : mini_html_grammar::base_type(document)
         {
-            using namespace boost::spirit::ascii;
             using qi::lit;
             using qi::lexeme;
-            using qi::eoi;
-            using qi::eol;
             using qi::attr;
             using qi::omit;
-            using qi::alnum;
+            using qi::hold;
+            using qi::no_case;
+            using qi::eps;
+            using qi::raw;
             using qi::as_string;
-            using ascii::char_;
+            using ascii::alnum;
+            using ascii::alpha;
+            using qi::standard::char_;
             using ascii::string;
-            using ascii::space;
             using namespace qi::labels;
 
-            text %= lexeme[+(char_ - '<')];
-            
-            node %= html | text;
+            name_char = alnum | char_("-_:.");
+            tag_name %= alpha >> *name_char;
+
+            void_name %=
+                    no_case[
+                        string("area") | string("base") | string("br") | string("col")
+                      | string("embed") | string("hr") | string("img") | string("input")
+                      | string("link") | string("meta") | string("param") | string("source")
+                      | string("track") | string("wbr") | string("keygen")
+                    ]
+                >>  !name_char
+            ;
+
+            raw_name %=
+                    no_case[
+                        string("script") | string("style") | string("textarea") | string("title")
+                      | string("xmp") | string("iframe") | string("noembed") | string("noframes")
+                    ]
+                >>  !name_char
+            ;
+
+            attributes =
+                *(  ('"' >> *(char_ - '"') >> '"')
+                  | ('\'' >> *(char_ - '\'') >> '\'')
+                  | ('/' >> !lit('>'))
+                  | (char_ - char_("\"'/>"))
+                 )
+            ;
+
+            text %= lexeme[+((char_ - '<') | (char_('<') >> !(alpha | char_("/!?"))))];
+
+            empty_element %=
+                    '<'
+                >>  lexeme[
+                        hold[void_name >> omit[attributes] >> -lit('/') >> '>']
+                      | (tag_name >> omit[attributes] >> "/>")
+                    ]
+                >>  attr(std::vector<mini_html_node>())
+            ;
+
+            raw_element %=
+                    '<'
+                >>  lexeme[
+                        raw_name[_a = _1]
+                    >>  omit[attributes] >> '>'
+                    >>  omit[*(char_ - ("</" >> no_case[string(_a)]))]
+                    >>  "</" >> omit[no_case[string(_a)]] >> omit[*(char_ - '>')] >> '>'
+                    ]
+                >>  attr(std::vector<mini_html_node>())
+            ;
 
             start_tag %=
                     '<'
-                >>  !(lit('/'))
-                >>  lexeme[+(char_ - '>')] 
-                >>  '>'
+                >>  lexeme[tag_name >> omit[attributes] >> '>']
             ;
 
+            flat_tag %= as_string[raw[lexeme['<' >> tag_name >> attributes >> '>']]];
+
             end_tag =
                     "</"
-                >>  string(_r1)
+                >>  lexeme[no_case[string(_r1)] >> !name_char]
                 >>  '>'
             ;
-            
+
+            stray_end_tag =
+                    "</"
+                >>  lexeme[*(char_ - '>')]
+                >>  '>'
+            ;
+
+            // Children end at any end tag: theirs, or one that closes an
+            // ancestor, in which case the element was not closed
+            // _r1 is the depth of the element
             html %=
-                    start_tag[_a = _1]
-                >>  *node 
-                >>  end_tag(_a)
+                    eps(_r1 < max_depth)
+                >>  start_tag[_a = _1]
+                >>  *(!lit("</") >> node(_r1 + 1))
+                >>  -end_tag(_a)
             ;
+
+            // A failed alternative leaves the name it read in the attribute:
+            // hold[] puts it back
+            element %= hold[empty_element] | hold[raw_element] | html(_r1);
+
+            // A start tag is only left over for flat_tag below max_depth
+            node %= element(_r1) | text | flat_tag;
+
+            document %= *(node(0u) | omit[stray_end_tag]);
         }
 
-        qi::rule<Iterator, mini_html(), qi::locals<std::string>, ascii::space_type> html;
-        qi::rule<Iterator, mini_html_node(), ascii::space_type> node;
-        qi::rule<Iterator, std::string(), ascii::space_type> text;
-        qi::rule<Iterator, std::string(), ascii::space_type> start_tag;
-        qi::rule<Iterator, void(std::string), ascii::space_type> end_tag;
+        qi::rule<Iterator, std::vector<mini_html_node>(), skipper_type> document;
+        qi::rule<Iterator, mini_html_node(unsigned), skipper_type> node;
+        qi::rule<Iterator, mini_html(unsigned), skipper_type> element;
+        qi::rule<Iterator, mini_html(unsigned), qi::locals<std::string>, skipper_type> html;
+        qi::rule<Iterator, mini_html(), skipper_type> empty_element;
+        qi::rule<Iterator, mini_html(), qi::locals<std::string>, skipper_type> raw_element;
+        qi::rule<Iterator, std::string(), skipper_type> text;
+        qi::rule<Iterator, std::string(), skipper_type> start_tag;
+        qi::rule<Iterator, std::string(), skipper_type> flat_tag;
+        qi::rule<Iterator, void(std::string), skipper_type> end_tag;
+        qi::rule<Iterator, skipper_type> stray_end_tag;
+        qi::rule<Iterator, std::string()> tag_name;
+        qi::rule<Iterator, std::string()> void_name;
+        qi::rule<Iterator, std::string()> raw_name;
+        qi::rule<Iterator, char()> name_char;
+        qi::rule<Iterator> attributes;
     };
     //]
 }
 
-// #endregion obsolete_AST_based_version
+// #endregion spirit_AST_based_version
 
 
 std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std::string & rawHtml) {
@@ -222,12 +342,14 @@ std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std:
     // TODO: This kind of pre-filtering of expressions using regex would be prone to 
     // parsing errors due to lack of context.
     std::regex remove_js_expr("([=]*(<|>)[0-9=+])");
+    // Each stage's text is released as soon as the next one is built, so at
+    // most two copies of the page are held besides the input
     auto firstStageOut = firstStage.str();
-    firstStage.clear();
-    std::stringstream secondStage;
-    secondStage << std::regex_replace(firstStageOut, remove_js_expr,"");
+    firstStage.str(std::string());
+    auto secondStateOut = std::regex_replace(firstStageOut, remove_js_expr,"");
+    std::string().swap(firstStageOut);
 #ifdef HTML_PARSER_DEBUG
-    std::cout << std::endl << " Stage 2 Output" << std::endl << secondStage.str() <<std::endl;
+    std::cout << std::endl << " Stage 2 Output" << std::endl << secondStateOut <<std::endl;
 #endif
     // Given html with no line-endings transforms to only include HTML tags
     // with beginning and endings. For some meaningless ones like doctype
@@ -239,8 +361,6 @@ std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std:
     //      <meta/>	::FROM::	<meta name="viewport" content="width=device-width,initial-scale=1.0"/>
     //      </head>	::FROM::	</head>
     std::regex tag_capture("(<([a-zA-Z0-9/]*)(.*?)(/*)>)");
-    auto secondStateOut = secondStage.str();
-    secondStage.clear();
     auto it2 = std::sregex_iterator(secondStateOut.begin(), secondStateOut.end(), tag_capture);
     
     const std::vector<std::string> selfClosingTags = {
@@ -320,6 +440,7 @@ std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std:
             ++numNodes;
         }
     }
+    std::string().swap(secondStateOut);
 #ifdef HTML_PARSER_DEBUG
     std::cout << std::endl << " Stage 3 Output" << std::endl << thirdStage.str() <<std::endl;
 #endif
@@ -327,7 +448,7 @@ std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std:
     std::stringstream fourthStage;
     std::regex leaf_capture("(<([a-zA-Z0-9]+)><(/)([a-zA-Z0-9]+)>)");
     auto thirdStageOut = thirdStage.str();
-    thirdStage.clear();
+    thirdStage.str(std::string());
 
         // At this point we assume that the html has been cleaned enough
         // that we are only left with tags such that each tag has an open
@@ -342,61 +463,53 @@ std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std:
         if (match[2].compare(match[4])==0 && match[3].compare("/")==0)
             ++numLeafNodes;
     }
-    return {numNodes, numLeafNodes, numDivNodes, thirdStageOut}; 
+    return std::make_tuple(numNodes, numLeafNodes, numDivNodes, std::move(thirdStageOut));
 }
 
-// Url string  client::gNumNodes
-std::tuple<uint64_t, uint64_t, uint64_t> parseHtml(int id, const std::string & storage) {
-    
-    // tuple to return with analysis statistics
-    std::tuple<uint64_t, uint64_t, uint64_t> retVal = {id, 0U, 0U};
-    client::gNumLeafNodes = 0;
-
+/**
+ * Counts elements with the Boost.Spirit grammar: the page is parsed into an
+ * AST, which is then walked. Slower than the tokenizer and without the tree
+ * construction rules of HTML (no implied elements or end tags beyond the
+ * tolerance of the grammar); kept as a backend to compare against. Elements
+ * nested deeper than max_depth are not counted, their start tags being read
+ * as text.
+ *
+ * Reentrant: counts go to a per-call context, and each thread builds the
+ * grammar (which is costly) once and reuses it for every page.
+ *
+ * @param storage   raw html
+ * @return {# nodes, # leaf nodes, # div nodes} of what was parsed; if the
+ *         grammar stops early the counts cover the page up to there
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> parseHtml(const std::string & storage) {
     typedef client::mini_html_grammar<std::string::const_iterator> mini_html_grammar;
-    
-    mini_html_grammar root; // Grammar
-    client::mini_html ast;  // AST tree
+    thread_local const mini_html_grammar grammar;
+    thread_local const mini_html_grammar::skipper_type skipper;
 
-    using boost::spirit::ascii::space;
+    client::html_counts counts;
+    if (storage.empty())
+        return std::make_tuple(counts.nodes, counts.leaves, counts.divs);
+
+    std::vector<client::mini_html_node> ast;
     std::string::const_iterator iter = storage.begin();
     std::string::const_iterator end = storage.end();
-    if (storage.empty()) {
-        std::cout << "-------------------------\n";
-        std::cout << "Unable to parse URL\n";
-        std::cout << "-------------------------\n";
+    boost::spirit::qi::phrase_parse(iter, end, grammar, skipper, ast);
 
-        return retVal;
-    }
-    bool r = phrase_parse(iter, end, root, space, ast);
-    
-    if (r && iter == end)
-    {
-        std::cout << "-------------------------\n";
-        std::cout << "Parsing succeeded\n";
-        std::cout << "-------------------------\n";
-        client::mini_html_printer printer;
-        printer(ast);
-
-        retVal = { client::gNumNodes, client::gNumLeafNodes, client::gDivNodeCount};
-
-        std::cout << "Nodes = "     << std::get<0>(retVal)
-                << "Leaf nodes = "  << std::get<1>(retVal)
-                << "Leaf nodes = "  << std::get<2>(retVal)
-                << std::endl;
-
-        client::gNumNodes = 0;
-        client::gNumLeafNodes = 0;
-        client::gDivNodeCount = 0;
-    }
-    else
+    client::mini_html_node_counter counter(counts, -client::tabsize);
+    for (const client::mini_html_node & node : ast)
+        boost::apply_visitor(counter, node);
+
+#ifdef HTML_PARSER_DEBUG
+    // Also happens on ordinary truncated pages; serialized because the
+    // parser runs on the analysis threads
+    if (iter != end)
     {
-        std::string::const_iterator some = iter+30;
-        std::string context(iter, (some>end)?end:some);
-        std::cout << "-------------------------\n";
-        std::cout << "Parsing failed\n";
-        std::cout << "stopped at: \": " << context << "...\"\n";
-        std::cout << "-------------------------\n";
+        std::string::const_iterator some = end - iter > 30 ? iter + 30 : end;
+        std::string context(iter, some);
+        #pragma omp critical
+        std::cerr << "Spirit parser stopped at offset " << (iter - storage.begin())
+                  << ": \"" << context << "...\"" << std::endl;
     }
-    return retVal;
+#endif
+    return std::make_tuple(counts.nodes, counts.leaves, counts.divs);
 }
-
@@ -1,6 +1,8 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <tuple>
 
 std::tuple<uint64_t, uint64_t, uint64_t, std::string> getCleanDomTree(const std::string & rawHtml);
+// Counts from a Boost.Spirit grammar (AST); thread-safe, for comparisons
 std::tuple<uint64_t, uint64_t, uint64_t> parseHtml(const std::string & html);
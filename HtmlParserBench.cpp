@@ -0,0 +1,605 @@
+// Throughput benchmark for the html analyzers: the four-stage regex
+// pipeline (getCleanDomTree) and the Spirit grammar (parseHtml) against
+// the single-pass tokenizer (countDomNodes) with each SIMD scanning kernel,
+// against the same counts from a custom visitor (visitHtml), from the
+// document fed in pieces (IncrementalDomCounter), by nesting alone
+// (countNestedDomNodes), from all threads
+// splitting the document (countDomNodesParallel) and after the charset
+// check (PageDecoder), and against building a token stream
+// (HtmlTokenStream), with its text decoded (decodedText), or an element
+// tree (HtmlDom), with its attributes read. Runs on the given html files,
+// or on synthetic pages when none are given.
+//
+// The counts of every analyzer built on the tokenizer must equal those of
+// countDomNodes, also with the document fed in random pieces, in single
+// bytes, cut at every offset of a document of adversarial markup, or split
+// across 2 to 8 threads at every offset of it, and when a tag left open
+// runs to the end of the document; otherwise the benchmark reports the
+// difference and exits with 1. Deeply nested unclosed elements check that
+// the recursive Spirit grammar stays within the stack.
+//
+// USAGE: HtmlParserBench [file.html ...]
+
+#include <HtmlParser.hpp>
+#include <HtmlCharset.hpp>
+#include <HtmlDom.hpp>
+#include <HtmlEntities.hpp>
+#include <HtmlPushTokenizer.hpp>
+#include <HtmlTokenizer.hpp>
+#include <HtmlVisitor.hpp>
+#include <SimdScan.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+    typedef std::tuple<uint64_t, uint64_t, uint64_t> Counts;
+
+    // Minimum time spent on each analyzer per input
+    const double kMinSeconds = 1.0;
+
+    // Piece size for the push tokenizer: a typical TCP segment
+    const size_t kSegmentBytes = 1460;
+
+    // Largest random piece, and how many random layouts each page is fed in
+    const size_t kMaxPieceBytes = 3000;
+    const unsigned kRandomLayouts = 20;
+
+    // Markup that is easy to cut in the wrong place: end tags, comments and
+    // "</script" inside scripts, attribute values with '<' and '>', raw text
+    // elements, CDATA, stray and unknown tags
+    const char kAdversarialBlock[] =
+        "<div class=\"a<b\" data-x='>'>x<!-- <p> -- > --!><!----><p>t</p></div>"
+        "<script>if (a</b) s = \"</scr\" + \"ipt>\"; // <div></div> </scripts></script >"
+        "<textarea><p></textarea ></textarea><style>a > b {}</style>"
+        "<svg><![CDATA[<div>]]><g/></svg>< p><br/></span></x-y><X-Y><x-y>k</X-y></x-Y>"
+        "<!DOCTYPE html><?pi <div>?><p a=1 b c='<'>z</p ></body>\n";
+
+    /**
+     * Builds a page resembling a typical content site: a head with meta,
+     * link and script tags, and a body of nested divs with paragraphs,
+     * links, images and lists.
+     *
+     * @param targetBytes   approximate size of the page
+     * @return html
+     */
+    std::string makeSyntheticPage(size_t targetBytes)
+    {
+        std::ostringstream html;
+        html << "<!DOCTYPE html>\n<html lang=\"en\">\n<head>\n"
+             << "<meta charset=\"utf-8\">\n"
+             << "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\n"
+             << "<title>Synthetic page</title>\n"
+             << "<link rel=\"stylesheet\" href=\"/static/site.css\">\n"
+             << "<script>var items = [1, 2, 3]; for (var i = 0; i < items.length; i++) { total += items[i]; }</script>\n"
+             << "</head>\n<body class=\"home\">\n";
+        for (unsigned section = 0; static_cast<size_t>(html.tellp()) < targetBytes; ++section) {
+            html << "<div class=\"section\" id=\"s" << section << "\">\n"
+                 << "  <div class=\"header\"><h2>Section " << section << "</h2></div>\n"
+                 << "  <!-- section " << section << " content -->\n"
+                 << "  <p>Lorem ipsum dolor sit amet, <a href=\"/item?id=" << section
+                 << "&amp;ref=home\">consectetur</a> adipiscing elit, sed do eiusmod tempor"
+                 << " incididunt ut labore et dolore magna aliqua.<br>Ut enim ad minim veniam.</p>\n"
+                 << "  <img src=\"/img/" << section << ".jpg\" alt=\"picture > 1\" width=\"640\">\n"
+                 << "  <ul>\n";
+            for (unsigned item = 0; item < 5; ++item)
+                html << "    <li><a href=\"/list/" << item << "\" title='item " << item << "'>Item "
+                     << item << "</a></li>\n";
+            html << "  </ul>\n"
+                 << "  <div class=\"footer\"><span></span><input type=\"text\" name=\"q\"></div>\n"
+                 << "</div>\n";
+        }
+        html << "</body>\n</html>\n";
+        return html.str();
+    }
+
+    /**
+     * Builds a page dominated by inline scripts, as produced by most
+     * frameworks: bundles full of comparisons and html templates in string
+     * literals, and a small body.
+     *
+     * @param targetBytes   approximate size of the page
+     * @return html
+     */
+    std::string makeScriptHeavyPage(size_t targetBytes)
+    {
+        std::ostringstream html;
+        html << "<!DOCTYPE html>\n<html>\n<head>\n<title>Script-heavy page</title>\n"
+             << "<style>.card > a { color: red; } a[href^=\"<\"] { display: none; }</style>\n";
+        for (unsigned bundle = 0; static_cast<size_t>(html.tellp()) < targetBytes; ++bundle) {
+            html << "<script type=\"text/javascript\">\n";
+            for (unsigned function = 0; function < 64; ++function)
+                html << "function render" << bundle << "_" << function << "(items) { var out = '';"
+                     << " for (var i = 0; i < items.length && i<100; i++) { if (items[i].n<0) continue;"
+                     << " out += '<div class=\"item\"><a href=\"' + items[i].url + '\">' + items[i].name"
+                     << " + '</a><br></div>'; } return out; }\n";
+            html << "</script>\n";
+        }
+        html << "</head>\n<body>\n<div id=\"app\"><p>Loading</p></div>\n</body>\n</html>\n";
+        return html.str();
+    }
+
+    /**
+     * Builds a page like those of large WordPress sites: block editor
+     * comments around every block, plugin banners, conditional comments
+     * and commented-out markup.
+     *
+     * @param targetBytes   approximate size of the page
+     * @return html
+     */
+    std::string makeCommentHeavyPage(size_t targetBytes)
+    {
+        std::ostringstream html;
+        html << "<!DOCTYPE html>\n<?xml-stylesheet href=\"style.xsl\"?>\n<html>\n<head>\n"
+             << "<!-- This site is optimized with an SEO plugin - https://example.com/seo/ -->\n"
+             << "<!--[if lt IE 9]><script src=\"html5shiv.js\"></script><![endif]-->\n"
+             << "</head>\n<body>\n";
+        for (unsigned block = 0; static_cast<size_t>(html.tellp()) < targetBytes; ++block) {
+            html << "<!-- wp:group {\"layout\":{\"type\":\"constrained\"}} -->\n"
+                 << "<div class=\"wp-block-group\"><!-- wp:paragraph -->\n"
+                 << "<p>Block " << block << " text.</p>\n<!-- /wp:paragraph -->\n"
+                 << "<!-- <div class=\"old-banner\"><a href=\"/promo\"><img src=\"/promo.png\"></a></div> -->\n"
+                 << "<!--\n  Cached page generated by a caching plugin. Served from: example.com @ 2021-01-01 00:00:00\n"
+                 << "  Page caching using disk enhanced, minified using disk, database caching 3/112 queries\n"
+                 << "  <link rel=\"preload\" href=\"/wp-content/cache/minify/a.css\"> -- not closed here -- -->\n"
+                 << "<svg><![CDATA[ if (a < b && c > d) { x = \"<g>\"; } ]]></svg>\n"
+                 << "</div><!-- /wp:group -->\n";
+        }
+        html << "</body>\n</html>\n";
+        return html.str();
+    }
+
+    // The counts of countDomNodes as an analysis written against the
+    // visitor API, which should run just as fast
+    struct CountingVisitor : HtmlVisitor {
+        uint64_t nodes = 0;
+        uint64_t leaves = 0;
+        uint64_t divs = 0;
+        uint32_t lastOpenDepth = 0;
+
+        void onElementOpen(Tag tag, boost::string_view, uint32_t depth)
+        {
+            ++nodes;
+            divs += tag == Tag::Div;
+            lastOpenDepth = depth;
+        }
+
+        void onElementClose(Tag, uint32_t depth)
+        {
+            leaves += depth == lastOpenDepth;
+            lastOpenDepth = 0;
+        }
+    };
+
+    bool readFile(const std::string & path, std::string & contents)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+        contents = buffer.str();
+        return true;
+    }
+
+    /**
+     * Runs an analyzer repeatedly for at least kMinSeconds and keeps the
+     * fastest run, which is the least disturbed by other load
+     *
+     * @param analyze   analyzer to time
+     * @param bytes     input size
+     * @param counts    counts returned by the last run
+     * @return throughput of the fastest run in MB/s
+     */
+    double measure(const std::function<Counts()> & analyze, size_t bytes, Counts & counts)
+    {
+        typedef std::chrono::steady_clock clock;
+        const auto start = clock::now();
+        double fastest = 0;
+        for (auto runStart = start; std::chrono::duration<double>(runStart - start).count() < kMinSeconds; ) {
+            counts = analyze();
+            const auto runEnd = clock::now();
+            const double seconds = std::chrono::duration<double>(runEnd - runStart).count();
+            if (fastest == 0 || seconds < fastest)
+                fastest = seconds;
+            runStart = runEnd;
+        }
+        return bytes / fastest / 1e6;
+    }
+
+    /**
+     * Compares an analyzer's counts with the reference, reporting a
+     * difference on std::cerr
+     *
+     * @param what      analyzer and input
+     * @param counts    its counts
+     * @param expected  counts of the reference analyzer
+     * @return true if they are equal
+     */
+    bool sameCounts(const std::string & what, const Counts & counts, const Counts & expected)
+    {
+        if (counts == expected)
+            return true;
+        std::cerr << "MISMATCH " << what << ": " << std::get<0>(counts) << "/" << std::get<1>(counts) << "/"
+                  << std::get<2>(counts) << ", expected " << std::get<0>(expected) << "/"
+                  << std::get<1>(expected) << "/" << std::get<2>(expected) << std::endl;
+        return false;
+    }
+
+    /**
+     * Feeds a document to a push counter in pieces
+     *
+     * @param html  document
+     * @param ends  end offsets of the pieces but the last, ascending
+     * @return the counter's counts
+     */
+    template <class Counter>
+    Counts feedPieces(const std::string & html, const std::vector<size_t> & ends)
+    {
+        Counter counter;
+        size_t offset = 0;
+        for (size_t end : ends) {
+            counter.feed(html.data() + offset, end - offset);
+            offset = end;
+        }
+        counter.feed(html.data() + offset, html.size() - offset);
+        return counter.finish();
+    }
+
+    /**
+     * Checks the push counters against the one-shot counts with the
+     * document fed in random pieces of 1 to kMaxPieceBytes bytes, and in
+     * single bytes
+     *
+     * @param name  of the input
+     * @param html  document
+     * @return true if all counts agree
+     */
+    bool checkPieces(const std::string & name, const std::string & html)
+    {
+        const Counts expected = countDomNodes(html);
+        const Counts expectedNested = countNestedDomNodes(html.data(), html.size());
+        bool agree = true;
+        std::mt19937 random(1);
+        std::uniform_int_distribution<size_t> pieceBytes(1, kMaxPieceBytes);
+        std::vector<size_t> ends;
+        for (unsigned layout = 0; layout <= kRandomLayouts; ++layout) {
+            ends.clear();
+            // The last layout is one byte at a time
+            for (size_t end = layout < kRandomLayouts ? pieceBytes(random) : 1; end < html.size();
+                 end += layout < kRandomLayouts ? pieceBytes(random) : 1)
+                ends.push_back(end);
+            const std::string what = name + ", layout " + std::to_string(layout);
+            agree &= sameCounts("push, " + what, feedPieces<IncrementalDomCounter>(html, ends), expected);
+            agree &= sameCounts("bitstack push, " + what, feedPieces<NestingDomCounter>(html, ends),
+                                expectedNested);
+        }
+        return agree;
+    }
+
+    /**
+     * Checks the push counters cut at every offset of a document of
+     * adversarial blocks, and the parallel counter with its chunk
+     * boundaries moved across every offset of a block, for 2 to 8 threads
+     *
+     * @return true if all counts agree
+     */
+    bool checkAdversarialSplits()
+    {
+        bool agree = true;
+        std::string html;
+        for (int i = 0; i < 3; ++i)
+            html += kAdversarialBlock;
+        const Counts expected = countDomNodes(html);
+        const Counts expectedNested = countNestedDomNodes(html.data(), html.size());
+        for (size_t cut = 1; cut < html.size(); ++cut) {
+            const std::string what = "adversarial, cut at " + std::to_string(cut);
+            agree &= sameCounts("push, " + what, feedPieces<IncrementalDomCounter>(html, {cut}), expected);
+            agree &= sameCounts("bitstack push, " + what, feedPieces<NestingDomCounter>(html, {cut}),
+                                expectedNested);
+        }
+        agree &= checkPieces("adversarial", html);
+
+        // Just enough blocks for one chunk of the parallel counter per
+        // thread (chunks are at least 64 KB). Spaces in front, which do not
+        // change the counts, move the chunk boundaries through the blocks.
+        const size_t blockBytes = sizeof(kAdversarialBlock) - 1;
+        for (unsigned numThreads = 2; numThreads <= 8; ++numThreads) {
+            std::string blocks;
+            while (blocks.size() < numThreads * 64 * 1024 + blockBytes)
+                blocks += kAdversarialBlock;
+            const Counts expectedBlocks = countDomNodes(blocks);
+            for (size_t padding = 0; padding < blockBytes; ++padding) {
+                html.assign(padding, ' ');
+                html += blocks;
+                agree &= sameCounts("parallel, adversarial, " + std::to_string(numThreads) + " threads, padding "
+                                    + std::to_string(padding),
+                                    countDomNodesParallel(html.data(), html.size(), numThreads), expectedBlocks);
+            }
+        }
+        std::cout << "adversarial splits: " << (agree ? "counts agree" : "COUNTS DIFFER") << std::endl << std::endl;
+        return agree;
+    }
+
+    void printRow(const std::string & name, double mbPerSecond, const Counts & counts)
+    {
+        std::cout << "  " << std::setw(10) << std::left << name << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(2) << mbPerSecond << " MB/s"
+                  << std::setw(12) << std::get<0>(counts)
+                  << std::setw(12) << std::get<1>(counts)
+                  << std::setw(12) << std::get<2>(counts)
+                  << std::defaultfloat << std::endl;
+    }
+
+    /**
+     * Times the push counter on documents ending in one tag that is never
+     * closed (in its name, between attributes, in a quoted or an unquoted
+     * value), fed one TCP segment at a time: the tag is kept across all
+     * the pieces and must still be scanned in linear time
+     *
+     * @return true if the counts agree with the one-shot counts
+     */
+    bool checkUnclosedTags()
+    {
+        const size_t tagBytes = 4 << 20;
+        const std::string prefix = "<div><p>text</p>";
+        const std::string tags[] = {"<x", "<div class=a ", "<div title=\"", "<div title="};
+        const char * names[] = {"name", "attributes", "quoted", "unquoted"};
+        bool agree = true;
+        std::cout << "unclosed tags, " << tagBytes / (1 << 20) << " MB fed in " << kSegmentBytes
+                  << "-byte pieces" << std::endl;
+        for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+            std::string html = prefix + tags[i];
+            html.append(tagBytes, i == 1 ? ' ' : 'x');
+            const Counts expected = countDomNodes(html);
+            Counts counts;
+            const double rate = measure([&html]() {
+                IncrementalDomCounter counter;
+                for (size_t offset = 0; offset < html.size(); offset += kSegmentBytes)
+                    counter.feed(html.data() + offset, std::min(kSegmentBytes, html.size() - offset));
+                return counter.finish();
+            }, html.size(), counts);
+            agree &= sameCounts(std::string("push, unclosed tag ") + names[i], counts, expected);
+            printRow(names[i], rate, counts);
+        }
+        std::cout << std::endl;
+        return agree;
+    }
+
+    /**
+     * Runs the recursive backends on 100,000 list items that are never
+     * closed: the Spirit grammar nests them (up to its depth limit) and
+     * must return instead of running out of stack. The tokenizer closes
+     * each <li> at the next one.
+     *
+     * @return true if the tokenizer counts every item and the push
+     *         counters agree with it
+     */
+    bool checkUnclosedElements()
+    {
+        const uint64_t items = 100000;
+        std::string html = "<ul>";
+        for (uint64_t i = 0; i < items; ++i)
+            html += "<li>item ";
+        std::cout << "unclosed elements, " << items << " <li>" << std::endl;
+        Counts spiritCounts;
+        const double spiritRate = measure([&html]() {
+            return parseHtml(html);
+        }, html.size(), spiritCounts);
+        printRow("spirit", spiritRate, spiritCounts);
+        // Besides the ul and the items: html, head (a leaf) and body
+        const Counts expected(items + 4, items + 1, 0);
+        Counts tokenizerCounts;
+        const double tokenizerRate = measure([&html]() {
+            return countDomNodes(html);
+        }, html.size(), tokenizerCounts);
+        printRow("tokenizer", tokenizerRate, tokenizerCounts);
+        bool agree = sameCounts("tokenizer, unclosed <li>", tokenizerCounts, expected);
+        agree &= checkPieces("unclosed <li>", html);
+        std::cout << std::endl;
+        return agree;
+    }
+
+    /**
+     * Times every analyzer on a document and checks the counts of those
+     * built on the tokenizer against countDomNodes
+     *
+     * @param name  of the input
+     * @param html  document
+     * @return true if the counts agree
+     */
+    bool benchmark(const std::string & name, const std::string & html)
+    {
+        const Counts expected = countDomNodes(html);
+        bool agree = true;
+
+        std::cout << name << " (" << html.size() << " bytes)" << std::endl
+                  << "  " << std::setw(10) << std::left << "analyzer" << std::right
+                  << std::setw(17) << "throughput"
+                  << std::setw(12) << "# Nodes"
+                  << std::setw(12) << "# Leaf"
+                  << std::setw(12) << "# Div" << std::endl;
+
+        Counts regexCounts;
+        const double regexRate = measure([&html]() {
+            auto stats = getCleanDomTree(html);
+            return Counts(std::get<0>(stats), std::get<1>(stats), std::get<2>(stats));
+        }, html.size(), regexCounts);
+        printRow("regex", regexRate, regexCounts);
+
+        Counts spiritCounts;
+        const double spiritRate = measure([&html]() {
+            return parseHtml(html);
+        }, html.size(), spiritCounts);
+        printRow("spirit", spiritRate, spiritCounts);
+
+        // The tokenizer once per scanning kernel the CPU supports
+        double tokenizerRate = 0;
+        for (int isa = 0; isa <= static_cast<int>(simd::bestIsa()); ++isa) {
+            simd::setIsa(static_cast<simd::Isa>(isa));
+            Counts tokenizerCounts;
+            tokenizerRate = measure([&html]() {
+                return countDomNodes(html);
+            }, html.size(), tokenizerCounts);
+            printRow(simd::isaName(simd::activeIsa()), tokenizerRate, tokenizerCounts);
+            agree &= sameCounts(std::string(simd::isaName(simd::activeIsa())) + ", " + name, tokenizerCounts,
+                                expected);
+        }
+
+        Counts visitorCounts;
+        const double visitorRate = measure([&html]() {
+            CountingVisitor visitor;
+            visitHtml(html, visitor);
+            return Counts(visitor.nodes, visitor.leaves, visitor.divs);
+        }, html.size(), visitorCounts);
+        agree &= sameCounts("visitor, " + name, visitorCounts, expected);
+        printRow("visitor", visitorRate, visitorCounts);
+
+        // The document as it would arrive from the network, one TCP segment
+        // at a time
+        Counts pushCounts;
+        const double pushRate = measure([&html]() {
+            IncrementalDomCounter counter;
+            for (size_t offset = 0; offset < html.size(); offset += kSegmentBytes)
+                counter.feed(html.data() + offset, std::min(kSegmentBytes, html.size() - offset));
+            return counter.finish();
+        }, html.size(), pushCounts);
+        agree &= sameCounts("push, " + name, pushCounts, expected);
+        printRow("push", pushRate, pushCounts);
+
+        // Nesting only, without the tree construction rules
+        Counts bitstackCounts;
+        const double bitstackRate = measure([&html]() {
+            return countNestedDomNodes(html.data(), html.size());
+        }, html.size(), bitstackCounts);
+        printRow("bitstack", bitstackRate, bitstackCounts);
+        agree &= checkPieces(name, html);
+
+        // One document split across all hardware threads
+        const unsigned numThreads = std::max(1u, std::thread::hardware_concurrency());
+        Counts parallelCounts;
+        const double parallelRate = measure([&html, numThreads]() {
+            return countDomNodesParallel(html.data(), html.size(), numThreads);
+        }, html.size(), parallelCounts);
+        printRow("parallel", parallelRate, parallelCounts);
+        agree &= sameCounts("parallel, " + name, parallelCounts, expected);
+        for (unsigned threads = 2; threads <= 8; ++threads)
+            agree &= sameCounts("parallel, " + std::to_string(threads) + " threads, " + name,
+                                countDomNodesParallel(html.data(), html.size(), threads), expected);
+        std::cout << "  " << numThreads << " threads" << std::endl;
+
+        // Charset detection and UTF-8 validation before counting, as main
+        // does for every page, and the validation pass alone
+        PageDecoder decoder;
+        Counts charsetCounts;
+        const double charsetRate = measure([&html, &decoder]() {
+            const boost::string_view page = decoder.decode(html, boost::string_view());
+            return countDomNodes(page.data(), page.size());
+        }, html.size(), charsetCounts);
+        printRow("charset", charsetRate, charsetCounts);
+        Counts validationCounts;
+        const double validationRate = measure([&html]() {
+            simd::validateUtf8(html.data(), html.data() + html.size());
+            return Counts();
+        }, html.size(), validationCounts);
+        std::cout << "  " << decoder.charset().name << " (" << charsetSourceName(decoder.charset().source)
+                  << "), validation " << std::fixed << std::setprecision(2) << validationRate
+                  << " MB/s" << std::defaultfloat << std::endl;
+
+        // Token stream (reused, so no allocation after the first run) and
+        // counting from the tokens
+        HtmlTokenStream stream;
+        Counts streamCounts;
+        const double streamRate = measure([&html, &stream]() {
+            stream.tokenize(html);
+            return countDomNodes(stream);
+        }, html.size(), streamCounts);
+        agree &= sameCounts("tokens, " + name, streamCounts, expected);
+        printRow("tokens", streamRate, streamCounts);
+        std::cout << "  " << stream.size() << " tokens, "
+                  << stream.size() * sizeof(HtmlToken) / 1024 << " KB" << std::endl;
+
+        // Every text run and attribute value decoded, as a text metric would
+        // need them; those without '&' are not copied
+        std::string scratch;
+        size_t decodedBytes = 0;
+        Counts entityCounts;
+        const double entityRate = measure([&html, &stream, &scratch, &decodedBytes]() {
+            stream.tokenize(html);
+            decodedBytes = 0;
+            for (const HtmlToken & token : stream)
+                decodedBytes += stream.decodedText(token, scratch).size();
+            return countDomNodes(stream);
+        }, html.size(), entityCounts);
+        agree &= sameCounts("entities, " + name, entityCounts, expected);
+        printRow("entities", entityRate, entityCounts);
+        std::cout << "  " << decodedBytes << " bytes of text after decoding" << std::endl;
+
+        // Tree (reused, so the arena is recycled) and its metrics
+        HtmlDom dom;
+        Counts domCounts;
+        HtmlDom::Metrics metrics;
+        const double domRate = measure([&html, &dom, &metrics]() {
+            dom.build(html);
+            metrics = dom.metrics();
+            return Counts(metrics.nodes, metrics.leaves, metrics.divs);
+        }, html.size(), domCounts);
+        agree &= sameCounts("dom, " + name, domCounts, expected);
+        printRow("dom", domRate, domCounts);
+        std::cout << "  max depth " << metrics.maxDepth << ", arena "
+                  << dom.arenaBytes() / 1024 << " KB" << std::endl;
+
+        // The tree plus a query on every element's class, which parses all
+        // start tags' attributes
+        Counts classCounts;
+        uint64_t withClass = 0;
+        const double classRate = measure([&html, &dom, &withClass]() {
+            dom.build(html);
+            withClass = 0;
+            boost::string_view value;
+            for (HtmlDom::NodeId node = 1; node < dom.size(); ++node)
+                withClass += dom.findAttribute(node, "class", value);
+            const HtmlDom::Metrics metrics = dom.metrics();
+            return Counts(metrics.nodes, metrics.leaves, metrics.divs);
+        }, html.size(), classCounts);
+        agree &= sameCounts("dom+class, " + name, classCounts, expected);
+        printRow("dom+class", classRate, classCounts);
+        std::cout << "  " << withClass << " elements with a class" << std::endl;
+
+        std::cout << "  speedup (" << simd::isaName(simd::bestIsa()) << ") "
+                  << std::fixed << std::setprecision(1) << tokenizerRate / regexRate << "x" << std::defaultfloat << std::endl << std::endl;
+        return agree;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    bool agree = checkAdversarialSplits();
+    agree &= checkUnclosedTags();
+    agree &= checkUnclosedElements();
+    if (argc < 2) {
+        agree &= benchmark("synthetic", makeSyntheticPage(1 << 20));
+        agree &= benchmark("script-heavy", makeScriptHeavyPage(1 << 20));
+        agree &= benchmark("comment-heavy", makeCommentHeavyPage(1 << 20));
+        return agree ? 0 : 1;
+    }
+    for (int i = 1; i < argc; ++i) {
+        std::string html;
+        if (!readFile(argv[i], html)) {
+            std::cerr << "Cannot read " << argv[i] << std::endl;
+            return 1;
+        }
+        agree &= benchmark(argv[i], html);
+    }
+    return agree ? 0 : 1;
+}
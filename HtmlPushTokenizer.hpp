@@ -0,0 +1,406 @@
+#pragma once
+
+#include <HtmlTags.hpp>
+#include <HtmlTokenizer.hpp>
+#include <SimdScan.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+
+// Push-style tokenizer: takes a document in pieces of any size, as they
+// come off the network, and gives a handler the same tokens as tokenize()
+// on the whole document, except that text runs may be split where pieces
+// meet. Tags can be cut anywhere, even inside their name.
+//
+// Between pieces it keeps a mode (data, tag, comment, CDATA, bogus comment
+// or raw text) and only the bytes it cannot decide on yet: an incomplete
+// tag, or the last few bytes of a comment or script that may start its
+// closing sequence. Comments and scripts are never buffered, whatever their
+// size. An incomplete tag is buffered, but its scan resumes where the last
+// piece stopped (in the name, between attributes or inside a value), so a
+// tag cut into many pieces is still scanned in linear time.
+//
+// Pointers given to the handler are valid during the callback only, as they
+// may point into a piece or into the kept bytes; lt and tagEnd are not
+// positions in the document. Handlers that keep names, such as the tree
+// builder, must copy them (OpenElementStack's copyNames).
+template <class Handler>
+class HtmlPushTokenizer final {
+public:
+    explicit HtmlPushTokenizer(Handler & handler) : m_handler(handler) {}
+    HtmlPushTokenizer(const HtmlPushTokenizer &) = delete;
+    HtmlPushTokenizer & operator=(const HtmlPushTokenizer &) = delete;
+
+    void feed(const char * data, size_t size);
+    // End of the document: tokenizes what was kept as tokenize() would at
+    // the end, and resets for the next document
+    void finish();
+
+    // Bytes kept between pieces
+    size_t pendingBytes() const { return m_pending.size(); }
+
+private:
+    enum class Mode : uint8_t { Data, Tag, Comment, CData, BogusComment, RawText };
+    // Where the scan of an incomplete tag stopped, as in skipAttributes
+    enum class TagScan : uint8_t { Name, Attributes, BeforeValue, QuotedValue, UnquotedValue };
+
+    const char * process(const char * p, const char * end);
+    const char * data(const char * p, const char * end);
+    const char * tag(const char * p, const char * end);
+    const char * comment(const char * p, const char * end);
+    const char * cdata(const char * p, const char * end);
+    const char * bogusComment(const char * p, const char * end);
+    const char * rawText(const char * p, const char * end);
+
+    // Switches to the tag mode for a tag whose name starts nameOffset
+    // bytes after its '<'
+    void startTagScan(size_t nameOffset)
+    {
+        m_mode = Mode::Tag;
+        m_tagScan = TagScan::Name;
+        m_tagScanned = nameOffset;
+    }
+
+    void text(const char * p, const char * end)
+    {
+        if (Handler::kWantsText && end > p)
+            m_handler.text(p, end - p);
+    }
+
+    Handler & m_handler;
+    Mode m_mode = Mode::Data;
+    std::string m_pending;          // kept bytes, to be followed by the next piece
+    std::string m_rawTextName;      // of the element whose contents are being read
+    TagScan m_tagScan = TagScan::Name;
+    char m_quote = '\0';            // of the value being read
+    size_t m_tagScanned = 0;        // bytes of the kept tag scanned so far
+};
+
+// The counts of countDomNodes for a document that arrives in pieces.
+// finish() returns them and resets the counter for the next document.
+class IncrementalDomCounter final {
+public:
+    IncrementalDomCounter();
+    ~IncrementalDomCounter();
+
+    void feed(const char * data, size_t size);
+    std::tuple<uint64_t, uint64_t, uint64_t> finish();
+
+private:
+    struct State;
+    std::unique_ptr<State> m_state;
+};
+
+// The counts of countNestedDomNodes for a document that arrives in pieces.
+// Keeps the nesting and the tokenizer's kept bytes only, so a document of
+// any size can be counted from a stream.
+class NestingDomCounter final {
+public:
+    NestingDomCounter();
+    ~NestingDomCounter();
+
+    void feed(const char * data, size_t size);
+    std::tuple<uint64_t, uint64_t, uint64_t> finish();
+
+private:
+    struct State;
+    std::unique_ptr<State> m_state;
+};
+
+/**
+ * Tokenizes a piece of the document. When bytes were kept from the previous
+ * piece the two are joined first, so a piece is copied at most once.
+ *
+ * @param data  next bytes of the document
+ * @param size  number of bytes, may be 0
+ */
+template <class Handler>
+void HtmlPushTokenizer<Handler>::feed(const char * data, size_t size)
+{
+    if (m_pending.empty()) {
+        const char * keep = process(data, data + size);
+        m_pending.assign(keep, data + size);
+    } else {
+        m_pending.append(data, size);
+        const char * begin = m_pending.data();
+        const char * keep = process(begin, begin + m_pending.size());
+        m_pending.erase(0, keep - begin);
+    }
+}
+
+template <class Handler>
+void HtmlPushTokenizer<Handler>::finish()
+{
+    using namespace html_detail;
+    const char * begin = m_pending.data();
+    const char * end = begin + m_pending.size();
+    if (m_mode == Mode::Data || m_mode == Mode::Tag) {
+        tokenizeRange(begin, end, end, m_handler);
+    } else if (m_mode == Mode::RawText) {
+        // A closing "</script" without anything after it ends the text
+        text(begin, findRawTextEnd(begin, end, m_rawTextName.data(), m_rawTextName.size()));
+    }
+    // An unterminated comment runs to the end of the document
+    m_pending.clear();
+    m_mode = Mode::Data;
+}
+
+/**
+ * Runs the modes over a piece until one of them needs more input. A mode
+ * returns without switching to another only when it has used up the piece.
+ *
+ * @param p     start of the piece (with the kept bytes)
+ * @param end   end of the piece
+ * @return first byte to keep for the next piece
+ */
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::process(const char * p, const char * end)
+{
+    for (;;) {
+        const Mode mode = m_mode;
+        switch (mode) {
+        case Mode::Data:            p = data(p, end); break;
+        case Mode::Tag:             p = tag(p, end); break;
+        case Mode::Comment:         p = comment(p, end); break;
+        case Mode::CData:           p = cdata(p, end); break;
+        case Mode::BogusComment:    p = bogusComment(p, end); break;
+        case Mode::RawText:         p = rawText(p, end); break;
+        }
+        if (m_mode == mode)
+            return p;
+    }
+}
+
+/**
+ * Data state: text and tags, as in tokenizeRange, except that a tag is only
+ * passed on once its '>' is in the piece; until then it is kept from its
+ * '<' in the tag mode. So is markup too short to tell what it is ("<",
+ * "</", "<!-"), in the data state.
+ *
+ * @param p     position in the data state
+ * @param end   end of the piece
+ * @return where the next mode starts, or the first byte to keep
+ */
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::data(const char * p, const char * end)
+{
+    using namespace html_detail;
+    const char * textStart = p;
+    for (;;) {
+        const char * lt = simd::find(p, end, '<');
+        if (lt == end || end - lt < 2) {
+            text(textStart, lt);
+            return lt;
+        }
+        p = lt + 1;
+
+        const char c = *p;
+        if (isAlpha(c)) {
+            // Start tag
+            const char * name = p;
+            p = scanTagName(p, end);
+            const size_t length = p - name;
+            bool selfClosing = false;
+            const char * gt = skipAttributes(p, end, selfClosing);
+            text(textStart, lt);
+            if (gt == end) {
+                startTagScan(name - lt);
+                return lt;
+            }
+            const Tag tag = lookupTag(name, length);
+            m_handler.startTag(lt, name, length, tag);
+            if (Handler::kWantsAttributes)
+                gt = readAttributes(p, end, m_handler, selfClosing);
+            if (hasTagProperty(tag, TagProperty::RawText | TagProperty::EscapableRawText)) {
+                m_handler.startTagClose(false, gt + 1);
+                m_rawTextName.assign(name, length);
+                m_mode = Mode::RawText;
+                return gt + 1;
+            }
+            m_handler.startTagClose(selfClosing, gt + 1);
+            textStart = p = gt + 1;
+        } else if (c == '/' && p + 1 == end) {
+            text(textStart, lt);
+            return lt;
+        } else if (c == '/' && isAlpha(p[1])) {
+            // End tag
+            const char * name = p + 1;
+            p = scanTagName(name, end);
+            const size_t length = p - name;
+            bool selfClosing = false;
+            p = skipAttributes(p, end, selfClosing);
+            text(textStart, lt);
+            if (p == end) {
+                startTagScan(name - lt);
+                return lt;
+            }
+            m_handler.endTag(lt, name, length, lookupTag(name, length), p + 1);
+            textStart = ++p;
+        } else if (c == '!' || c == '?' || c == '/') {
+            // Not elements: skipped without a token
+            text(textStart, lt);
+            if (c != '!') {
+                m_mode = Mode::BogusComment;
+                return p;
+            }
+            const size_t available = end - p;
+            if (available >= 3 && std::char_traits<char>::compare(p, "!--", 3) == 0) {
+                // "<!-->" and "<!--->" are empty comments
+                if (available < 5)
+                    return lt;
+                if (p[3] == '>' || (p[3] == '-' && p[4] == '>')) {
+                    textStart = p += p[3] == '>' ? 4 : 5;
+                    continue;
+                }
+                m_mode = Mode::Comment;
+                return p + 3;
+            }
+            if (available >= 8 && std::char_traits<char>::compare(p, "![CDATA[", 8) == 0) {
+                m_mode = Mode::CData;
+                return p + 8;
+            }
+            if (std::char_traits<char>::compare(p, "!--", std::min<size_t>(available, 3)) == 0
+                || std::char_traits<char>::compare(p, "![CDATA[", std::min<size_t>(available, 8)) == 0)
+                return lt;
+            m_mode = Mode::BogusComment;
+            return p;
+        }
+        // Anything else: a literal '<' in text
+    }
+}
+
+/**
+ * An incomplete tag, kept from its '<': scans the bytes added since the last
+ * piece with the rules of scanTagName and skipAttributes, from the state
+ * they stopped in. Once the closing '>' is in, the data state passes the
+ * whole tag on.
+ *
+ * @param p     the '<' of the tag
+ * @param end   end of the piece
+ * @return p, which the data state resumes at or which is kept
+ */
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::tag(const char * p, const char * end)
+{
+    using namespace html_detail;
+    const simd::ByteSet tagDelimiters('>', '=');
+    const char * q = p + m_tagScanned;
+    while (q < end) {
+        switch (m_tagScan) {
+        case TagScan::Name:
+            q = scanTagName(q, end);
+            if (q < end)
+                m_tagScan = TagScan::Attributes;
+            break;
+        case TagScan::Attributes:
+            q = simd::findAny(q, end, tagDelimiters);
+            if (q < end && *q == '>') {
+                m_mode = Mode::Data;
+                return p;
+            }
+            if (q < end) {
+                m_tagScan = TagScan::BeforeValue;
+                ++q;
+            }
+            break;
+        case TagScan::BeforeValue:
+            while (q < end && isSpace(*q))
+                ++q;
+            if (q < end && (*q == '"' || *q == '\'')) {
+                m_tagScan = TagScan::QuotedValue;
+                m_quote = *q++;
+            } else if (q < end) {
+                m_tagScan = TagScan::UnquotedValue;
+            }
+            break;
+        case TagScan::QuotedValue:
+            q = simd::find(q, end, m_quote);
+            if (q < end) {
+                m_tagScan = TagScan::Attributes;
+                ++q;
+            }
+            break;
+        case TagScan::UnquotedValue:
+            while (q < end && !isSpace(*q) && *q != '>')
+                ++q;
+            if (q < end && *q == '>') {
+                m_mode = Mode::Data;
+                return p;
+            }
+            if (q < end)
+                m_tagScan = TagScan::Attributes;
+            break;
+        }
+    }
+    m_tagScanned = q - p;
+    return p;
+}
+
+/**
+ * Inside a comment: up to "-->" or "--!>". If the end is not in the piece,
+ * the trailing dashes (and a '!' after two of them) are kept, as the
+ * closing sequence may continue in the next piece.
+ */
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::comment(const char * p, const char * end)
+{
+    if (const char * close = html_detail::findCommentEnd(p, end)) {
+        m_mode = Mode::Data;
+        return close;
+    }
+    if (end - p >= 3 && end[-1] == '!' && end[-2] == '-' && end[-3] == '-')
+        return end - 3;
+    const char * keep = end;
+    while (keep > p && end - keep < 2 && keep[-1] == '-')
+        --keep;
+    return keep;
+}
+
+// Inside a CDATA section: up to "]]>", keeping up to two trailing ']'
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::cdata(const char * p, const char * end)
+{
+    if (const char * close = html_detail::findCDataEnd(p, end)) {
+        m_mode = Mode::Data;
+        return close;
+    }
+    const char * keep = end;
+    while (keep > p && end - keep < 2 && keep[-1] == ']')
+        --keep;
+    return keep;
+}
+
+// Doctypes, processing instructions and other bogus comments end at '>'
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::bogusComment(const char * p, const char * end)
+{
+    const char * gt = simd::find(p, end, '>');
+    if (gt == end)
+        return end;
+    m_mode = Mode::Data;
+    return gt + 1;
+}
+
+/**
+ * Contents of a raw-text element, up to its end tag. The end tag is only
+ * recognized with the byte after its name; until then the last bytes that
+ * may start it are kept, and the text before them is passed on.
+ */
+template <class Handler>
+const char * HtmlPushTokenizer<Handler>::rawText(const char * p, const char * end)
+{
+    const size_t length = m_rawTextName.size();
+    const char * close = html_detail::findRawTextEnd(p, end, m_rawTextName.data(), length);
+    if (close != end && static_cast<size_t>(end - close) > length + 2) {
+        text(p, close);
+        m_mode = Mode::Data;
+        return close;
+    }
+    const char * keep = static_cast<size_t>(end - p) > length + 2 ? end - (length + 2) : p;
+    text(p, keep);
+    return keep;
+}
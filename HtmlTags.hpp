@@ -0,0 +1,355 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Known HTML tag names, interned as small integer ids with property bits,
+// and a perfect hash from (case-insensitive) name to id that is built at
+// compile time. Classifying a tag costs one pass over its name to hash it,
+// two table reads and one compare to confirm the match.
+
+namespace TagProperty {
+    enum : uint16_t {
+        Void = 1 << 0,              // no content, no end tag: <br>
+        RawText = 1 << 1,           // content is text up to the end tag: <script>
+        EscapableRawText = 1 << 2,  // same, but entities are decoded: <title>
+        Formatting = 1 << 3,        // formatting element of the tree builder: <b>
+        Special = 1 << 4,           // "special" category of the tree builder: <div>
+        Foreign = 1 << 5,           // starts SVG or MathML content
+    };
+}
+
+// X(id, name, properties)
+#define HTML_TAGS(X) \
+    X(A, "a", TagProperty::Formatting) \
+    X(Abbr, "abbr", 0) \
+    X(Acronym, "acronym", 0) \
+    X(Address, "address", TagProperty::Special) \
+    X(Applet, "applet", TagProperty::Special) \
+    X(Area, "area", TagProperty::Void | TagProperty::Special) \
+    X(Article, "article", TagProperty::Special) \
+    X(Aside, "aside", TagProperty::Special) \
+    X(Audio, "audio", 0) \
+    X(B, "b", TagProperty::Formatting) \
+    X(Base, "base", TagProperty::Void | TagProperty::Special) \
+    X(Basefont, "basefont", TagProperty::Void | TagProperty::Special) \
+    X(Bdi, "bdi", 0) \
+    X(Bdo, "bdo", 0) \
+    X(Bgsound, "bgsound", TagProperty::Void | TagProperty::Special) \
+    X(Big, "big", TagProperty::Formatting) \
+    X(Blink, "blink", 0) \
+    X(Blockquote, "blockquote", TagProperty::Special) \
+    X(Body, "body", TagProperty::Special) \
+    X(Br, "br", TagProperty::Void | TagProperty::Special) \
+    X(Button, "button", TagProperty::Special) \
+    X(Canvas, "canvas", 0) \
+    X(Caption, "caption", TagProperty::Special) \
+    X(Center, "center", TagProperty::Special) \
+    X(Cite, "cite", 0) \
+    X(Code, "code", TagProperty::Formatting) \
+    X(Col, "col", TagProperty::Void | TagProperty::Special) \
+    X(Colgroup, "colgroup", TagProperty::Special) \
+    X(Command, "command", TagProperty::Void) \
+    X(Data, "data", 0) \
+    X(Datalist, "datalist", 0) \
+    X(Dd, "dd", TagProperty::Special) \
+    X(Del, "del", 0) \
+    X(Details, "details", TagProperty::Special) \
+    X(Dfn, "dfn", 0) \
+    X(Dialog, "dialog", 0) \
+    X(Dir, "dir", TagProperty::Special) \
+    X(Div, "div", TagProperty::Special) \
+    X(Dl, "dl", TagProperty::Special) \
+    X(Dt, "dt", TagProperty::Special) \
+    X(Em, "em", TagProperty::Formatting) \
+    X(Embed, "embed", TagProperty::Void | TagProperty::Special) \
+    X(Fieldset, "fieldset", TagProperty::Special) \
+    X(Figcaption, "figcaption", TagProperty::Special) \
+    X(Figure, "figure", TagProperty::Special) \
+    X(Font, "font", TagProperty::Formatting) \
+    X(Footer, "footer", TagProperty::Special) \
+    X(Form, "form", TagProperty::Special) \
+    X(Frame, "frame", TagProperty::Void | TagProperty::Special) \
+    X(Frameset, "frameset", TagProperty::Special) \
+    X(H1, "h1", TagProperty::Special) \
+    X(H2, "h2", TagProperty::Special) \
+    X(H3, "h3", TagProperty::Special) \
+    X(H4, "h4", TagProperty::Special) \
+    X(H5, "h5", TagProperty::Special) \
+    X(H6, "h6", TagProperty::Special) \
+    X(Head, "head", TagProperty::Special) \
+    X(Header, "header", TagProperty::Special) \
+    X(Hgroup, "hgroup", TagProperty::Special) \
+    X(Hr, "hr", TagProperty::Void | TagProperty::Special) \
+    X(Html, "html", TagProperty::Special) \
+    X(I, "i", TagProperty::Formatting) \
+    X(Iframe, "iframe", TagProperty::RawText | TagProperty::Special) \
+    X(Image, "image", 0) \
+    X(Img, "img", TagProperty::Void | TagProperty::Special) \
+    X(Input, "input", TagProperty::Void | TagProperty::Special) \
+    X(Ins, "ins", 0) \
+    X(Isindex, "isindex", 0) \
+    X(Kbd, "kbd", 0) \
+    X(Keygen, "keygen", TagProperty::Void | TagProperty::Special) \
+    X(Label, "label", 0) \
+    X(Legend, "legend", 0) \
+    X(Li, "li", TagProperty::Special) \
+    X(Link, "link", TagProperty::Void | TagProperty::Special) \
+    X(Listing, "listing", TagProperty::Special) \
+    X(Main, "main", TagProperty::Special) \
+    X(Map, "map", 0) \
+    X(Mark, "mark", 0) \
+    X(Marquee, "marquee", TagProperty::Special) \
+    X(Math, "math", TagProperty::Foreign) \
+    X(Menu, "menu", TagProperty::Special) \
+    X(Menuitem, "menuitem", 0) \
+    X(Meta, "meta", TagProperty::Void | TagProperty::Special) \
+    X(Meter, "meter", 0) \
+    X(Nav, "nav", TagProperty::Special) \
+    X(Nobr, "nobr", TagProperty::Formatting) \
+    X(Noembed, "noembed", TagProperty::RawText | TagProperty::Special) \
+    X(Noframes, "noframes", TagProperty::RawText | TagProperty::Special) \
+    X(Noscript, "noscript", TagProperty::Special) \
+    X(Object, "object", TagProperty::Special) \
+    X(Ol, "ol", TagProperty::Special) \
+    X(Optgroup, "optgroup", 0) \
+    X(Option, "option", 0) \
+    X(Output, "output", 0) \
+    X(P, "p", TagProperty::Special) \
+    X(Param, "param", TagProperty::Void | TagProperty::Special) \
+    X(Picture, "picture", 0) \
+    X(Plaintext, "plaintext", TagProperty::RawText | TagProperty::Special) \
+    X(Pre, "pre", TagProperty::Special) \
+    X(Progress, "progress", 0) \
+    X(Q, "q", 0) \
+    X(Rb, "rb", 0) \
+    X(Rp, "rp", 0) \
+    X(Rt, "rt", 0) \
+    X(Rtc, "rtc", 0) \
+    X(Ruby, "ruby", 0) \
+    X(S, "s", TagProperty::Formatting) \
+    X(Samp, "samp", 0) \
+    X(Script, "script", TagProperty::RawText | TagProperty::Special) \
+    X(Search, "search", TagProperty::Special) \
+    X(Section, "section", TagProperty::Special) \
+    X(Select, "select", TagProperty::Special) \
+    X(Slot, "slot", 0) \
+    X(Small, "small", TagProperty::Formatting) \
+    X(Source, "source", TagProperty::Void | TagProperty::Special) \
+    X(Span, "span", 0) \
+    X(Strike, "strike", TagProperty::Formatting) \
+    X(Strong, "strong", TagProperty::Formatting) \
+    X(Style, "style", TagProperty::RawText | TagProperty::Special) \
+    X(Sub, "sub", 0) \
+    X(Summary, "summary", TagProperty::Special) \
+    X(Sup, "sup", 0) \
+    X(Svg, "svg", TagProperty::Foreign) \
+    X(Table, "table", TagProperty::Special) \
+    X(Tbody, "tbody", TagProperty::Special) \
+    X(Td, "td", TagProperty::Special) \
+    X(Template, "template", TagProperty::Special) \
+    X(Textarea, "textarea", TagProperty::EscapableRawText | TagProperty::Special) \
+    X(Tfoot, "tfoot", TagProperty::Special) \
+    X(Th, "th", TagProperty::Special) \
+    X(Thead, "thead", TagProperty::Special) \
+    X(Time, "time", 0) \
+    X(Title, "title", TagProperty::EscapableRawText | TagProperty::Special) \
+    X(Tr, "tr", TagProperty::Special) \
+    X(Track, "track", TagProperty::Void | TagProperty::Special) \
+    X(Tt, "tt", TagProperty::Formatting) \
+    X(U, "u", TagProperty::Formatting) \
+    X(Ul, "ul", TagProperty::Special) \
+    X(Var, "var", 0) \
+    X(Video, "video", 0) \
+    X(Wbr, "wbr", TagProperty::Void | TagProperty::Special) \
+    X(Xmp, "xmp", TagProperty::RawText | TagProperty::Special)
+
+enum class Tag : uint8_t {
+    Unknown,
+#define HTML_TAG_ENUM(id, name, properties) id,
+    HTML_TAGS(HTML_TAG_ENUM)
+#undef HTML_TAG_ENUM
+    Count
+};
+
+namespace tags_detail {
+    struct TagInfo {
+        const char * name;      // lower case
+        uint16_t properties;
+    };
+
+    constexpr TagInfo kTagInfo[] = {
+        {"", 0},
+#define HTML_TAG_INFO(id, name, properties) {name, static_cast<uint16_t>(properties)},
+        HTML_TAGS(HTML_TAG_INFO)
+#undef HTML_TAG_INFO
+    };
+
+    const size_t kNumTags = static_cast<size_t>(Tag::Count);
+    static_assert(sizeof(kTagInfo) / sizeof(kTagInfo[0]) == kNumTags, "tag info out of sync with Tag");
+
+    // Two-level perfect hash ("hash and displace"): a name's hash picks a
+    // bucket, and the bucket's displacement picks the slot. Displacements
+    // are searched at compile time, largest buckets first, until every
+    // name has a slot of its own.
+    const size_t kNumBuckets = 64;
+    const size_t kNumSlots = 256;
+    const uint32_t kMaxDisplacement = 1 << 16;
+
+    // 'A'-'Z' fold to 'a'-'z'; digits and the other bytes of tag names
+    // already have bit 5 set
+    constexpr uint32_t foldCase(char c)
+    {
+        return static_cast<uint32_t>(static_cast<unsigned char>(c)) | 0x20u;
+    }
+
+    // FNV-1a of the case-folded name
+    constexpr uint32_t hashName(const char * name, size_t length)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < length; ++i)
+            hash = (hash ^ foldCase(name[i])) * 16777619u;
+        return hash;
+    }
+
+    constexpr size_t bucketOf(uint32_t hash)
+    {
+        return hash % kNumBuckets;
+    }
+
+    constexpr size_t slotOf(uint32_t hash, uint32_t displacement)
+    {
+        uint32_t h = hash ^ (displacement * 0x9e3779b9u);
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        return h % kNumSlots;
+    }
+
+    constexpr size_t nameLength(const char * name)
+    {
+        size_t length = 0;
+        while (name[length])
+            ++length;
+        return length;
+    }
+
+    struct TagHashTable {
+        uint16_t displacement[kNumBuckets];
+        uint8_t slotTag[kNumSlots];     // Tag::Unknown for empty slots
+        bool complete;
+    };
+
+    constexpr TagHashTable buildTagHashTable()
+    {
+        TagHashTable table{};
+
+        // Group tag ids by bucket (counting sort)
+        uint32_t hashes[kNumTags] = {};
+        size_t bucketStart[kNumBuckets + 1] = {};
+        for (size_t tag = 1; tag < kNumTags; ++tag) {
+            hashes[tag] = hashName(kTagInfo[tag].name, nameLength(kTagInfo[tag].name));
+            ++bucketStart[bucketOf(hashes[tag]) + 1];
+        }
+        size_t largestBucket = 0;
+        for (size_t bucket = 0; bucket < kNumBuckets; ++bucket) {
+            if (bucketStart[bucket + 1] > largestBucket)
+                largestBucket = bucketStart[bucket + 1];
+            bucketStart[bucket + 1] += bucketStart[bucket];
+        }
+        size_t bucketTags[kNumTags] = {};
+        size_t filled[kNumBuckets] = {};
+        for (size_t tag = 1; tag < kNumTags; ++tag) {
+            const size_t bucket = bucketOf(hashes[tag]);
+            bucketTags[bucketStart[bucket] + filled[bucket]++] = tag;
+        }
+
+        table.complete = true;
+        for (size_t size = largestBucket; size > 0; --size) {
+            for (size_t bucket = 0; bucket < kNumBuckets; ++bucket) {
+                const size_t first = bucketStart[bucket];
+                if (bucketStart[bucket + 1] - first != size)
+                    continue;
+                bool placed = false;
+                for (uint32_t displacement = 0; displacement < kMaxDisplacement && !placed; ++displacement) {
+                    // The bucket's names must land on free, distinct slots
+                    bool fits = true;
+                    for (size_t i = 0; i < size && fits; ++i) {
+                        const size_t slot = slotOf(hashes[bucketTags[first + i]], displacement);
+                        fits = table.slotTag[slot] == 0;
+                        for (size_t j = 0; j < i && fits; ++j)
+                            fits = slotOf(hashes[bucketTags[first + j]], displacement) != slot;
+                    }
+                    if (!fits)
+                        continue;
+                    for (size_t i = 0; i < size; ++i) {
+                        const size_t tag = bucketTags[first + i];
+                        table.slotTag[slotOf(hashes[tag], displacement)] = static_cast<uint8_t>(tag);
+                    }
+                    table.displacement[bucket] = static_cast<uint16_t>(displacement);
+                    placed = true;
+                }
+                if (!placed)
+                    table.complete = false;
+            }
+        }
+        return table;
+    }
+
+    constexpr TagHashTable kTagHashTable = buildTagHashTable();
+    static_assert(kTagHashTable.complete, "no perfect hash for the tag names; grow kNumSlots");
+
+    constexpr bool equalsFolded(const char * name, size_t length, const char * lower)
+    {
+        for (size_t i = 0; i < length; ++i)
+            if (lower[i] == '\0' || foldCase(name[i]) != static_cast<unsigned char>(lower[i]))
+                return false;
+        return lower[length] == '\0';
+    }
+}
+
+/**
+ * Interned id of a tag name, case-insensitive
+ *
+ * @param name      tag name, not null-terminated
+ * @param length    length of the name
+ * @return the tag, or Tag::Unknown
+ */
+constexpr Tag lookupTag(const char * name, size_t length)
+{
+    using namespace tags_detail;
+    const uint32_t hash = hashName(name, length);
+    const uint8_t tag = kTagHashTable.slotTag[slotOf(hash, kTagHashTable.displacement[bucketOf(hash)])];
+    return tag != 0 && equalsFolded(name, length, kTagInfo[tag].name) ? static_cast<Tag>(tag) : Tag::Unknown;
+}
+
+constexpr uint16_t tagProperties(Tag tag)
+{
+    return tags_detail::kTagInfo[static_cast<size_t>(tag)].properties;
+}
+
+constexpr bool hasTagProperty(Tag tag, uint16_t property)
+{
+    return (tagProperties(tag) & property) != 0;
+}
+
+constexpr const char * tagName(Tag tag)
+{
+    return tags_detail::kTagInfo[static_cast<size_t>(tag)].name;
+}
+
+namespace tags_detail {
+    constexpr bool everyTagFindsItself()
+    {
+        for (size_t tag = 1; tag < kNumTags; ++tag)
+            if (lookupTag(kTagInfo[tag].name, nameLength(kTagInfo[tag].name)) != static_cast<Tag>(tag))
+                return false;
+        return true;
+    }
+
+    static_assert(everyTagFindsItself(), "perfect hash maps a tag name to the wrong id");
+    static_assert(lookupTag("DIV", 3) == Tag::Div && lookupTag("Br", 2) == Tag::Br, "lookup must ignore case");
+    static_assert(lookupTag("divx", 4) == Tag::Unknown && lookupTag("", 0) == Tag::Unknown, "unknown names");
+    static_assert(hasTagProperty(Tag::Img, TagProperty::Void) && !hasTagProperty(Tag::Div, TagProperty::Void),
+                  "void property");
+}
@@ -0,0 +1,640 @@
+#include <HtmlTokenizer.hpp>
+#include <HtmlEntities.hpp>
+#include <HtmlPushTokenizer.hpp>
+#include <HtmlVisitor.hpp>
+#include <SimdScan.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace html_detail;
+
+namespace {
+    inline char toLower(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
+    const char * skipPast(const char * p, const char * end, char c)
+    {
+        p = simd::find(p, end, c);
+        return p == end ? end : p + 1;
+    }
+
+    bool startsWith(const char * p, const char * end, const char * prefix, size_t length)
+    {
+        return static_cast<size_t>(end - p) >= length && std::memcmp(p, prefix, length) == 0;
+    }
+
+    /**
+     * Skips the rest of a comment, see findCommentEnd
+     *
+     * @param p     first character after "<!--"
+     * @param end   end of the buffer
+     * @return position after the comment
+     */
+    const char * skipComment(const char * p, const char * end)
+    {
+        // "<!-->" and "<!--->" are empty comments
+        if (p < end && *p == '>')
+            return p + 1;
+        if (startsWith(p, end, "->", 2))
+            return p + 2;
+        const char * close = findCommentEnd(p, end);
+        return close ? close : end;
+    }
+
+    // Counts the elements of the tree as they are opened and closed. Elements
+    // close in reverse order of opening, so an element is a leaf if nothing
+    // was opened since it.
+    struct DomCounter : HtmlVisitor {
+        uint64_t numNodes = 0;
+        uint64_t numLeafNodes = 0;
+        uint64_t numDivNodes = 0;
+        bool lastWasOpen = false;
+
+        void onElementOpen(Tag tag, boost::string_view, uint32_t)
+        {
+            ++numNodes;
+            if (tag == Tag::Div)
+                ++numDivNodes;
+            lastWasOpen = true;
+        }
+
+        void onElementClose(Tag, uint32_t)
+        {
+            if (lastWasOpen)
+                ++numLeafNodes;
+            lastWasOpen = false;
+        }
+    };
+
+    // Counts elements by nesting alone (countNestedDomNodes). The open
+    // elements are a stack of one bit each, set once the element has an
+    // element child, and of tag keys to match end tags with: the tag id for
+    // known tags, else a hash of the lower-case name with the top bit set.
+    // How many elements of each key are open is counted alongside, so an
+    // end tag for an element that is not open costs O(1) on broken markup.
+    struct NestingCounter {
+        static const bool kWantsAttributes = false;
+        static const bool kWantsText = false;
+
+        uint64_t numNodes = 0;
+        uint64_t numLeafNodes = 0;
+        uint64_t numDivNodes = 0;
+        std::vector<uint64_t> hasChild;     // one bit per open element
+        std::vector<uint32_t> keys;
+        uint32_t knownOpen[tags_detail::kNumTags] = {};     // by tag id
+        std::unordered_map<uint32_t, uint32_t> unknownOpen; // by hash, no zeros
+        uint32_t pendingKey = 0;            // of the start tag being read
+
+        static uint32_t keyOf(const char * name, size_t length, Tag tag)
+        {
+            if (tag != Tag::Unknown)
+                return static_cast<uint32_t>(tag);
+            uint32_t hash = 2166136261u;    // FNV-1a
+            for (size_t i = 0; i < length; ++i)
+                hash = (hash ^ static_cast<uint8_t>(toLower(name[i]))) * 16777619u;
+            return hash | 0x80000000u;
+        }
+
+        void open(uint32_t key)
+        {
+            const size_t depth = keys.size();
+            if (depth != 0)
+                hasChild[(depth - 1) / 64] |= uint64_t(1) << ((depth - 1) % 64);
+            if (depth / 64 == hasChild.size())
+                hasChild.push_back(0);
+            hasChild[depth / 64] &= ~(uint64_t(1) << (depth % 64));
+            keys.push_back(key);
+            if (key < tags_detail::kNumTags)
+                ++knownOpen[key];
+            else
+                ++unknownOpen[key];
+        }
+
+        void close()
+        {
+            const size_t depth = keys.size() - 1;
+            if (!(hasChild[depth / 64] & (uint64_t(1) << (depth % 64))))
+                ++numLeafNodes;
+            const uint32_t key = keys.back();
+            if (key < tags_detail::kNumTags) {
+                --knownOpen[key];
+            } else {
+                const auto it = unknownOpen.find(key);
+                if (--it->second == 0)
+                    unknownOpen.erase(it);
+            }
+            keys.pop_back();
+        }
+
+        bool isOpen(uint32_t key) const
+        {
+            return key < tags_detail::kNumTags ? knownOpen[key] != 0 : unknownOpen.count(key) != 0;
+        }
+
+        void startTag(const char *, const char * name, size_t length, Tag tag)
+        {
+            pendingKey = keyOf(name, length, tag);
+        }
+
+        void attribute(const char *, size_t, const char *, size_t) {}
+
+        // Void elements and "<x/>" are leaves closed at once
+        void startTagClose(bool selfClosing, const char *)
+        {
+            ++numNodes;
+            if (pendingKey == static_cast<uint32_t>(Tag::Div))
+                ++numDivNodes;
+            open(pendingKey);
+            if (selfClosing || (pendingKey < tags_detail::kNumTags
+                                && hasTagProperty(static_cast<Tag>(pendingKey), TagProperty::Void)))
+                close();
+        }
+
+        // A tag cut off by the end of the document is dropped
+        void unterminatedTag() {}
+
+        void endTag(const char *, const char * name, size_t length, Tag tag, const char *)
+        {
+            // When the element is open, the scan is no longer than the pops
+            const uint32_t key = keyOf(name, length, tag);
+            if (!isOpen(key))
+                return;
+            const auto open = std::find(keys.rbegin(), keys.rend(), key);
+            for (auto closing = open - keys.rbegin() + 1; closing > 0; --closing)
+                close();
+        }
+
+        void text(const char *, size_t) {}
+
+        std::tuple<uint64_t, uint64_t, uint64_t> finish()
+        {
+            while (!keys.empty())
+                close();
+            return std::make_tuple(numNodes, numLeafNodes, numDivNodes);
+        }
+    };
+
+    // Appends tokens to a stream; tokens refer to the document by offset
+    struct TokenBuilder {
+        static const bool kWantsAttributes = true;
+        static const bool kWantsText = true;
+
+        std::vector<HtmlToken> & tokens;
+        const char * const base;
+        size_t tagIndex = 0;
+        bool inRawText = false;
+
+        TokenBuilder(std::vector<HtmlToken> & tokens, const char * base) : tokens(tokens), base(base) {}
+
+        void push(HtmlToken::Type type, const char * p, size_t length, Tag tag = Tag::Unknown)
+        {
+            tokens.push_back(HtmlToken{static_cast<uint32_t>(p - base), static_cast<uint32_t>(length), type, 0, tag});
+        }
+
+        void startTag(const char *, const char * name, size_t length, Tag tag)
+        {
+            tagIndex = tokens.size();
+            push(HtmlToken::StartTag, name, length, tag);
+        }
+
+        // value is nullptr for an attribute without '='
+        void attribute(const char * name, size_t nameLength, const char * value, size_t valueLength)
+        {
+            push(HtmlToken::AttributeName, name, nameLength);
+            if (value)
+                push(HtmlToken::AttributeValue, value, valueLength);
+        }
+
+        void startTagClose(bool selfClosing, const char *)
+        {
+            if (selfClosing)
+                tokens[tagIndex].flags |= HtmlToken::SelfClosing;
+            inRawText = hasTagProperty(tokens[tagIndex].tag, TagProperty::RawText);
+        }
+
+        // A tag cut off by the end of the document is dropped
+        void unterminatedTag()
+        {
+            tokens.resize(tagIndex);
+        }
+
+        void endTag(const char *, const char * name, size_t length, Tag tag, const char *)
+        {
+            push(HtmlToken::EndTag, name, length, tag);
+            inRawText = false;
+        }
+
+        void text(const char * p, size_t length)
+        {
+            push(HtmlToken::Text, p, length);
+            if (inRawText)
+                tokens.back().flags |= HtmlToken::RawText;
+        }
+    };
+
+    // Records the start and end tags only, which is all the tree builder needs
+    struct TagTokenBuilder : TokenBuilder {
+        static const bool kWantsAttributes = false;
+        static const bool kWantsText = false;
+
+        using TokenBuilder::TokenBuilder;
+    };
+
+    // Position of the '<' of a tag token
+    inline const char * tagStart(const HtmlToken & token, const char * base)
+    {
+        return base + token.offset - (token.type == HtmlToken::EndTag ? 2 : 1);
+    }
+
+    /**
+     * Feeds the tags of a token array to a tree builder; other tokens are
+     * skipped. The counters do not use positions: the name's bounds stand
+     * in for the tag's.
+     *
+     * @param adapter   tree builder front end
+     * @param token     first token
+     * @param last      end of the tokens
+     * @param base      document the token offsets refer to
+     */
+    template <class Adapter>
+    void replayTags(Adapter & adapter, const HtmlToken * token, const HtmlToken * last, const char * base)
+    {
+        for (; token != last; ++token) {
+            const char * const name = base + token->offset;
+            const char * const nameEnd = name + token->length;
+            if (token->type == HtmlToken::StartTag) {
+                adapter.startTag(name, name, token->length, token->tag);
+                adapter.startTagClose((token->flags & HtmlToken::SelfClosing) != 0, nameEnd);
+            } else if (token->type == HtmlToken::EndTag) {
+                adapter.endTag(name, name, token->length, token->tag, nameEnd);
+            }
+        }
+    }
+
+    // Chunks of a document smaller than this are not worth a thread
+    const size_t kMinChunkBytes = 64 * 1024;
+
+    // One chunk of a document, tokenized on its own from a guessed state
+    struct Chunk {
+        const char * stop = nullptr;    // end of the chunk
+        const char * next = nullptr;    // where its tokenizer stopped, at or after stop
+        std::vector<HtmlToken> tags;
+    };
+}
+
+namespace html_detail {
+    bool equalsIgnoreCase(const char * a, size_t aLength, const char * b, size_t bLength)
+    {
+        if (aLength != bLength)
+            return false;
+        for (size_t i = 0; i < aLength; ++i)
+            if (toLower(a[i]) != toLower(b[i]))
+                return false;
+        return true;
+    }
+
+    const char * scanTagName(const char * p, const char * end)
+    {
+        while (p < end && !isSpace(*p) && *p != '/' && *p != '>')
+            ++p;
+        return p;
+    }
+
+    /**
+     * Skips the attributes of a tag up to its closing '>'. Only '>' and '='
+     * are looked for (with the SIMD scanner); after '=' a quoted value is
+     * jumped over whole, as it may contain '>', and an unquoted value is
+     * read up to the next space or '>'.
+     *
+     * @param p             first character after the tag name
+     * @param end           end of the buffer
+     * @param selfClosing   set if the tag ends with "/>"
+     * @return position of the closing '>', or end if there is none
+     */
+    const char * skipAttributes(const char * p, const char * end, bool & selfClosing)
+    {
+        const simd::ByteSet tagDelimiters('>', '=');
+        const char * const start = p;
+        selfClosing = false;
+        while ((p = simd::findAny(p, end, tagDelimiters)) != end) {
+            if (*p == '>') {
+                selfClosing = p > start && p[-1] == '/';
+                return p;
+            }
+            // '=': attribute value
+            ++p;
+            while (p < end && isSpace(*p))
+                ++p;
+            if (p == end)
+                break;
+            if (*p == '"' || *p == '\'') {
+                p = simd::find(p + 1, end, *p);
+                if (p == end)
+                    break;
+                ++p;
+            } else {
+                // Unquoted: a '/' right before '>' belongs to the value
+                while (p < end && !isSpace(*p) && *p != '>')
+                    ++p;
+                if (p < end && *p == '>')
+                    return p;
+            }
+        }
+        return end;
+    }
+
+    /**
+     * Finds the end tag of a raw-text element (script, style, textarea,
+     * title...), whose contents are not markup: "</" candidates are located
+     * with the pair kernel and must be followed by the element's name and a
+     * space, '/' or '>'.
+     *
+     * @param p         first character of the contents
+     * @param end       end of the buffer
+     * @param name      element name as written in its start tag
+     * @param length    length of the name
+     * @return position of the '<' of the end tag, or end if it is missing
+     */
+    const char * findRawTextEnd(const char * p, const char * end, const char * name, size_t length)
+    {
+        while ((p = simd::findPair(p, end, '<', '/')) != end) {
+            const char * candidate = p + 2;
+            if (static_cast<size_t>(end - candidate) >= length
+                && equalsIgnoreCase(candidate, length, name, length)
+                && (candidate + length == end || isSpace(candidate[length])
+                    || candidate[length] == '/' || candidate[length] == '>'))
+                return p;
+            ++p;
+        }
+        return end;
+    }
+
+    /**
+     * Finds the end of a comment. Comments end at "-->" (or "--!>"); the
+     * search jumps between "--" pairs with the pair kernel, so markup
+     * inside comments is never looked at.
+     *
+     * @param p     position in the comment, past "<!--" and the empty comment checks
+     * @param end   end of the buffer
+     * @return position after the comment, or nullptr if it does not end in the buffer
+     */
+    const char * findCommentEnd(const char * p, const char * end)
+    {
+        while ((p = simd::findPair(p, end, '-', '-')) != end) {
+            p += 2;
+            while (p < end && *p == '-')    // "--->" closes too
+                ++p;
+            if (p < end && *p == '>')
+                return p + 1;
+            if (startsWith(p, end, "!>", 2))
+                return p + 2;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Finds the end of a CDATA section, "]]>"
+     *
+     * @param p     position in the section, past "<![CDATA["
+     * @param end   end of the buffer
+     * @return position after the section, or nullptr if it does not end in the buffer
+     */
+    const char * findCDataEnd(const char * p, const char * end)
+    {
+        for (; (p = simd::findPair(p, end, ']', ']')) != end; ++p)
+            if (p + 2 < end && p[2] == '>')
+                return p + 3;
+        return nullptr;
+    }
+
+    /**
+     * Skips markup that does not produce elements, starting after its '<':
+     * comments, CDATA sections (to "]]>"), doctypes, processing
+     * instructions and other bogus comments (to the next '>'), and "</ >"
+     *
+     * @param p     character after '<': '!', '?' or '/'
+     * @param end   end of the buffer
+     * @return position after the skipped markup
+     */
+    const char * skipMarkupDeclaration(const char * p, const char * end)
+    {
+        if (startsWith(p, end, "!--", 3))
+            return skipComment(p + 3, end);
+        if (startsWith(p, end, "![CDATA[", 8)) {
+            const char * close = findCDataEnd(p + 8, end);
+            return close ? close : end;
+        }
+        return skipPast(p, end, '>');
+    }
+
+}
+
+/**
+ * Counts nodes, leaf nodes and div nodes of an html document in one pass
+ *
+ * @param html  raw html, not necessarily null-terminated
+ * @param size  number of bytes
+ * @return {# nodes, # leaf nodes, # div nodes}
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> countDomNodes(const char * html, size_t size)
+{
+    DomCounter counter;
+    visitHtml(boost::string_view(html, size), counter);
+    return std::make_tuple(counter.numNodes, counter.numLeafNodes, counter.numDivNodes);
+}
+
+/**
+ * Counts nodes, leaf nodes and div nodes by nesting alone, in memory
+ * proportional to the nesting depth
+ *
+ * @param html  raw html, not necessarily null-terminated
+ * @param size  number of bytes
+ * @return {# nodes, # leaf nodes, # div nodes}
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> countNestedDomNodes(const char * html, size_t size)
+{
+    NestingCounter counter;
+    html_detail::tokenize(html, size, counter);
+    return counter.finish();
+}
+
+/**
+ * Same counts as countDomNodes(html), from an existing token stream
+ *
+ * @param stream    tokenized document
+ * @return {# nodes, # leaf nodes, # div nodes}
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> countDomNodes(const HtmlTokenStream & stream)
+{
+    DomCounter counter;
+    html_detail::VisitorAdapter<DomCounter> adapter(counter);
+    const std::vector<HtmlToken> & tokens = stream.tokens();
+    replayTags(adapter, tokens.data(), tokens.data() + tokens.size(), stream.html().data());
+    adapter.finish(stream.html().data() + stream.html().size());
+    return std::make_tuple(counter.numNodes, counter.numLeafNodes, counter.numDivNodes);
+}
+
+/**
+ * Same counts as countDomNodes(html, size), with the tokenizing spread over
+ * threads, in two stages.
+ *
+ * Stage 1 cuts the document into equal chunks and tokenizes them in
+ * parallel, recording their tags. Every chunk but the first starts from
+ * the data state at its first byte: a guess, wrong when the cut falls
+ * inside a tag, a comment or a script.
+ *
+ * Stage 2 feeds the tags to the tree builder in document order. It knows
+ * where the tokenizer really resumes after the previous chunk and takes
+ * the chunk's tags from the first one starting exactly there, since two
+ * runs reaching the same '<' agree from then on. When the guess was wrong
+ * there is no such tag at first: the tokenizer is run again from the true
+ * position up to the next tag of the chunk, usually just past the
+ * construct the cut fell in, until the two meet or the chunk is used up.
+ * Stage 2 is sequential, but it only replays tags.
+ *
+ * @param html          raw html, not necessarily null-terminated
+ * @param size          number of bytes
+ * @param numThreads    threads for stage 1, and the number of chunks
+ * @return {# nodes, # leaf nodes, # div nodes}
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> countDomNodesParallel(const char * html, size_t size, unsigned numThreads)
+{
+    const size_t numChunks = std::min<size_t>(numThreads, size / kMinChunkBytes);
+    if (numChunks < 2 || size > std::numeric_limits<uint32_t>::max())
+        return countDomNodes(html, size);
+
+    const char * const end = html + size;
+    std::vector<Chunk> chunks(numChunks);
+    #pragma omp parallel for num_threads(numThreads) schedule(static, 1)
+    for (int i = 0; i < static_cast<int>(numChunks); ++i) {
+        Chunk & chunk = chunks[i];
+        const char * const begin = html + size / numChunks * i;
+        chunk.stop = i + 1 == static_cast<int>(numChunks) ? end : html + size / numChunks * (i + 1);
+        chunk.tags.reserve((chunk.stop - begin) / 64);
+        TagTokenBuilder builder(chunk.tags, html);
+        chunk.next = html_detail::tokenizeRange(begin, chunk.stop, end, builder);
+    }
+
+    DomCounter counter;
+    html_detail::VisitorAdapter<DomCounter> adapter(counter);
+    const char * resume = html;
+    for (const Chunk & chunk : chunks) {
+        const HtmlToken * token = chunk.tags.data();
+        const HtmlToken * const last = token + chunk.tags.size();
+        for (;;) {
+            token = std::lower_bound(token, last, resume, [html](const HtmlToken & t, const char * p) {
+                return tagStart(t, html) < p;
+            });
+            if (token != last && tagStart(*token, html) == resume) {
+                replayTags(adapter, token, last, html);
+                resume = chunk.next;
+                break;
+            }
+            if (token == last) {
+                resume = html_detail::tokenizeRange(resume, chunk.stop, end, adapter);
+                break;
+            }
+            resume = html_detail::tokenizeRange(resume, tagStart(*token, html), end, adapter);
+        }
+    }
+    adapter.finish(end);
+    return std::make_tuple(counter.numNodes, counter.numLeafNodes, counter.numDivNodes);
+}
+
+struct IncrementalDomCounter::State {
+    DomCounter counter;
+    html_detail::VisitorAdapter<DomCounter> adapter{counter, true};
+    HtmlPushTokenizer<html_detail::VisitorAdapter<DomCounter>> tokenizer{adapter};
+};
+
+IncrementalDomCounter::IncrementalDomCounter() : m_state(new State) {}
+
+IncrementalDomCounter::~IncrementalDomCounter() = default;
+
+void IncrementalDomCounter::feed(const char * data, size_t size)
+{
+    m_state->tokenizer.feed(data, size);
+}
+
+/**
+ * Ends the document
+ *
+ * @return {# nodes, # leaf nodes, # div nodes}, as countDomNodes on the whole document
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> IncrementalDomCounter::finish()
+{
+    m_state->tokenizer.finish();
+    m_state->adapter.finish(nullptr);
+    const DomCounter & counter = m_state->counter;
+    const auto counts = std::make_tuple(counter.numNodes, counter.numLeafNodes, counter.numDivNodes);
+    m_state.reset(new State);
+    return counts;
+}
+
+struct NestingDomCounter::State {
+    NestingCounter counter;
+    HtmlPushTokenizer<NestingCounter> tokenizer{counter};
+};
+
+NestingDomCounter::NestingDomCounter() : m_state(new State) {}
+
+NestingDomCounter::~NestingDomCounter() = default;
+
+void NestingDomCounter::feed(const char * data, size_t size)
+{
+    m_state->tokenizer.feed(data, size);
+}
+
+/**
+ * Ends the document
+ *
+ * @return {# nodes, # leaf nodes, # div nodes}, as countNestedDomNodes on the whole document
+ */
+std::tuple<uint64_t, uint64_t, uint64_t> NestingDomCounter::finish()
+{
+    m_state->tokenizer.finish();
+    const auto counts = m_state->counter.finish();
+    m_state.reset(new State);
+    return counts;
+}
+
+/**
+ * Tokenizes a document, replacing the previous tokens. The token array
+ * keeps its capacity, so a stream reused across documents stops
+ * allocating once it has seen the largest one.
+ *
+ * @param html  document; must outlive the tokens and be smaller than 4 GB
+ */
+void HtmlTokenStream::tokenize(boost::string_view html)
+{
+    if (html.size() > std::numeric_limits<uint32_t>::max())
+        throw std::length_error("html document too large for 32-bit token offsets");
+    m_html = html;
+    m_tokens.clear();
+    TokenBuilder builder(m_tokens, html.data());
+    html_detail::tokenize(html.data(), html.size(), builder);
+}
+
+/**
+ * Text of a token with character references decoded, for the tokens that
+ * have them: text runs outside raw-text elements and attribute values
+ *
+ * @param token     token of this stream
+ * @param scratch   buffer for decoded text, overwritten
+ * @return the text in the document when nothing needs decoding, else a
+ *         view of scratch
+ */
+boost::string_view HtmlTokenStream::decodedText(const HtmlToken & token, std::string & scratch) const
+{
+    if (token.type == HtmlToken::AttributeValue)
+        return decodeHtml(text(token), scratch, true);
+    if (token.type == HtmlToken::Text && !(token.flags & HtmlToken::RawText))
+        return decodeHtml(text(token), scratch);
+    return text(token);
+}
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <HtmlTags.hpp>
+#include <SimdScan.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+// Single-pass HTML tokenizer. Replaces the four regex passes of
+// getCleanDomTree: it walks the raw buffer once with a small state machine
+// and counts as it goes, without building any intermediate strings.
+//
+// Returns {# nodes, # leaf nodes, # div nodes} of the element tree a
+// browser builds (HtmlTreeBuilder.hpp), where
+//  - a node is an element: one per start tag, plus the elements the tree
+//    construction rules imply (html, head, body, tbody...); ignored start
+//    tags such as a second <body> are not counted
+//  - a leaf is an element without child elements
+//  - tag names are compared case-insensitively
+std::tuple<uint64_t, uint64_t, uint64_t> countDomNodes(const char * html, size_t size);
+
+inline std::tuple<uint64_t, uint64_t, uint64_t> countDomNodes(const std::string & html)
+{
+    return countDomNodes(html.data(), html.size());
+}
+
+// The same counts for one large document using several threads: chunks of
+// the document are tokenized in parallel, each from a guessed state, and
+// their tags are then replayed in order, re-tokenizing wherever a guess
+// was wrong. Falls back to countDomNodes for documents too small to split.
+std::tuple<uint64_t, uint64_t, uint64_t> countDomNodesParallel(const char * html, size_t size, unsigned numThreads);
+
+// Counts by nesting alone, for documents whose tree is too large to keep:
+// the only state is one "has element child" bit and one tag key per open
+// element, so memory grows with the nesting depth and not with the size of
+// the document, and no transformed copy of it is made. No tree construction
+// rules are applied, so the counts are those of the tags as written:
+//  - a node is a start tag; no elements are implied
+//  - void elements and "<x/>" are leaves
+//  - an end tag closes the innermost open element of its name and the
+//    elements opened after it; an end tag without one is ignored
+std::tuple<uint64_t, uint64_t, uint64_t> countNestedDomNodes(const char * html, size_t size);
+
+// One token of a document: a slice of the original buffer. 12 bytes; the
+// text of a token is stream.text(token).
+//  - StartTag / EndTag: the tag name, and its interned id in tag (flags:
+//    SelfClosing for "<x/>")
+//  - AttributeName: follows its StartTag, in document order
+//  - AttributeValue: follows its AttributeName if the attribute has '=';
+//    without the quotes, entities not decoded (stream.decodedText(token))
+//  - Text: a run of text between tags, whitespace included (flags: RawText
+//    for the contents of <script>, <style> and the other raw-text elements,
+//    in which entities are not decoded)
+struct HtmlToken {
+    enum Type : uint8_t { StartTag, EndTag, AttributeName, AttributeValue, Text };
+    enum Flags : uint8_t { SelfClosing = 1, RawText = 2 };
+
+    uint32_t offset;
+    uint32_t length;
+    Type type;
+    uint8_t flags;
+    Tag tag;    // Tag::Unknown except for tags
+};
+
+// The tokens of one document, in a contiguous array. Tokens hold 32-bit
+// offsets into the document, which the stream does not own: it must stay
+// alive and unchanged while the tokens are used.
+class HtmlTokenStream final {
+public:
+    typedef std::vector<HtmlToken>::const_iterator const_iterator;
+
+    HtmlTokenStream() = default;
+    explicit HtmlTokenStream(boost::string_view html) { tokenize(html); }
+
+    void tokenize(boost::string_view html);
+
+    boost::string_view text(const HtmlToken & token) const { return m_html.substr(token.offset, token.length); }
+    // Text with character references decoded (HtmlEntities.hpp), in scratch
+    // only if it has any
+    boost::string_view decodedText(const HtmlToken & token, std::string & scratch) const;
+    boost::string_view html() const { return m_html; }
+    const std::vector<HtmlToken> & tokens() const { return m_tokens; }
+    size_t size() const { return m_tokens.size(); }
+    const_iterator begin() const { return m_tokens.begin(); }
+    const_iterator end() const { return m_tokens.end(); }
+
+private:
+    boost::string_view m_html;
+    std::vector<HtmlToken> m_tokens;
+};
+
+std::tuple<uint64_t, uint64_t, uint64_t> countDomNodes(const HtmlTokenStream & stream);
+
+// The tokenizer itself, a template over the consumer of its events so that
+// every consumer gets its own specialized scan loop. A handler provides
+//   static const bool kWantsAttributes, kWantsText;
+//   void startTag(const char * lt, const char * name, size_t length, Tag tag);
+//   void attribute(const char * name, size_t nameLength, const char * value, size_t valueLength);
+//   void startTagClose(bool selfClosing, const char * tagEnd);
+//   void unterminatedTag();     // the start tag was cut off by the end of input
+//   void endTag(const char * lt, const char * name, size_t length, Tag tag, const char * tagEnd);
+//   void text(const char * p, size_t length);
+namespace html_detail {
+    inline bool isAlpha(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    inline bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    }
+
+    bool equalsIgnoreCase(const char * a, size_t aLength, const char * b, size_t bLength);
+    const char * scanTagName(const char * p, const char * end);
+    const char * skipAttributes(const char * p, const char * end, bool & selfClosing);
+    const char * findRawTextEnd(const char * p, const char * end, const char * name, size_t length);
+    const char * skipMarkupDeclaration(const char * p, const char * end);
+    const char * findCommentEnd(const char * p, const char * end);
+    const char * findCDataEnd(const char * p, const char * end);
+
+    /**
+     * Reads the attributes of a start tag up to its closing '>' and passes
+     * them to the handler. Names end at space, '/', '>' or '='; values may
+     * be quoted (and then contain anything but the quote) or unquoted.
+     *
+     * @param p             first character after the tag name
+     * @param end           end of the buffer
+     * @param handler       receives attribute(name, value)
+     * @param selfClosing   set if the tag ends with "/>"
+     * @return position of the closing '>', or end if there is none
+     */
+    template <class Handler>
+    const char * readAttributes(const char * p, const char * end, Handler & handler, bool & selfClosing)
+    {
+        selfClosing = false;
+        while (p < end) {
+            while (p < end && (isSpace(*p) || *p == '/')) {
+                selfClosing = (*p == '/');
+                ++p;
+            }
+            if (p == end || *p == '>')
+                return p;
+            selfClosing = false;
+
+            const char * name = p++;
+            while (p < end && !isSpace(*p) && *p != '/' && *p != '>' && *p != '=')
+                ++p;
+            const size_t nameLength = p - name;
+            const char * afterName = p;
+            while (p < end && isSpace(*p))
+                ++p;
+            if (p == end || *p != '=') {
+                handler.attribute(name, nameLength, nullptr, 0);
+                p = p < end && *p == '>' ? p : afterName;
+                continue;
+            }
+
+            ++p;
+            while (p < end && isSpace(*p))
+                ++p;
+            if (p == end)
+                break;
+            const char * value = p;
+            if (*p == '"' || *p == '\'') {
+                const char * close = simd::find(p + 1, end, *p);
+                if (close == end)
+                    break;
+                ++value;
+                p = close + 1;
+                handler.attribute(name, nameLength, value, close - value);
+            } else {
+                while (p < end && !isSpace(*p) && *p != '>')
+                    ++p;
+                handler.attribute(name, nameLength, value, p - value);
+            }
+        }
+        return end;
+    }
+
+    /**
+     * The tokenizer state machine, shared by all consumers through a
+     * handler. Handler::kWantsAttributes and kWantsText are compile-time
+     * constants: a handler that only needs tags gets the fast attribute
+     * skipping and no text bookkeeping. Positions passed to the handler
+     * point into the document: lt at a tag's '<', tagEnd just past its '>'.
+     *
+     * Tokenizes the part of a document from p up to the first markup
+     * starting at or after stop, and returns where to resume: the '<' of
+     * that markup, or end. Between markup the tokenizer is always in the
+     * data state, so what follows a '<' it resumes at depends only on that
+     * position; two runs that reach the same '<' produce the same tokens
+     * from there on.
+     *
+     * @param p         where to start, a position in the data state
+     * @param stop      markup starting at or after stop is left for later
+     * @param end       end of the document
+     * @param handler   receives the tokens
+     * @return position of the '<' to resume at, or end
+     */
+    template <class Handler>
+    const char * tokenizeRange(const char * p, const char * stop, const char * const end, Handler & handler)
+    {
+        const char * textStart = p;
+        auto flushText = [&](const char * textEnd) {
+            if (Handler::kWantsText && textEnd > textStart)
+                handler.text(textStart, textEnd - textStart);
+        };
+
+        while (p < end) {
+            // Data state: text up to the next '<'
+            const char * lt = simd::find(p, end, '<');
+            if (lt == end || lt + 1 == end)
+                break;
+            if (lt >= stop) {
+                flushText(lt);
+                return lt;
+            }
+            p = lt + 1;
+
+            const char c = *p;
+            if (isAlpha(c)) {
+                // Start tag
+                const char * name = p;
+                p = scanTagName(p, end);
+                const size_t length = p - name;
+                const Tag tag = lookupTag(name, length);
+                flushText(lt);
+                handler.startTag(lt, name, length, tag);
+                bool selfClosing = false;
+                p = Handler::kWantsAttributes ? readAttributes(p, end, handler, selfClosing)
+                                              : skipAttributes(p, end, selfClosing);
+                if (p == end) {
+                    handler.unterminatedTag();
+                    textStart = end;
+                    break;
+                }
+                if (hasTagProperty(tag, TagProperty::RawText | TagProperty::EscapableRawText)) {
+                    // The contents are one text run up to the end tag, which
+                    // is then read as usual. "<script/>" is not self-closing.
+                    handler.startTagClose(false, p + 1);
+                    textStart = ++p;
+                    p = findRawTextEnd(p, end, name, length);
+                    continue;
+                }
+                handler.startTagClose(selfClosing, p + 1);
+                textStart = ++p;
+            } else if (c == '/' && p + 1 < end && isAlpha(p[1])) {
+                // End tag; attributes on end tags are ignored
+                const char * name = p + 1;
+                p = scanTagName(name, end);
+                const size_t length = p - name;
+                bool selfClosing = false;
+                p = skipAttributes(p, end, selfClosing);
+                flushText(lt);
+                if (p == end) {
+                    textStart = end;
+                    break;
+                }
+                handler.endTag(lt, name, length, lookupTag(name, length), p + 1);
+                textStart = ++p;
+            } else if (c == '!' || c == '?' || c == '/') {
+                // Not elements: skipped without a token
+                flushText(lt);
+                p = skipMarkupDeclaration(p, end);
+                textStart = p;
+            }
+            // Anything else: a literal '<' in text
+        }
+        flushText(end);
+        return end;
+    }
+
+    /**
+     * Tokenizes a whole document
+     *
+     * @param html      raw html, not necessarily null-terminated
+     * @param size      number of bytes
+     * @param handler   receives the tokens
+     */
+    template <class Handler>
+    void tokenize(const char * html, size_t size, Handler & handler)
+    {
+        tokenizeRange(html, html + size, html + size, handler);
+    }
+}
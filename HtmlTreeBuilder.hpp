@@ -0,0 +1,782 @@
+#pragma once
+
+#include <HtmlTags.hpp>
+#include <HtmlTokenizer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Tree construction after the HTML5 algorithm, reduced to the rules that
+// decide the shape of the tree: implied end tags (<p>, <li>, <td>,
+// <option>...), scope checks that make stray end tags harmless, implied
+// html, head, body, tbody, tr and colgroup elements, and foreign (SVG and
+// MathML) content, where "<x/>" closes the element.
+//
+// Every rule is a bitmask test on the tag and a compare of two stack
+// indices. The stack keeps the index of the topmost open element of every
+// tag and of every class of tags (scope barriers, special elements,
+// headings...), so "is there a <p> in button scope" is
+// topmost(P) >= topmost(ButtonScopeBarrier). A token costs O(1) plus the
+// elements it closes, and each element is closed once, so deeply broken
+// markup stays linear.
+//
+// Not modelled: the adoption agency (a misnested formatting element is
+// closed like a block instead of being reopened), foster parenting
+// (content misplaced in a table stays where it is), the select and
+// template insertion modes, and integration points in foreign content.
+namespace tree_detail {
+    // Classes of tags whose topmost open element is tracked. The most
+    // common one comes first: loops over class bits stop at the highest.
+    enum TrackedClass {
+        SpecialElement,         // TagProperty::Special
+        ScopeBarrier,           // applet, caption, html, marquee, object, table, td, th, template
+        ListItemScopeBarrier,   // the above, ol and ul
+        ButtonScopeBarrier,     // the above and button
+        TableScopeBarrier,      // html, table, template
+        ListItemStop,           // special but address, div, p, li, dd and dt
+        HeadingElement,         // h1 to h6
+        ForeignRoot,            // svg, math
+        DescriptionItem,        // dd, dt
+        TableCell,              // td, th
+        TableSection,           // tbody, thead, tfoot
+        kNumTrackedClasses
+    };
+
+    // Class bits of a tag: one per tracked class, then these
+    enum : uint32_t {
+        kTrackedMask = (1u << kNumTrackedClasses) - 1,
+        ImpliedEnd = 1u << kNumTrackedClasses,  // closed by "generate implied end tags"
+        ClosesParagraph = ImpliedEnd << 1,      // start tag closes a <p> in button scope
+        HeadContent = ClosesParagraph << 1,     // start tag stays in <head>
+        ForeignBreakout = HeadContent << 1,     // start tag ends SVG or MathML content
+        StartTagRule = ForeignBreakout << 1,    // start tag may close or imply elements in the body
+    };
+
+    constexpr uint32_t bit(TrackedClass c)
+    {
+        return 1u << c;
+    }
+
+    constexpr bool isScopeBarrier(Tag tag)
+    {
+        switch (tag) {
+        case Tag::Applet: case Tag::Caption: case Tag::Html: case Tag::Marquee: case Tag::Object:
+        case Tag::Table: case Tag::Td: case Tag::Th: case Tag::Template:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr bool isImpliedEnd(Tag tag)
+    {
+        switch (tag) {
+        case Tag::Dd: case Tag::Dt: case Tag::Li: case Tag::Optgroup: case Tag::Option: case Tag::P:
+        case Tag::Rb: case Tag::Rp: case Tag::Rt: case Tag::Rtc:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr bool closesParagraph(Tag tag)
+    {
+        switch (tag) {
+        case Tag::Address: case Tag::Article: case Tag::Aside: case Tag::Blockquote: case Tag::Center:
+        case Tag::Details: case Tag::Dialog: case Tag::Dir: case Tag::Div: case Tag::Dl: case Tag::Fieldset:
+        case Tag::Figcaption: case Tag::Figure: case Tag::Footer: case Tag::Header: case Tag::Hgroup:
+        case Tag::Main: case Tag::Menu: case Tag::Nav: case Tag::Ol: case Tag::P: case Tag::Search:
+        case Tag::Section: case Tag::Summary: case Tag::Ul:
+        case Tag::H1: case Tag::H2: case Tag::H3: case Tag::H4: case Tag::H5: case Tag::H6:
+        case Tag::Pre: case Tag::Listing: case Tag::Form: case Tag::Li: case Tag::Dd: case Tag::Dt:
+        case Tag::Plaintext: case Tag::Table: case Tag::Hr: case Tag::Xmp:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr bool isHeadContent(Tag tag)
+    {
+        switch (tag) {
+        case Tag::Base: case Tag::Basefont: case Tag::Bgsound: case Tag::Link: case Tag::Meta:
+        case Tag::Noframes: case Tag::Noscript: case Tag::Script: case Tag::Style: case Tag::Template:
+        case Tag::Title:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr bool isForeignBreakout(Tag tag)
+    {
+        switch (tag) {
+        case Tag::B: case Tag::Big: case Tag::Blockquote: case Tag::Body: case Tag::Br: case Tag::Center:
+        case Tag::Code: case Tag::Dd: case Tag::Div: case Tag::Dl: case Tag::Dt: case Tag::Em: case Tag::Embed:
+        case Tag::H1: case Tag::H2: case Tag::H3: case Tag::H4: case Tag::H5: case Tag::H6:
+        case Tag::Head: case Tag::Hr: case Tag::I: case Tag::Img: case Tag::Li: case Tag::Listing:
+        case Tag::Menu: case Tag::Meta: case Tag::Nobr: case Tag::Ol: case Tag::P: case Tag::Pre:
+        case Tag::Ruby: case Tag::S: case Tag::Small: case Tag::Span: case Tag::Strong: case Tag::Strike:
+        case Tag::Sub: case Tag::Sup: case Tag::Table: case Tag::Tt: case Tag::U: case Tag::Ul: case Tag::Var:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Start tags with a rule of their own in prepareInsertion
+    constexpr bool hasStartTagRule(Tag tag)
+    {
+        switch (tag) {
+        case Tag::Html: case Tag::Head: case Tag::Body: case Tag::Frameset: case Tag::Button: case Tag::A:
+        case Tag::Nobr: case Tag::Option: case Tag::Optgroup: case Tag::Rb: case Tag::Rtc: case Tag::Rp:
+        case Tag::Rt: case Tag::Table: case Tag::Caption: case Tag::Colgroup: case Tag::Col: case Tag::Tr:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    constexpr uint32_t treeClassesOf(Tag tag)
+    {
+        uint32_t classes = 0;
+        if (isScopeBarrier(tag))
+            classes |= bit(ScopeBarrier) | bit(ListItemScopeBarrier) | bit(ButtonScopeBarrier);
+        if (tag == Tag::Ol || tag == Tag::Ul)
+            classes |= bit(ListItemScopeBarrier);
+        if (tag == Tag::Button)
+            classes |= bit(ButtonScopeBarrier);
+        if (tag == Tag::Html || tag == Tag::Table || tag == Tag::Template)
+            classes |= bit(TableScopeBarrier);
+        if (hasTagProperty(tag, TagProperty::Special)) {
+            classes |= bit(SpecialElement);
+            if (tag != Tag::Address && tag != Tag::Div && tag != Tag::P
+                && tag != Tag::Li && tag != Tag::Dd && tag != Tag::Dt)
+                classes |= bit(ListItemStop);
+        }
+        if (tag == Tag::H1 || tag == Tag::H2 || tag == Tag::H3 || tag == Tag::H4 || tag == Tag::H5 || tag == Tag::H6)
+            classes |= bit(HeadingElement);
+        if (hasTagProperty(tag, TagProperty::Foreign))
+            classes |= bit(ForeignRoot);
+        if (tag == Tag::Dd || tag == Tag::Dt)
+            classes |= bit(DescriptionItem);
+        if (tag == Tag::Td || tag == Tag::Th)
+            classes |= bit(TableCell);
+        if (tag == Tag::Tbody || tag == Tag::Thead || tag == Tag::Tfoot)
+            classes |= bit(TableSection);
+        if (isImpliedEnd(tag))
+            classes |= ImpliedEnd;
+        if (closesParagraph(tag))
+            classes |= ClosesParagraph;
+        if (isHeadContent(tag))
+            classes |= HeadContent;
+        if (isForeignBreakout(tag))
+            classes |= ForeignBreakout;
+        if (classes & (ClosesParagraph | bit(HeadingElement) | bit(DescriptionItem) | bit(TableCell) | bit(TableSection))
+            || hasStartTagRule(tag))
+            classes |= StartTagRule;
+        return classes;
+    }
+
+    struct TreeClassTable {
+        uint32_t classes[tags_detail::kNumTags];
+    };
+
+    constexpr TreeClassTable buildTreeClassTable()
+    {
+        TreeClassTable table{};
+        for (size_t tag = 0; tag < tags_detail::kNumTags; ++tag)
+            table.classes[tag] = treeClassesOf(static_cast<Tag>(tag));
+        return table;
+    }
+
+    constexpr TreeClassTable kTreeClassTable = buildTreeClassTable();
+
+    inline uint32_t treeClasses(Tag tag)
+    {
+        return kTreeClassTable.classes[static_cast<size_t>(tag)];
+    }
+
+    static_assert(treeClassesOf(Tag::Td) & bit(ScopeBarrier), "td is a scope barrier");
+    static_assert(!(treeClassesOf(Tag::Li) & bit(ListItemStop)), "li does not stop the search for li");
+}
+
+// Stack of open elements, with the index of the topmost open element of
+// every tag and tracked class; an index is -1 when there is none. Each
+// element links to the next open element of its tag below it, and the class
+// tops it replaced are saved on per-class stacks. Unknown tags are chained
+// per 64-bit hash of the lower-case name, whose topmost element is found in
+// a hash map, so an end tag for a name that is not open costs O(1). Names
+// point into the document, unless copyNames is set for input that does not
+// stay in memory (HtmlPushTokenizer.hpp): the names of unknown tags are then
+// kept on a stack of their own.
+class OpenElementStack final {
+public:
+    struct Element {
+        Tag tag;
+        uint32_t classes;
+        uint32_t payload;           // the sink's id of the element
+        uint32_t nameLength;
+        const char * name;          // as written; null if copied
+        uint32_t nameOffset;        // of a copied name in the name stack
+        int32_t previousSameName;   // restored when the element is popped
+        int32_t * top;              // where, in m_topOfTag or m_topOfUnknown
+    };
+
+    explicit OpenElementStack(bool copyNames = false) : m_copyNames(copyNames) { clear(); }
+    // Elements point into the stack's own tables
+    OpenElementStack(const OpenElementStack &) = delete;
+    OpenElementStack & operator=(const OpenElementStack &) = delete;
+
+    void clear()
+    {
+        m_elements.clear();
+        m_names.clear();
+        for (std::vector<int32_t> & saved : m_savedTops)
+            saved.clear();
+        for (int32_t & top : m_topOfClass)
+            top = -1;
+        for (int32_t & top : m_topOfTag)
+            top = -1;
+        m_topOfUnknown.clear();
+    }
+
+    int32_t size() const { return static_cast<int32_t>(m_elements.size()); }
+    bool empty() const { return m_elements.empty(); }
+    const Element & operator[](int32_t index) const { return m_elements[index]; }
+    const Element & current() const { return m_elements.back(); }
+
+    int32_t topmost(tree_detail::TrackedClass c) const { return m_topOfClass[c]; }
+    // For known tags only
+    int32_t topmost(Tag tag) const { return m_topOfTag[static_cast<size_t>(tag)]; }
+
+    int32_t topmostNamed(Tag tag, const char * name, size_t length) const
+    {
+        if (tag != Tag::Unknown)
+            return topmost(tag);
+        const auto it = m_topOfUnknown.find(hashOf(name, length));
+        int32_t index = it != m_topOfUnknown.end() ? it->second : -1;
+        // Chains hold one name unless two names share a hash
+        while (index >= 0 && !html_detail::equalsIgnoreCase(nameOf(m_elements[index]), m_elements[index].nameLength,
+                                                            name, length))
+            index = m_elements[index].previousSameName;
+        return index;
+    }
+
+    const char * nameOf(const Element & element) const
+    {
+        return element.name ? element.name : m_names.data() + element.nameOffset;
+    }
+
+    // The element at index is open and no element of the barrier class is
+    // above it
+    bool inScope(int32_t index, tree_detail::TrackedClass barrier) const
+    {
+        return index >= 0 && index >= m_topOfClass[barrier];
+    }
+
+    void push(Tag tag, const char * name, size_t length, uint32_t payload)
+    {
+        const int32_t index = size();
+        const uint32_t classes = tree_detail::treeClasses(tag);
+        uint32_t c = 0;
+        for (uint32_t mask = classes & tree_detail::kTrackedMask; mask != 0; mask >>= 1, ++c) {
+            if (mask & 1) {
+                m_savedTops[c].push_back(m_topOfClass[c]);
+                m_topOfClass[c] = index;
+            }
+        }
+        int32_t * top = tag != Tag::Unknown ? &m_topOfTag[static_cast<size_t>(tag)]
+                                            : &m_topOfUnknown.emplace(hashOf(name, length), -1).first->second;
+        const uint32_t nameOffset = static_cast<uint32_t>(m_names.size());
+        if (m_copyNames && tag == Tag::Unknown) {
+            m_names.append(name, length);
+            name = nullptr;
+        }
+        m_elements.push_back(Element{tag, classes, payload, static_cast<uint32_t>(length), name,
+                                     nameOffset, *top, top});
+        *top = index;
+    }
+
+    // Removes the current element; returns its payload
+    uint32_t pop()
+    {
+        const Element & element = m_elements.back();
+        uint32_t c = 0;
+        for (uint32_t mask = element.classes & tree_detail::kTrackedMask; mask != 0; mask >>= 1, ++c) {
+            if (mask & 1) {
+                m_topOfClass[c] = m_savedTops[c].back();
+                m_savedTops[c].pop_back();
+            }
+        }
+        *element.top = element.previousSameName;
+        if (!element.name)
+            m_names.resize(element.nameOffset);
+        const uint32_t payload = element.payload;
+        m_elements.pop_back();
+        return payload;
+    }
+
+private:
+    // FNV-1a of the lower-case name
+    static uint64_t hashOf(const char * name, size_t length)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < length; ++i) {
+            const char c = (name[i] >= 'A' && name[i] <= 'Z') ? static_cast<char>(name[i] + ('a' - 'A')) : name[i];
+            hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    const bool m_copyNames;
+    std::vector<Element> m_elements;
+    std::string m_names;                // copied names of open unknown elements
+    std::vector<int32_t> m_savedTops[tree_detail::kNumTrackedClasses];     // tops replaced by open elements
+    int32_t m_topOfClass[tree_detail::kNumTrackedClasses];
+    int32_t m_topOfTag[tags_detail::kNumTags];
+    std::unordered_map<uint64_t, int32_t> m_topOfUnknown;     // by hashOf the name
+};
+
+// Tokenizer handler that applies the tree construction rules and reports
+// the resulting elements to a sink:
+//   uint32_t openElement(Tag tag, const char * name, size_t length, uint32_t parent, const char * at);
+//   void closeElement(uint32_t element, const char * at);
+// openElement returns the sink's id of the element. Elements are opened in
+// document order and closed in reverse order of opening; implied elements
+// have the name of their tag. For openElement, at is the '<' of the tag
+// that opened or implied the element; for closeElement it is just past the
+// end tag that closed the element, or the '<' of the tag that implicitly
+// closed it.
+template <class Sink>
+class HtmlTreeBuilder final {
+public:
+    static const bool kWantsAttributes = false;
+    static const bool kWantsText = false;
+
+    // document: the sink's id of the document, parent of the root element
+    HtmlTreeBuilder(Sink & sink, OpenElementStack & open, uint32_t document)
+        : m_sink(sink), m_open(open), m_document(document)
+    {
+        m_open.clear();
+    }
+
+    void startTag(const char * lt, const char * name, size_t length, Tag tag)
+    {
+        m_tagStart = lt;
+        m_name = name;
+        m_nameLength = length;
+        m_tag = tag;
+    }
+
+    void attribute(const char *, size_t, const char *, size_t) {}
+    // A tag cut off by the end of the document is dropped
+    void unterminatedTag() {}
+    void text(const char *, size_t) {}
+
+    void startTagClose(bool selfClosing, const char * tagEnd);
+    void endTag(const char * lt, const char * name, size_t length, Tag tag, const char * tagEnd);
+    // Implies html, head and body if they are missing and closes everything
+    void finish(const char * end);
+
+private:
+    enum Seen : uint8_t { SeenHtml = 1, SeenHead = 2, SeenBody = 4 };
+
+    bool prepareInsertion(Tag tag, uint32_t classes, const char * at);
+    bool prepareTableInsertion(Tag tag, const char * at);
+
+    void insert(Tag tag, const char * name, size_t length, const char * at)
+    {
+        const uint32_t parent = m_open.empty() ? m_document : m_open.current().payload;
+        m_open.push(tag, name, length, m_sink.openElement(tag, name, length, parent, at));
+    }
+
+    void insertImplied(Tag tag, const char * at)
+    {
+        insert(tag, tagName(tag), tags_detail::nameLength(tagName(tag)), at);
+    }
+
+    void closeCurrent(const char * at)
+    {
+        m_sink.closeElement(m_open.pop(), at);
+    }
+
+    // Closes every element from index up
+    void popTo(int32_t index, const char * at)
+    {
+        while (m_open.size() > index)
+            closeCurrent(at);
+    }
+
+    // Closes the element at index, explicitly, and the elements above it
+    void closeThrough(int32_t index, const char * lt, const char * tagEnd)
+    {
+        popTo(index + 1, lt);
+        closeCurrent(tagEnd);
+    }
+
+    void generateImpliedEndTags(const char * at, Tag except)
+    {
+        while (!m_open.empty() && (m_open.current().classes & tree_detail::ImpliedEnd)
+               && m_open.current().tag != except)
+            closeCurrent(at);
+    }
+
+    void openHtml(const char * at)
+    {
+        if (!(m_seen & SeenHtml))
+            insertImplied(Tag::Html, at);
+        m_seen |= SeenHtml;
+    }
+
+    void openHead(const char * at)
+    {
+        openHtml(at);
+        if (!(m_seen & SeenHead))
+            insertImplied(Tag::Head, at);
+        m_seen |= SeenHead;
+    }
+
+    void closeHead(const char * at)
+    {
+        openHead(at);
+        const int32_t head = m_open.topmost(Tag::Head);
+        if (head >= 0)
+            popTo(head, at);
+    }
+
+    void openBody(const char * at)
+    {
+        if (m_seen & SeenBody)
+            return;
+        closeHead(at);
+        insertImplied(Tag::Body, at);
+        m_seen |= SeenBody;
+    }
+
+    Sink & m_sink;
+    OpenElementStack & m_open;
+    const uint32_t m_document;
+    uint8_t m_seen = 0;
+    const char * m_tagStart = nullptr;     // start tag being read
+    const char * m_name = nullptr;
+    size_t m_nameLength = 0;
+    Tag m_tag = Tag::Unknown;
+};
+
+/**
+ * Inserts the element of the start tag just read, after closing the
+ * elements it implicitly ends and opening those it implies
+ *
+ * @param selfClosing   the tag ends with "/>"; only honoured in foreign content
+ * @param tagEnd        just past the tag's '>'
+ */
+template <class Sink>
+void HtmlTreeBuilder<Sink>::startTagClose(bool selfClosing, const char * tagEnd)
+{
+    using namespace tree_detail;
+    const uint32_t classes = treeClasses(m_tag);
+    const int32_t foreignRoot = m_open.topmost(ForeignRoot);
+    if (foreignRoot >= 0) {
+        if (!(classes & ForeignBreakout)) {
+            insert(m_tag, m_name, m_nameLength, m_tagStart);
+            if (selfClosing)
+                closeCurrent(tagEnd);
+            return;
+        }
+        popTo(foreignRoot, m_tagStart);
+    }
+    // Most tags have no rule once in the body
+    if ((classes & StartTagRule || !(m_seen & SeenBody)) && !prepareInsertion(m_tag, classes, m_tagStart))
+        return;
+    insert(m_tag, m_name, m_nameLength, m_tagStart);
+    if (hasTagProperty(m_tag, TagProperty::Void) || (selfClosing && (classes & bit(ForeignRoot))))
+        closeCurrent(tagEnd);
+}
+
+/**
+ * Applies the rules of a start tag before its element is inserted
+ *
+ * @param tag       the start tag
+ * @param classes   its tree classes
+ * @param at        its '<'
+ * @return false if the tag is ignored
+ */
+template <class Sink>
+bool HtmlTreeBuilder<Sink>::prepareInsertion(Tag tag, uint32_t classes, const char * at)
+{
+    using namespace tree_detail;
+    switch (tag) {
+    case Tag::Html:
+        if (m_seen & SeenHtml)
+            return false;
+        m_seen |= SeenHtml;
+        return true;
+    case Tag::Head:
+        if (m_seen & SeenHead)
+            return false;
+        openHtml(at);
+        m_seen |= SeenHead;
+        return true;
+    case Tag::Body:
+    case Tag::Frameset:
+        if (m_seen & SeenBody)
+            return false;
+        closeHead(at);
+        m_seen |= SeenBody;
+        return true;
+    default:
+        break;
+    }
+    if (!(m_seen & SeenBody)) {
+        if (classes & HeadContent)
+            openHead(at);
+        else
+            openBody(at);
+    }
+
+    if (tag == Tag::Li) {
+        const int32_t item = m_open.topmost(Tag::Li);
+        if (m_open.inScope(item, ListItemStop) && item > m_open.topmost(DescriptionItem))
+            popTo(item, at);
+    } else if (classes & bit(DescriptionItem)) {
+        const int32_t item = m_open.topmost(DescriptionItem);
+        if (m_open.inScope(item, ListItemStop) && item > m_open.topmost(Tag::Li))
+            popTo(item, at);
+    }
+    if (classes & ClosesParagraph) {
+        const int32_t paragraph = m_open.topmost(Tag::P);
+        if (m_open.inScope(paragraph, ButtonScopeBarrier))
+            popTo(paragraph, at);
+    }
+    if ((classes & bit(HeadingElement)) && !m_open.empty() && (m_open.current().classes & bit(HeadingElement)))
+        closeCurrent(at);
+
+    switch (tag) {
+    case Tag::Button: {
+        const int32_t button = m_open.topmost(Tag::Button);
+        if (m_open.inScope(button, ScopeBarrier))
+            popTo(button, at);
+        break;
+    }
+    case Tag::A:
+    case Tag::Nobr: {
+        // An open link is closed by the next one, unless a block is in between
+        const int32_t element = m_open.topmost(tag);
+        if (m_open.inScope(element, SpecialElement))
+            popTo(element, at);
+        break;
+    }
+    case Tag::Option:
+    case Tag::Optgroup:
+        if (!m_open.empty() && m_open.current().tag == Tag::Option)
+            closeCurrent(at);
+        break;
+    case Tag::Rb:
+    case Tag::Rtc:
+        if (m_open.inScope(m_open.topmost(Tag::Ruby), ScopeBarrier))
+            generateImpliedEndTags(at, Tag::Unknown);
+        break;
+    case Tag::Rp:
+    case Tag::Rt:
+        if (m_open.inScope(m_open.topmost(Tag::Ruby), ScopeBarrier))
+            generateImpliedEndTags(at, Tag::Rtc);
+        break;
+    case Tag::Table: {
+        // A table directly in a table ends it
+        const int32_t table = m_open.topmost(TableScopeBarrier);
+        if (table >= 0 && m_open[table].tag == Tag::Table
+            && m_open.topmost(TableCell) < table && m_open.topmost(Tag::Caption) < table)
+            popTo(table, at);
+        break;
+    }
+    case Tag::Caption:
+    case Tag::Colgroup:
+    case Tag::Col:
+    case Tag::Tbody:
+    case Tag::Thead:
+    case Tag::Tfoot:
+    case Tag::Tr:
+    case Tag::Td:
+    case Tag::Th:
+        return prepareTableInsertion(tag, at);
+    default:
+        break;
+    }
+    return true;
+}
+
+/**
+ * Rules of the table insertion modes for table parts: a part closes the
+ * open parts of the same or a lower level and implies the missing levels
+ * above it (tbody and tr around a cell, colgroup around a col). Parts
+ * outside any table are ignored.
+ *
+ * @param tag   caption, colgroup, col, tbody, thead, tfoot, tr, td or th
+ * @param at    its '<'
+ * @return false if the tag is ignored
+ */
+template <class Sink>
+bool HtmlTreeBuilder<Sink>::prepareTableInsertion(Tag tag, const char * at)
+{
+    using namespace tree_detail;
+    const int32_t table = m_open.topmost(TableScopeBarrier);
+    if (table < 0 || m_open[table].tag == Tag::Html)
+        return false;
+    if (m_open[table].tag != Tag::Table)
+        return true;    // in a template
+
+    switch (tag) {
+    case Tag::Col: {
+        const int32_t group = m_open.topmost(Tag::Colgroup);
+        if (group > table) {
+            popTo(group + 1, at);
+        } else {
+            popTo(table + 1, at);
+            insertImplied(Tag::Colgroup, at);
+        }
+        return true;
+    }
+    case Tag::Caption:
+    case Tag::Colgroup:
+    case Tag::Tbody:
+    case Tag::Thead:
+    case Tag::Tfoot:
+        popTo(table + 1, at);
+        return true;
+    default:
+        break;
+    }
+
+    const int32_t row = m_open.topmost(Tag::Tr);
+    if (tag != Tag::Tr && row > table) {
+        popTo(row + 1, at);
+        return true;
+    }
+    const int32_t section = m_open.topmost(TableSection);
+    if (section > table) {
+        popTo(section + 1, at);
+    } else {
+        popTo(table + 1, at);
+        insertImplied(Tag::Tbody, at);
+    }
+    if (tag != Tag::Tr)
+        insertImplied(Tag::Tr, at);
+    return true;
+}
+
+/**
+ * Closes the element an end tag names, with the elements opened inside it,
+ * if it is in the scope the tag requires; otherwise the end tag is
+ * ignored. "</p>" without an open paragraph makes an empty one and "</br>"
+ * is read as "<br>", as browsers do.
+ *
+ * @param lt        the tag's '<'
+ * @param name      tag name
+ * @param length    length of the name
+ * @param tag       interned name
+ * @param tagEnd    just past the tag's '>'
+ */
+template <class Sink>
+void HtmlTreeBuilder<Sink>::endTag(const char * lt, const char * name, size_t length, Tag tag, const char * tagEnd)
+{
+    using namespace tree_detail;
+    // Well-formed markup: the end tag of the current element
+    if (!m_open.empty() && m_open.current().tag == tag && tag != Tag::Html && tag != Tag::Body
+        && (tag != Tag::Unknown || html_detail::equalsIgnoreCase(m_open.nameOf(m_open.current()),
+                                                                 m_open.current().nameLength, name, length))) {
+        closeCurrent(tagEnd);
+        return;
+    }
+    const int32_t foreignRoot = m_open.topmost(ForeignRoot);
+    if (foreignRoot >= 0) {
+        const int32_t element = m_open.topmostNamed(tag, name, length);
+        if (element >= foreignRoot) {
+            closeThrough(element, lt, tagEnd);
+            return;
+        }
+    }
+
+    const uint32_t classes = treeClasses(tag);
+    int32_t element = -1;
+    switch (tag) {
+    case Tag::Html:
+    case Tag::Body:
+        // The body stays open: content after it still goes in it
+        return;
+    case Tag::Br:
+        if (prepareInsertion(Tag::Br, classes, lt)) {
+            insertImplied(Tag::Br, lt);
+            closeCurrent(tagEnd);
+        }
+        return;
+    case Tag::P:
+        element = m_open.topmost(Tag::P);
+        if (!m_open.inScope(element, ButtonScopeBarrier)) {
+            if (prepareInsertion(Tag::P, classes, lt)) {
+                insertImplied(Tag::P, lt);
+                closeCurrent(tagEnd);
+            }
+            return;
+        }
+        break;
+    case Tag::Li:
+        element = m_open.topmost(Tag::Li);
+        if (!m_open.inScope(element, ListItemScopeBarrier))
+            return;
+        break;
+    case Tag::Head:
+        element = m_open.topmost(Tag::Head);
+        if (element < 0)
+            return;
+        break;
+    case Tag::Table:
+    case Tag::Caption:
+    case Tag::Colgroup:
+    case Tag::Tbody:
+    case Tag::Thead:
+    case Tag::Tfoot:
+    case Tag::Tr:
+    case Tag::Td:
+    case Tag::Th:
+        element = m_open.topmost(tag);
+        if (!m_open.inScope(element, TableScopeBarrier))
+            return;
+        break;
+    default:
+        if (classes & bit(HeadingElement)) {
+            // Any heading closes any heading
+            element = m_open.topmost(HeadingElement);
+            if (!m_open.inScope(element, ScopeBarrier))
+                return;
+        } else if (classes & (bit(SpecialElement) | ImpliedEnd)
+                   || hasTagProperty(tag, TagProperty::Formatting)) {
+            element = m_open.topmost(tag);
+            if (!m_open.inScope(element, ScopeBarrier))
+                return;
+        } else {
+            // Any other end tag closes the nearest element of its name,
+            // unless a special element is open inside it
+            element = m_open.topmostNamed(tag, name, length);
+            if (!m_open.inScope(element, SpecialElement))
+                return;
+        }
+        break;
+    }
+    closeThrough(element, lt, tagEnd);
+}
+
+/**
+ * Ends the document: html, head and body exist in every document
+ *
+ * @param end   end of the document
+ */
+template <class Sink>
+void HtmlTreeBuilder<Sink>::finish(const char * end)
+{
+    openBody(end);
+    popTo(0, end);
+}
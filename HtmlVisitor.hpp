@@ -0,0 +1,143 @@
+#pragma once
+
+#include <HtmlTags.hpp>
+#include <HtmlTokenizer.hpp>
+#include <HtmlTreeBuilder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/utility/string_view.hpp>
+
+// Compile-time visitor (SAX) interface to the tokenizer and the tree
+// builder. An analysis derives from HtmlVisitor and redeclares the
+// callbacks it needs; visitHtml is a template over the visitor type, so
+// each analysis gets its own scan loop with the callbacks inlined, and
+// the work behind callbacks it does not redeclare is compiled out: no
+// attribute parsing without onAttribute, no text runs without onText, no
+// tree construction without onElementOpen/onElementClose.
+//
+//   struct LinkCounter : HtmlVisitor {
+//       uint64_t links = 0;
+//       void onStartTag(Tag tag, boost::string_view) { links += tag == Tag::A; }
+//   };
+//   LinkCounter counter;
+//   visitHtml(html, counter);
+//
+// Strings passed to the callbacks point into the document.
+struct HtmlVisitor {
+    // Tokens, in document order. The attributes of a start tag come after
+    // it, then onStartTagEnd; a tag cut off by the end of the document gets
+    // no onStartTagEnd. Attribute values are empty for attributes without
+    // '='. Neither they nor text are entity-decoded: decodeHtml() does it
+    // for the strings a visitor wants (HtmlEntities.hpp); text of raw-text
+    // elements such as <script> must be left as it is.
+    void onStartTag(Tag, boost::string_view) {}
+    void onAttribute(boost::string_view, boost::string_view) {}
+    void onStartTagEnd(bool) {}
+    void onEndTag(Tag, boost::string_view) {}
+    void onText(boost::string_view) {}
+
+    // Elements of the tree a browser builds (HtmlTreeBuilder.hpp), implied
+    // ones included, in document order; elements close in reverse order of
+    // opening. The root element has depth 1.
+    void onElementOpen(Tag, boost::string_view, uint32_t) {}
+    void onElementClose(Tag, uint32_t) {}
+};
+
+namespace html_detail {
+    // Whether Visitor redeclares a callback of HtmlVisitor: if it does not,
+    // &Visitor::callback is a pointer to a member of HtmlVisitor
+#define HTML_VISITOR_REDECLARES(Visitor, callback) \
+    (!std::is_same<decltype(&Visitor::callback), decltype(&HtmlVisitor::callback)>::value)
+
+    // Tokenizer handler and tree sink that forwards to a visitor
+    template <class Visitor>
+    class VisitorAdapter final {
+    public:
+        static const bool kWantsAttributes = HTML_VISITOR_REDECLARES(Visitor, onAttribute);
+        static const bool kWantsText = HTML_VISITOR_REDECLARES(Visitor, onText);
+        static const bool kWantsTree = HTML_VISITOR_REDECLARES(Visitor, onElementOpen)
+                                       || HTML_VISITOR_REDECLARES(Visitor, onElementClose);
+
+        // copyNames: for input fed in pieces, see OpenElementStack
+        explicit VisitorAdapter(Visitor & visitor, bool copyNames = false)
+            : m_visitor(visitor), m_open(copyNames), m_tree(*this, m_open, 0) {}
+
+        void startTag(const char * lt, const char * name, size_t length, Tag tag)
+        {
+            m_visitor.onStartTag(tag, boost::string_view(name, length));
+            if (kWantsTree)
+                m_tree.startTag(lt, name, length, tag);
+        }
+
+        void attribute(const char * name, size_t nameLength, const char * value, size_t valueLength)
+        {
+            m_visitor.onAttribute(boost::string_view(name, nameLength),
+                                  value ? boost::string_view(value, valueLength) : boost::string_view());
+        }
+
+        void startTagClose(bool selfClosing, const char * tagEnd)
+        {
+            m_visitor.onStartTagEnd(selfClosing);
+            if (kWantsTree)
+                m_tree.startTagClose(selfClosing, tagEnd);
+        }
+
+        void unterminatedTag() {}
+
+        void endTag(const char * lt, const char * name, size_t length, Tag tag, const char * tagEnd)
+        {
+            m_visitor.onEndTag(tag, boost::string_view(name, length));
+            if (kWantsTree)
+                m_tree.endTag(lt, name, length, tag, tagEnd);
+        }
+
+        void text(const char * p, size_t length)
+        {
+            m_visitor.onText(boost::string_view(p, length));
+        }
+
+        void finish(const char * end)
+        {
+            if (kWantsTree)
+                m_tree.finish(end);
+        }
+
+        // Tree sink; the element id is its tag
+        uint32_t openElement(Tag tag, const char * name, size_t length, uint32_t, const char *)
+        {
+            m_visitor.onElementOpen(tag, boost::string_view(name, length), ++m_depth);
+            return static_cast<uint32_t>(tag);
+        }
+
+        void closeElement(uint32_t element, const char *)
+        {
+            m_visitor.onElementClose(static_cast<Tag>(element), m_depth--);
+        }
+
+    private:
+        Visitor & m_visitor;
+        OpenElementStack m_open;
+        HtmlTreeBuilder<VisitorAdapter> m_tree;
+        uint32_t m_depth = 0;
+    };
+
+#undef HTML_VISITOR_REDECLARES
+}
+
+/**
+ * Runs a visitor over a document in one pass
+ *
+ * @param html      raw html
+ * @param visitor   receives the tokens and elements it redeclares callbacks for
+ */
+template <class Visitor>
+void visitHtml(boost::string_view html, Visitor & visitor)
+{
+    static_assert(std::is_base_of<HtmlVisitor, Visitor>::value, "visitors derive from HtmlVisitor");
+    html_detail::VisitorAdapter<Visitor> adapter(visitor);
+    html_detail::tokenize(html.data(), html.size(), adapter);
+    adapter.finish(html.data() + html.size());
+}
@@ -0,0 +1,206 @@
+#include <LocalInput.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/filesystem.hpp>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace bfs = boost::filesystem;
+
+/**
+ * Whether a file is taken as input by its extension
+ *
+ * @param path          file name or path
+ * @param extensions    extensions to take, lower case, without the dot;
+ *                      empty for all
+ * @return true if the extension of path is one of them
+ */
+bool hasInputExtension(const std::string & path, const std::vector<std::string> & extensions)
+{
+    if (extensions.empty())
+        return true;
+    std::string extension = bfs::path(path).extension().string();
+    if (extension.empty())
+        return false;
+    extension = boost::algorithm::to_lower_copy(extension.substr(1));
+    return std::find(extensions.begin(), extensions.end(), extension) != extensions.end();
+}
+
+/**
+ * Maps a file read-only for sequential reading
+ *
+ * @param path      file to map
+ * @param error     receives the reason when mapping fails
+ * @return true if the file is mapped (its bytes are view())
+ */
+bool MappedFile::open(const std::string & path, std::string & error)
+{
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "cannot open (error " + std::to_string(GetLastError()) + ")";
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        error = "cannot get size (error " + std::to_string(GetLastError()) + ")";
+        CloseHandle(file);
+        return false;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return true;
+    }
+    // The view keeps the mapping, and the mapping the file, open
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        error = "cannot map (error " + std::to_string(GetLastError()) + ")";
+        return false;
+    }
+    const void * data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) {
+        error = "cannot map (error " + std::to_string(GetLastError()) + ")";
+        return false;
+    }
+    m_data = static_cast<const char *>(data);
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = std::string("cannot open: ") + std::strerror(errno);
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        error = std::string("cannot stat: ") + std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    if (status.st_size == 0) {
+        ::close(fd);
+        return true;
+    }
+    // The mapping holds its own reference to the file
+    void * data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        error = std::string("cannot map: ") + std::strerror(errno);
+        return false;
+    }
+    madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+    m_data = static_cast<const char *>(data);
+    m_size = static_cast<size_t>(status.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (m_data) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<char *>(m_data), m_size);
+#endif
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+
+/**
+ * Finds the input files under a directory. Each round lists the
+ * directories found by the previous one, in parallel; a file system that
+ * is slow to list (network mounts, cold caches) is then waited on by all
+ * threads at once rather than one directory after another. Unreadable
+ * directories are reported on std::cerr and skipped.
+ *
+ * @param directory     root of the tree
+ * @param extensions    file extensions to take, lower case; empty for all
+ * @param numThreads    threads listing directories
+ * @return the files found, sorted by path
+ */
+std::vector<InputFile> findInputFiles(const std::string & directory, const std::vector<std::string> & extensions,
+                                      unsigned numThreads)
+{
+    std::vector<InputFile> files;
+    std::vector<bfs::path> level(1, bfs::path(directory));
+    while (!level.empty()) {
+        std::vector<bfs::path> next;
+        #pragma omp parallel for num_threads(numThreads) schedule(dynamic)
+        for (int i = 0; i < static_cast<int>(level.size()); ++i) {
+            std::vector<InputFile> found;
+            std::vector<bfs::path> subdirectories;
+            boost::system::error_code error;
+            for (bfs::directory_iterator it(level[i], error), end; !error && it != end; it.increment(error)) {
+                // Symbolic links to directories are not followed, so the
+                // walk cannot loop; links to files are taken
+                boost::system::error_code entryError;
+                if (bfs::is_directory(it->symlink_status(entryError))) {
+                    subdirectories.emplace_back(it->path());
+                } else if (bfs::is_regular_file(it->status(entryError)) && hasInputExtension(it->path().string(), extensions)) {
+                    const uint64_t size = bfs::file_size(it->path(), entryError);
+                    if (!entryError)
+                        found.push_back(InputFile{it->path().string(), size});
+                }
+            }
+
+            #pragma omp critical
+            {
+                if (error)
+                    std::cerr << "Cannot list " << level[i].string() << ": " << error.message() << std::endl;
+                files.insert(files.end(), found.begin(), found.end());
+                next.insert(next.end(), subdirectories.begin(), subdirectories.end());
+            }
+        }
+        level.swap(next);
+    }
+
+    std::sort(files.begin(), files.end(), [](const InputFile & a, const InputFile & b) { return a.path < b.path; });
+    return files;
+}
+
+/**
+ * Looks up the sizes of the given input files, in parallel
+ *
+ * @param paths         files to analyze
+ * @param numThreads    threads querying the file system
+ * @return the regular files among paths, with their sizes
+ */
+std::vector<InputFile> statInputFiles(const std::vector<std::string> & paths, unsigned numThreads)
+{
+    std::vector<InputFile> files(paths.size());
+    std::vector<char> valid(paths.size());
+    #pragma omp parallel for num_threads(numThreads) schedule(dynamic)
+    for (int i = 0; i < static_cast<int>(paths.size()); ++i) {
+        boost::system::error_code error;
+        if (bfs::is_regular_file(paths[i], error)) {
+            files[i] = InputFile{paths[i], bfs::file_size(paths[i], error)};
+            valid[i] = !error;
+        }
+    }
+
+    std::vector<InputFile> found;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (valid[i])
+            found.push_back(files[i]);
+        else
+            std::cerr << "Not a file: " << paths[i] << std::endl;
+    }
+    return found;
+}
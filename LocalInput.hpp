@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+// Pages on disk (mirror dumps, build outputs) as input instead of URLs.
+// Files are mapped read-only and analyzed in place: no network stack and
+// no copy of the bytes, the analyzers read the page cache directly.
+
+// A file mapped read-only, advised for sequential access (MADV_SEQUENTIAL
+// on POSIX, FILE_FLAG_SEQUENTIAL_SCAN on Windows) so the kernel reads ahead
+// of the analyzer. Empty files map to an empty view.
+class MappedFile final {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    // Maps path, replacing the current mapping; false, with error set, if
+    // the file cannot be opened or mapped
+    bool open(const std::string & path, std::string & error);
+    void close();
+
+    boost::string_view view() const { return boost::string_view(m_data, m_size); }
+
+private:
+    const char * m_data = nullptr;
+    size_t m_size = 0;
+};
+
+struct InputFile {
+    std::string path;
+    uint64_t size;
+};
+
+// Whether path ends in one of extensions (lower case, without the dot),
+// ignoring case; true for any path if extensions is empty
+bool hasInputExtension(const std::string & path, const std::vector<std::string> & extensions);
+
+// Regular files under directory, at any depth, whose extension is one of
+// extensions (lower case, without the dot; empty for any), sorted by path.
+// The tree is walked one level at a time, each level's directories listed
+// by all threads.
+std::vector<InputFile> findInputFiles(const std::string & directory, const std::vector<std::string> & extensions,
+                                      unsigned numThreads);
+
+// The given files with their sizes, in the given order; files that do not
+// exist or are not regular files are reported on std::cerr and left out
+std::vector<InputFile> statInputFiles(const std::vector<std::string> & paths, unsigned numThreads);
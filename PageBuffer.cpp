@@ -0,0 +1,46 @@
+#include <PageBuffer.hpp>
+
+std::shared_ptr<PageBufferPool> PageBufferPool::create(size_t maxPooled)
+{
+    return std::shared_ptr<PageBufferPool>(new PageBufferPool(maxPooled));
+}
+
+/**
+ * Hands out a cleared buffer, reusing a returned one when available
+ *
+ * @return buffer that goes back to this pool when its last owner lets go
+ */
+std::shared_ptr<std::string> PageBufferPool::acquire()
+{
+    std::unique_ptr<std::string> buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_free.empty()) {
+            buffer = std::move(m_free.back());
+            m_free.pop_back();
+        }
+    }
+    if (!buffer)
+        buffer.reset(new std::string());
+
+    // The deleter holds a reference to the pool, keeping it alive for as
+    // long as any of its buffers are in use.
+    auto self = shared_from_this();
+    return std::shared_ptr<std::string>(buffer.release(),
+        [self](std::string * b) { self->release(b); });
+}
+
+size_t PageBufferPool::pooled() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_free.size();
+}
+
+void PageBufferPool::release(std::string * buffer)
+{
+    std::unique_ptr<std::string> owned(buffer);
+    owned->clear();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_free.size() < m_maxPooled)
+        m_free.push_back(std::move(owned));
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// A fetched page body. The fetch reads the socket straight into the string
+// and every later stage (analysis, reporting) shares it by reference count,
+// so the body is never copied after decryption.
+typedef std::shared_ptr<const std::string> PageBuffer;
+
+// Recycles page buffers. A buffer returns to the pool (keeping its capacity)
+// when the last PageBuffer referring to it is released, so steady-state
+// fetching does not allocate. The pool itself stays alive until every buffer
+// it handed out has been returned.
+class PageBufferPool final : public std::enable_shared_from_this<PageBufferPool> {
+public:
+    static std::shared_ptr<PageBufferPool> create(size_t maxPooled = 64);
+
+    // An empty, writable buffer; convert to PageBuffer once filled
+    std::shared_ptr<std::string> acquire();
+
+    size_t pooled() const;
+
+private:
+    explicit PageBufferPool(size_t maxPooled) : m_maxPooled(maxPooled) {}
+    void release(std::string * buffer);
+
+    const size_t m_maxPooled;
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<std::string>> m_free;
+};
@@ -0,0 +1,618 @@
+#include <SimdScan.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMD_SCAN_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// GCC and clang only emit AVX instructions in functions marked for them;
+// MSVC accepts the intrinsics anywhere.
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SIMD_TARGET(isa)
+#endif
+
+namespace {
+    typedef const char * (*FindAnyFn)(const char *, const char *, const simd::ByteSet &);
+    typedef const char * (*FindPairFn)(const char *, const char *, char, char);
+    typedef simd::Utf8Status (*ValidateUtf8Fn)(const char *, const char *);
+
+    struct Kernels {
+        FindAnyFn findAny;
+        FindPairFn findPair;
+        ValidateUtf8Fn validateUtf8;
+    };
+
+    inline bool inSet(char c, const simd::ByteSet & set)
+    {
+        return c == set.bytes[0] || c == set.bytes[1] || c == set.bytes[2] || c == set.bytes[3];
+    }
+
+    const char * findAnyScalar(const char * p, const char * end, const simd::ByteSet & set)
+    {
+        for (; p < end; ++p)
+            if (inSet(*p, set))
+                return p;
+        return end;
+    }
+
+    const char * findPairScalar(const char * p, const char * end, char first, char second)
+    {
+        for (; end - p >= 2; ++p)
+            if (p[0] == first && p[1] == second)
+                return p;
+        return end;
+    }
+
+    /**
+     * Checks one multi-byte UTF-8 sequence against the well-formed byte
+     * sequences of the Unicode standard (table 3-7)
+     *
+     * @param p     lead byte, not ASCII
+     * @param end   end of the buffer
+     * @return position after the sequence, or nullptr if it is ill-formed
+     */
+    const char * skipUtf8Sequence(const char * p, const char * end)
+    {
+        const unsigned char lead = static_cast<unsigned char>(*p);
+        size_t length;
+        unsigned char low = 0x80, high = 0xbf;     // range of the second byte
+        if (lead < 0xc2) {
+            return nullptr;
+        } else if (lead < 0xe0) {
+            length = 2;
+        } else if (lead < 0xf0) {
+            length = 3;
+            if (lead == 0xe0)
+                low = 0xa0;         // overlong
+            else if (lead == 0xed)
+                high = 0x9f;        // surrogates
+        } else if (lead < 0xf5) {
+            length = 4;
+            if (lead == 0xf0)
+                low = 0x90;         // overlong
+            else if (lead == 0xf4)
+                high = 0x8f;        // above U+10FFFF
+        } else {
+            return nullptr;
+        }
+        if (static_cast<size_t>(end - p) < length)
+            return nullptr;
+        const unsigned char second = static_cast<unsigned char>(p[1]);
+        if (second < low || second > high)
+            return nullptr;
+        for (size_t i = 2; i < length; ++i)
+            if ((static_cast<unsigned char>(p[i]) & 0xc0) != 0x80)
+                return nullptr;
+        return p + length;
+    }
+
+    simd::Utf8Status validateUtf8Scalar(const char * p, const char * end)
+    {
+        bool ascii = true;
+        while (p < end) {
+            if (static_cast<signed char>(*p) >= 0) {
+                ++p;
+                continue;
+            }
+            ascii = false;
+            if (!(p = skipUtf8Sequence(p, end)))
+                return simd::Utf8Status::Invalid;
+        }
+        return ascii ? simd::Utf8Status::Ascii : simd::Utf8Status::Utf8;
+    }
+
+#ifdef SIMD_SCAN_X86
+    inline unsigned lowestBit(uint32_t mask)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    inline unsigned lowestBit(uint64_t mask)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        const uint32_t low = static_cast<uint32_t>(mask);
+        return low ? lowestBit(low) : 32 + lowestBit(static_cast<uint32_t>(mask >> 32));
+#else
+        return __builtin_ctzll(mask);
+#endif
+    }
+
+    SIMD_TARGET("sse2")
+    inline uint32_t matchMaskSse2(const char * at, __m128i a, __m128i b, __m128i c, __m128i d)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(at));
+        const __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, a), _mm_cmpeq_epi8(v, b)),
+                                        _mm_or_si128(_mm_cmpeq_epi8(v, c), _mm_cmpeq_epi8(v, d)));
+        return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+    }
+
+    SIMD_TARGET("sse2")
+    const char * findAnySse2(const char * p, const char * end, const simd::ByteSet & set)
+    {
+        const __m128i a = _mm_set1_epi8(set.bytes[0]);
+        const __m128i b = _mm_set1_epi8(set.bytes[1]);
+        const __m128i c = _mm_set1_epi8(set.bytes[2]);
+        const __m128i d = _mm_set1_epi8(set.bytes[3]);
+        for (; end - p >= 32; p += 32) {
+            const uint32_t mask = matchMaskSse2(p, a, b, c, d) | matchMaskSse2(p + 16, a, b, c, d) << 16;
+            if (mask)
+                return p + lowestBit(mask);
+        }
+        if (end - p >= 16) {
+            if (const uint32_t mask = matchMaskSse2(p, a, b, c, d))
+                return p + lowestBit(mask);
+            p += 16;
+        }
+        return findAnyScalar(p, end, set);
+    }
+
+    // Pair kernels compare each block twice, at p and at p + 1, so a match
+    // is a byte equal to first whose successor equals second
+    SIMD_TARGET("sse2")
+    const char * findPairSse2(const char * p, const char * end, char first, char second)
+    {
+        const __m128i a = _mm_set1_epi8(first);
+        const __m128i b = _mm_set1_epi8(second);
+        for (; end - p > 16; p += 16) {
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 1));
+            const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(v0, a), _mm_cmpeq_epi8(v1, b));
+            if (const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(eq)))
+                return p + lowestBit(mask);
+        }
+        return findPairScalar(p, end, first, second);
+    }
+
+    SIMD_TARGET("avx2")
+    const char * findAnyAvx2(const char * p, const char * end, const simd::ByteSet & set)
+    {
+        const __m256i a = _mm256_set1_epi8(set.bytes[0]);
+        const __m256i b = _mm256_set1_epi8(set.bytes[1]);
+        const __m256i c = _mm256_set1_epi8(set.bytes[2]);
+        const __m256i d = _mm256_set1_epi8(set.bytes[3]);
+        for (; end - p >= 64; p += 64) {
+            const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32));
+            const __m256i eq0 = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v0, a), _mm256_cmpeq_epi8(v0, b)),
+                                                _mm256_or_si256(_mm256_cmpeq_epi8(v0, c), _mm256_cmpeq_epi8(v0, d)));
+            const __m256i eq1 = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v1, a), _mm256_cmpeq_epi8(v1, b)),
+                                                _mm256_or_si256(_mm256_cmpeq_epi8(v1, c), _mm256_cmpeq_epi8(v1, d)));
+            const uint64_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq0))
+                                | static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(eq1))) << 32;
+            if (mask)
+                return p + lowestBit(mask);
+        }
+        if (end - p >= 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            const __m256i eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, a), _mm256_cmpeq_epi8(v, b)),
+                                               _mm256_or_si256(_mm256_cmpeq_epi8(v, c), _mm256_cmpeq_epi8(v, d)));
+            if (const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq)))
+                return p + lowestBit(mask);
+            p += 32;
+        }
+        return findAnyScalar(p, end, set);
+    }
+
+    SIMD_TARGET("avx2")
+    const char * findPairAvx2(const char * p, const char * end, char first, char second)
+    {
+        const __m256i a = _mm256_set1_epi8(first);
+        const __m256i b = _mm256_set1_epi8(second);
+        for (; end - p > 32; p += 32) {
+            const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 1));
+            const __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(v0, a), _mm256_cmpeq_epi8(v1, b));
+            if (const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq)))
+                return p + lowestBit(mask);
+        }
+        return findPairScalar(p, end, first, second);
+    }
+
+    SIMD_TARGET("avx512f,avx512bw")
+    const char * findAnyAvx512(const char * p, const char * end, const simd::ByteSet & set)
+    {
+        const __m512i a = _mm512_set1_epi8(set.bytes[0]);
+        const __m512i b = _mm512_set1_epi8(set.bytes[1]);
+        const __m512i c = _mm512_set1_epi8(set.bytes[2]);
+        const __m512i d = _mm512_set1_epi8(set.bytes[3]);
+        for (; end - p >= 128; p += 128) {
+            const __m512i v0 = _mm512_loadu_si512(p);
+            const __m512i v1 = _mm512_loadu_si512(p + 64);
+            const uint64_t mask0 = _mm512_cmpeq_epi8_mask(v0, a) | _mm512_cmpeq_epi8_mask(v0, b)
+                                 | _mm512_cmpeq_epi8_mask(v0, c) | _mm512_cmpeq_epi8_mask(v0, d);
+            if (mask0)
+                return p + lowestBit(mask0);
+            const uint64_t mask1 = _mm512_cmpeq_epi8_mask(v1, a) | _mm512_cmpeq_epi8_mask(v1, b)
+                                 | _mm512_cmpeq_epi8_mask(v1, c) | _mm512_cmpeq_epi8_mask(v1, d);
+            if (mask1)
+                return p + 64 + lowestBit(mask1);
+        }
+        // Masked loads for the remaining < 128 bytes; masked-off bytes are
+        // not read and cannot fault
+        while (p < end) {
+            const size_t remaining = static_cast<size_t>(end - p);
+            const __mmask64 valid = remaining >= 64 ? ~0ULL : (1ULL << remaining) - 1;
+            const __m512i v = _mm512_maskz_loadu_epi8(valid, p);
+            const uint64_t mask = valid & (_mm512_cmpeq_epi8_mask(v, a) | _mm512_cmpeq_epi8_mask(v, b)
+                                         | _mm512_cmpeq_epi8_mask(v, c) | _mm512_cmpeq_epi8_mask(v, d));
+            if (mask)
+                return p + lowestBit(mask);
+            p += remaining >= 64 ? 64 : remaining;
+        }
+        return end;
+    }
+
+    SIMD_TARGET("avx512f,avx512bw")
+    const char * findPairAvx512(const char * p, const char * end, char first, char second)
+    {
+        const __m512i a = _mm512_set1_epi8(first);
+        const __m512i b = _mm512_set1_epi8(second);
+        for (; end - p > 64; p += 64) {
+            const __m512i v0 = _mm512_loadu_si512(p);
+            const __m512i v1 = _mm512_loadu_si512(p + 1);
+            if (const uint64_t mask = _mm512_cmpeq_epi8_mask(v0, a) & _mm512_cmpeq_epi8_mask(v1, b))
+                return p + lowestBit(mask);
+        }
+        return findPairScalar(p, end, first, second);
+    }
+
+    // ASCII blocks of 32 bytes are skipped with one movemask; other blocks
+    // are checked one sequence at a time, which may run a few bytes past
+    // the block
+    SIMD_TARGET("sse2")
+    simd::Utf8Status validateUtf8Sse2(const char * p, const char * end)
+    {
+        bool ascii = true;
+        while (end - p >= 32) {
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16));
+            if (_mm_movemask_epi8(_mm_or_si128(v0, v1)) == 0) {
+                p += 32;
+                continue;
+            }
+            ascii = false;
+            for (const char * const blockEnd = p + 32; p < blockEnd; ) {
+                if (static_cast<signed char>(*p) >= 0)
+                    ++p;
+                else if (!(p = skipUtf8Sequence(p, end)))
+                    return simd::Utf8Status::Invalid;
+            }
+        }
+        const simd::Utf8Status tail = validateUtf8Scalar(p, end);
+        return tail == simd::Utf8Status::Ascii && !ascii ? simd::Utf8Status::Utf8 : tail;
+    }
+
+    // Error classes of a pair of consecutive bytes, for the lookup
+    // validator. A pair is an error if the three lookups (high nibble of
+    // the first byte, low nibble of the first byte, high nibble of the
+    // second) share a bit; TwoContinuations is expected after a three- or
+    // four-byte lead and an error elsewhere.
+    enum Utf8Error : uint8_t {
+        TooShort = 1 << 0,          // lead byte not followed by a continuation
+        TooLong = 1 << 1,           // continuation after an ASCII byte
+        Overlong3 = 1 << 2,         // E0 80..9F
+        TooLarge = 1 << 3,          // F4 90..BF, F5..FF
+        Surrogate = 1 << 4,         // ED A0..BF
+        Overlong2 = 1 << 5,         // C0, C1
+        TooLarge1000 = 1 << 6,      // F5..FF 80..8F (and Overlong4: F0 80..8F)
+        Overlong4 = 1 << 6,
+        TwoContinuations = 1 << 7,
+        Carry = TooShort | TooLong | TwoContinuations
+    };
+
+    SIMD_TARGET("avx2")
+    inline __m256i lookup16(__m256i nibbles, __m256i table)
+    {
+        return _mm256_shuffle_epi8(table, nibbles);
+    }
+
+    SIMD_TARGET("avx2")
+    inline __m256i highNibbles(__m256i v)
+    {
+        return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+    }
+
+    // The block shifted right by n bytes, the gap filled from the previous one
+    template <int n>
+    SIMD_TARGET("avx2")
+    inline __m256i previousBytes(__m256i block, __m256i previous)
+    {
+        return _mm256_alignr_epi8(block, _mm256_permute2x128_si256(previous, block, 0x21), 16 - n);
+    }
+
+    SIMD_TARGET("avx2")
+    inline __m256i utf8Errors(__m256i block, __m256i previous)
+    {
+        const __m256i byte1HighTable = _mm256_setr_epi8(
+            TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+            TwoContinuations, TwoContinuations, TwoContinuations, TwoContinuations,
+            TooShort | Overlong2, TooShort, TooShort | Overlong3 | Surrogate,
+            TooShort | TooLarge | TooLarge1000 | Overlong4,
+            TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+            TwoContinuations, TwoContinuations, TwoContinuations, TwoContinuations,
+            TooShort | Overlong2, TooShort, TooShort | Overlong3 | Surrogate,
+            TooShort | TooLarge | TooLarge1000 | Overlong4);
+        const char large = Carry | TooLarge | TooLarge1000;
+        const __m256i byte1LowTable = _mm256_setr_epi8(
+            Carry | Overlong3 | Overlong2 | Overlong4, Carry | Overlong2, Carry, Carry,
+            Carry | TooLarge, large, large, large, large, large, large, large, large,
+            large | Surrogate, large, large,
+            Carry | Overlong3 | Overlong2 | Overlong4, Carry | Overlong2, Carry, Carry,
+            Carry | TooLarge, large, large, large, large, large, large, large, large,
+            large | Surrogate, large, large);
+        const char cont = TooLong | Overlong2 | TwoContinuations;
+        const __m256i byte2HighTable = _mm256_setr_epi8(
+            TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+            cont | Overlong3 | TooLarge1000 | Overlong4, cont | Overlong3 | TooLarge,
+            cont | Surrogate | TooLarge, cont | Surrogate | TooLarge,
+            TooShort, TooShort, TooShort, TooShort,
+            TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+            cont | Overlong3 | TooLarge1000 | Overlong4, cont | Overlong3 | TooLarge,
+            cont | Surrogate | TooLarge, cont | Surrogate | TooLarge,
+            TooShort, TooShort, TooShort, TooShort);
+
+        const __m256i previous1 = previousBytes<1>(block, previous);
+        const __m256i special = _mm256_and_si256(
+            _mm256_and_si256(lookup16(highNibbles(previous1), byte1HighTable),
+                             lookup16(_mm256_and_si256(previous1, _mm256_set1_epi8(0x0f)), byte1LowTable)),
+            lookup16(highNibbles(block), byte2HighTable));
+        // Bytes two after a three-byte lead or three after a four-byte lead
+        // must be continuations: their TwoContinuations bit is expected
+        const __m256i third = _mm256_subs_epu8(previousBytes<2>(block, previous), _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+        const __m256i fourth = _mm256_subs_epu8(previousBytes<3>(block, previous), _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        const __m256i expected = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+        return _mm256_xor_si256(expected, special);
+    }
+
+    // Non-zero if the block ends inside a multi-byte sequence
+    SIMD_TARGET("avx2")
+    inline __m256i incompleteAtEnd(__m256i block)
+    {
+        const __m256i maximum = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+        return _mm256_subs_epu8(block, maximum);
+    }
+
+    // State carried from one 32-byte block to the next
+    struct Utf8Checker {
+        __m256i error;
+        __m256i previous;           // last block that was not ASCII, or zeros
+        __m256i incomplete;         // non-zero if it ends inside a sequence
+        bool ascii;
+
+        SIMD_TARGET("avx2")
+        void check(__m256i block)
+        {
+            if (_mm256_movemask_epi8(block) == 0) {
+                // An ASCII block: only a sequence cut off before it can be wrong
+                error = _mm256_or_si256(error, incomplete);
+                previous = _mm256_setzero_si256();
+                incomplete = _mm256_setzero_si256();
+                return;
+            }
+            ascii = false;
+            error = _mm256_or_si256(error, utf8Errors(block, previous));
+            previous = block;
+            incomplete = incompleteAtEnd(block);
+        }
+    };
+
+    SIMD_TARGET("avx2")
+    simd::Utf8Status validateUtf8Avx2(const char * p, const char * end)
+    {
+        Utf8Checker checker = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), true};
+        for (unsigned block = 1; end - p >= 32; p += 32, ++block) {
+            checker.check(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)));
+            // Text in another encoding usually fails early: stop every 4 KB
+            if (block % 128 == 0 && !_mm256_testz_si256(checker.error, checker.error))
+                return simd::Utf8Status::Invalid;
+        }
+        // The tail, padded with ASCII zeros, which also ends any sequence
+        // still open
+        alignas(32) char tail[32] = {};
+        for (size_t i = 0; p + i < end; ++i)
+            tail[i] = p[i];
+        checker.check(_mm256_load_si256(reinterpret_cast<const __m256i *>(tail)));
+        if (!_mm256_testz_si256(checker.error, checker.error))
+            return simd::Utf8Status::Invalid;
+        return checker.ascii ? simd::Utf8Status::Ascii : simd::Utf8Status::Utf8;
+    }
+
+    void cpuid(uint32_t regs[4], uint32_t leaf, uint32_t subleaf)
+    {
+#if defined(_MSC_VER)
+        int out[4];
+        __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; ++i)
+            regs[i] = static_cast<uint32_t>(out[i]);
+#else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    // Register state the OS saves on context switches (XCR0)
+    uint64_t enabledXsaveFeatures()
+    {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return static_cast<uint64_t>(edx) << 32 | eax;
+#endif
+    }
+
+    simd::Isa detectIsa()
+    {
+        uint32_t regs[4];
+        cpuid(regs, 0, 0);
+        const uint32_t maxLeaf = regs[0];
+        cpuid(regs, 1, 0);
+        if (!(regs[3] & (1u << 26)))
+            return simd::Isa::Scalar;
+        const bool osxsave = (regs[2] & (1u << 27)) != 0;
+        const bool avx = (regs[2] & (1u << 28)) != 0;
+        if (!osxsave || !avx || maxLeaf < 7)
+            return simd::Isa::Sse2;
+
+        const uint64_t xcr0 = enabledXsaveFeatures();
+        const uint64_t ymmState = 0x6;      // SSE and AVX registers
+        const uint64_t zmmState = 0xe0;     // opmask and upper ZMM registers
+        if ((xcr0 & ymmState) != ymmState)
+            return simd::Isa::Sse2;
+        cpuid(regs, 7, 0);
+        const bool avx2 = (regs[1] & (1u << 5)) != 0;
+        const bool avx512f = (regs[1] & (1u << 16)) != 0;
+        const bool avx512bw = (regs[1] & (1u << 30)) != 0;
+        if (avx512f && avx512bw && (xcr0 & zmmState) == zmmState)
+            return simd::Isa::Avx512bw;
+        return avx2 ? simd::Isa::Avx2 : simd::Isa::Sse2;
+    }
+#else
+    simd::Isa detectIsa()
+    {
+        return simd::Isa::Scalar;
+    }
+#endif
+
+    const Kernels kScalarKernels = {&findAnyScalar, &findPairScalar, &validateUtf8Scalar};
+#ifdef SIMD_SCAN_X86
+    const Kernels kSse2Kernels = {&findAnySse2, &findPairSse2, &validateUtf8Sse2};
+    const Kernels kAvx2Kernels = {&findAnyAvx2, &findPairAvx2, &validateUtf8Avx2};
+    // The lookup validator is bound by shuffles, of which AVX-512BW has no
+    // wider form worth the frequency cost: the AVX2 kernel is used
+    const Kernels kAvx512Kernels = {&findAnyAvx512, &findPairAvx512, &validateUtf8Avx2};
+#endif
+
+    const Kernels * kernelsFor(simd::Isa isa)
+    {
+        switch (isa) {
+#ifdef SIMD_SCAN_X86
+        case simd::Isa::Avx512bw: return &kAvx512Kernels;
+        case simd::Isa::Avx2: return &kAvx2Kernels;
+        case simd::Isa::Sse2: return &kSse2Kernels;
+#endif
+        default: return &kScalarKernels;
+        }
+    }
+
+    const Kernels * resolveKernels();
+
+    const char * resolveAndFindAny(const char * p, const char * end, const simd::ByteSet & set)
+    {
+        return resolveKernels()->findAny(p, end, set);
+    }
+
+    const char * resolveAndFindPair(const char * p, const char * end, char first, char second)
+    {
+        return resolveKernels()->findPair(p, end, first, second);
+    }
+
+    simd::Utf8Status resolveAndValidateUtf8(const char * p, const char * end)
+    {
+        return resolveKernels()->validateUtf8(p, end);
+    }
+
+    // Starts out pointing at resolvers, which install the best kernels on
+    // the first call. Static initialization order does not matter.
+    const Kernels kResolvers = {&resolveAndFindAny, &resolveAndFindPair, &resolveAndValidateUtf8};
+    std::atomic<const Kernels *> gKernels(&kResolvers);
+    std::atomic<int> gActiveIsa(-1);
+
+    const Kernels * resolveKernels()
+    {
+        if (gActiveIsa.load() < 0)
+            simd::setIsa(simd::bestIsa());
+        return gKernels.load(std::memory_order_relaxed);
+    }
+}
+
+namespace simd {
+    /**
+     * Finds the first occurrence of any byte of a set with the selected
+     * vector kernel
+     *
+     * @param p     start of the range
+     * @param end   end of the range
+     * @param set   bytes to look for
+     * @return position of the first match, or end
+     */
+    const char * findAnyKernel(const char * p, const char * end, const ByteSet & set)
+    {
+        return gKernels.load(std::memory_order_relaxed)->findAny(p, end, set);
+    }
+
+    /**
+     * Finds the first occurrence of a two-byte sequence
+     *
+     * @param p         start of the range
+     * @param end       end of the range
+     * @param first     first byte of the sequence
+     * @param second    second byte of the sequence
+     * @return position of the first byte of the first match, or end
+     */
+    const char * findPair(const char * p, const char * end, char first, char second)
+    {
+        return gKernels.load(std::memory_order_relaxed)->findPair(p, end, first, second);
+    }
+
+    /**
+     * Validates UTF-8 with the selected kernel
+     *
+     * @param p     start of the text
+     * @param end   end of the text
+     * @return Ascii, Utf8 (well-formed, not all ASCII) or Invalid
+     */
+    Utf8Status validateUtf8(const char * p, const char * end)
+    {
+        return gKernels.load(std::memory_order_relaxed)->validateUtf8(p, end);
+    }
+
+    Isa bestIsa()
+    {
+        static const Isa best = detectIsa();
+        return best;
+    }
+
+    Isa activeIsa()
+    {
+        const int active = gActiveIsa.load();
+        return active < 0 ? bestIsa() : static_cast<Isa>(active);
+    }
+
+    void setIsa(Isa isa)
+    {
+        if (static_cast<int>(isa) > static_cast<int>(bestIsa()))
+            isa = bestIsa();
+        gKernels.store(kernelsFor(isa));
+        gActiveIsa.store(static_cast<int>(isa));
+    }
+
+    const char * isaName(Isa isa)
+    {
+        switch (isa) {
+        case Isa::Avx512bw: return "avx512bw";
+        case Isa::Avx2: return "avx2";
+        case Isa::Sse2: return "sse2";
+        default: return "scalar";
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+
+// Vectorized scanning for html structural characters ('<', '>', quotes,
+// '&', ...) and two-byte sequences ("</"). Kernels for SSE2 (16 bytes per compare), AVX2 (32) and
+// AVX-512BW (64), each unrolled to 32-128 bytes per iteration, plus a
+// scalar fallback. The best kernel the CPU and OS support is picked with
+// CPUID on first use; non-x86 builds only have the scalar kernel.
+namespace simd {
+    enum class Isa { Scalar, Sse2, Avx2, Avx512bw };
+
+    // Up to four byte values searched for at once
+    struct ByteSet {
+        char bytes[4];
+
+        explicit ByteSet(char a) : ByteSet(a, a, a, a) {}
+        ByteSet(char a, char b) : ByteSet(a, b, b, b) {}
+        ByteSet(char a, char b, char c) : ByteSet(a, b, c, c) {}
+        ByteSet(char a, char b, char c, char d) : bytes{a, b, c, d} {}
+    };
+
+    // Vector kernel behind findAny
+    const char * findAnyKernel(const char * p, const char * end, const ByteSet & set);
+
+    // First byte in [p, end) that is in the set, or end. In markup the next
+    // delimiter is often only a few bytes away, so the first bytes are
+    // checked inline before calling the kernel.
+    inline const char * findAny(const char * p, const char * end, const ByteSet & set)
+    {
+        const int kInlineBytes = 8;
+        const char * const stop = end - p > kInlineBytes ? p + kInlineBytes : end;
+        for (; p < stop; ++p)
+            if (*p == set.bytes[0] || *p == set.bytes[1] || *p == set.bytes[2] || *p == set.bytes[3])
+                return p;
+        return p == end ? end : findAnyKernel(p, end, set);
+    }
+
+    inline const char * find(const char * p, const char * end, char c)
+    {
+        return findAny(p, end, ByteSet(c));
+    }
+
+    // First position of the byte sequence (first, second) in [p, end), or
+    // end. Used to find "</" closers in script and style contents.
+    const char * findPair(const char * p, const char * end, char first, char second);
+
+    enum class Utf8Status { Ascii, Utf8, Invalid };
+
+    // Whether [p, end) is well-formed UTF-8 (no overlong forms, surrogates
+    // or code points above U+10FFFF, no truncated sequence at the end), and
+    // whether it is plain ASCII. ASCII blocks are skipped with one compare;
+    // the AVX2 kernel checks other blocks with table lookups (Keiser and
+    // Lemire), so validation runs at a few GB/s on any text.
+    Utf8Status validateUtf8(const char * p, const char * end);
+
+    // Highest instruction set supported by both the CPU and the OS
+    Isa bestIsa();
+    Isa activeIsa();
+    // Selects a kernel, capped at bestIsa(); for benchmarks and testing
+    void setIsa(Isa isa);
+    const char * isaName(Isa isa);
+}
@@ -1,6 +1,13 @@
+#include <ArchiveInput.hpp>
 #include <GetUrlContent.hpp>
+#include <HtmlAnalyzer.hpp>
+#include <FetchScheduler.hpp>
 #include <HtmlParser.hpp>
+#include <HtmlCharset.hpp>
+#include <HtmlTokenizer.hpp>
+#include <LocalInput.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -10,6 +17,16 @@
 #include <boost/lexical_cast.hpp>
 #include <omp.h>
 #include <tuple>
+#include <map>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <cstdlib>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
 
 namespace bfs = boost::filesystem;
 
@@ -21,23 +38,443 @@ enum StatusCode {
     FATAL_ERROR
 };
 
+// Default size of the fetch worker pool. Workers mostly wait on the network,
+// so this is independent of the number of analysis threads; how many of them
+// hit the same host at once is decided by the per-host AIMD controller.
+const unsigned kDefaultFetchWorkers = 16;
+
+// Pages at least this large are not given to a single thread: with one page
+// per thread, a multi-MB page would keep one core busy while the others sit
+// idle at the end of the run. They are split into chunks instead, which all
+// threads tokenize in parallel (countDomNodesParallel).
+const unsigned kDefaultSplitPageKb = 1024;
+
+// Files taken from --input-dir unless --input-ext says otherwise
+const char * const kDefaultInputExtensions = "html,htm,xhtml,shtml";
+
+/**
+ * Splits command line arguments into positional arguments and
+ * "--name=value" (or bare "--name") options
+ */
+void parseArgs(int argc, char * argv[],
+               std::vector<std::string> & positional,
+               std::map<std::string, std::string> & options)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+        if (arg.compare(0, 2, "--") == 0) {
+            auto eq = arg.find('=');
+            if (eq == std::string::npos)
+                options[arg.substr(2)] = "";
+            else
+                options[arg.substr(2, eq - 2)] = arg.substr(eq + 1);
+        } else {
+            positional.emplace_back(arg);
+        }
+    }
+}
+
+/**
+ * Reads an unsigned option, falling back to a default when absent or invalid
+ */
+unsigned getUnsignedOption(const std::map<std::string, std::string> & options,
+                           const std::string & name, unsigned defaultValue)
+{
+    auto it = options.find(name);
+    if (it == options.end())
+        return defaultValue;
+    try {
+        return boost::lexical_cast<unsigned>(it->second);
+    }
+    catch (const boost::bad_lexical_cast &) {
+        std::cerr << "Ignoring invalid value for --" << name << ": " << it->second << '\n';
+        return defaultValue;
+    }
+}
+
+/**
+ * Forward proxy from --proxy, falling back to the HTTPS_PROXY environment
+ * variable. A scheme prefix and trailing slash (http://proxy:3128/) are
+ * stripped.
+ */
+std::string proxyFromOptions(const std::map<std::string, std::string> & options)
+{
+    std::string proxy;
+    auto it = options.find("proxy");
+    if (it != options.end()) {
+        proxy = it->second;
+    } else {
+        const char * env = std::getenv("HTTPS_PROXY");
+        if (!env)
+            env = std::getenv("https_proxy");
+        if (env)
+            proxy = env;
+    }
+    auto scheme = proxy.find("://");
+    if (scheme != std::string::npos)
+        proxy = proxy.substr(scheme + 3);
+    if (!proxy.empty() && proxy.back() == '/')
+        proxy.pop_back();
+    return proxy;
+}
+
+/**
+ * Hosts to reach without the proxy: the NO_PROXY environment variable,
+ * which goes with a proxy taken from the environment. An explicit --proxy
+ * is used for every host.
+ */
+std::string noProxyFromOptions(const std::map<std::string, std::string> & options)
+{
+    if (options.count("proxy"))
+        return std::string();
+    const char * env = std::getenv("NO_PROXY");
+    if (!env)
+        env = std::getenv("no_proxy");
+    return env ? env : std::string();
+}
+
+/**
+ * User plus system CPU time consumed by this process so far, in seconds
+ */
+double processCpuSeconds()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    auto toSeconds = [](const FILETIME & ft) {
+        ULARGE_INTEGER t;
+        t.LowPart = ft.dwLowDateTime;
+        t.HighPart = ft.dwHighDateTime;
+        return t.QuadPart * 1e-7;  // 100ns ticks
+    };
+    return toSeconds(kernel) + toSeconds(user);
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6
+         + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+#endif
+}
+
+/**
+ * Splits a comma-separated list ("regex,spirit")
+ */
+std::vector<std::string> splitList(const std::string & list)
+{
+    std::vector<std::string> items;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        if (!item.empty())
+            items.emplace_back(item);
+    return items;
+}
+
+// The pages to analyze. Each analysis thread reads them through its own
+// reader, which returns a page as UTF-8, valid until its next read.
+class PageSource {
+public:
+    class Reader {
+    public:
+        virtual ~Reader() {}
+        virtual boost::string_view read(size_t i) = 0;
+    };
+
+    virtual ~PageSource() {}
+    virtual size_t size() const = 0;
+    // Bytes of page i as fetched or stored, known before it is read
+    virtual uint64_t pageBytes(size_t i) const = 0;
+    virtual std::unique_ptr<Reader> reader() = 0;
+};
+
+// Pages in memory (fetched, or out of an archive), decoded once up front:
+// each page is made UTF-8 (a validation pass, plus a transcoded copy for
+// pages in legacy charsets, kept here) by its thread's PageDecoder, so
+// every backend is given the same pages.
+class BufferedPages final : public PageSource {
+public:
+    BufferedPages(std::vector<PageBuffer> htmls, const std::vector<std::string> & contentTypes,
+                 std::vector<PageCharset> & charsets)
+        : m_htmls(std::move(htmls)), m_pages(m_htmls.size()), m_transcodedCopies(m_htmls.size())
+    {
+        #pragma omp parallel
+        {
+            PageDecoder decoder;
+            #pragma omp for
+            for (int i = 0; i < static_cast<int>(m_htmls.size()); ++i) {
+                m_pages[i] = decoder.decode(*m_htmls[i], contentTypes[i]);
+                charsets[i] = decoder.charset();
+                if (charsets[i].transcoded) {
+                    m_transcodedCopies[i] = decoder.takeTranscoded();
+                    m_pages[i] = m_transcodedCopies[i];
+                }
+            }
+        }
+    }
+
+    size_t size() const override { return m_pages.size(); }
+    uint64_t pageBytes(size_t i) const override { return m_pages[i].size(); }
+
+    std::unique_ptr<Reader> reader() override
+    {
+        return std::unique_ptr<Reader>(new PageReader(m_pages));
+    }
+
+private:
+    class PageReader final : public Reader {
+    public:
+        explicit PageReader(const std::vector<boost::string_view> & pages) : m_pages(pages) {}
+        boost::string_view read(size_t i) override { return m_pages[i]; }
+
+    private:
+        const std::vector<boost::string_view> & m_pages;
+    };
+
+    std::vector<PageBuffer> m_htmls;
+    std::vector<boost::string_view> m_pages;
+    std::vector<std::string> m_transcodedCopies;
+};
+
+// Files on disk, mapped when a thread reads them and unmapped at its next
+// read, so only one file per thread is mapped at a time whatever the size
+// of the tree. Pages that need no transcoding are analyzed in the mapping.
+class MappedPages final : public PageSource {
+public:
+    MappedPages(std::vector<InputFile> files, std::vector<PageCharset> & charsets)
+        : m_files(std::move(files)), m_charsets(charsets), m_reported(m_files.size())
+    {
+    }
+
+    size_t size() const override { return m_files.size(); }
+    uint64_t pageBytes(size_t i) const override { return m_files[i].size; }
+
+    std::unique_ptr<Reader> reader() override
+    {
+        return std::unique_ptr<Reader>(new FileReader(*this));
+    }
+
+private:
+    class FileReader final : public Reader {
+    public:
+        explicit FileReader(MappedPages & source) : m_source(source) {}
+
+        // An unreadable file is an empty page, reported once
+        boost::string_view read(size_t i) override
+        {
+            std::string error;
+            if (!m_file.open(m_source.m_files[i].path, error)) {
+                if (!m_source.m_reported[i]) {
+                    m_source.m_reported[i] = 1;
+                    #pragma omp critical
+                    {
+                        std::cerr << "Cannot read " << m_source.m_files[i].path << ": " << error << std::endl;
+                    }
+                }
+                return boost::string_view();
+            }
+            const boost::string_view page = m_decoder.decode(m_file.view(), boost::string_view());
+            m_source.m_charsets[i] = m_decoder.charset();
+            return page;
+        }
+
+    private:
+        MappedPages & m_source;
+        MappedFile m_file;
+        PageDecoder m_decoder;
+    };
+
+    const std::vector<InputFile> m_files;
+    std::vector<PageCharset> & m_charsets;
+    std::vector<char> m_reported;
+};
+
+/**
+ * Counts every page with one analyzer backend. The pages are shared out
+ * among the threads, each with its own analyzer; pages of at least
+ * splitPageBytes are left out and then counted one at a time, each by all
+ * threads (countDomNodesParallel, which is the tokenizer).
+ *
+ * @param parser            name of the analyzer backend
+ * @param source            the pages
+ * @param numThreads        analysis threads
+ * @param splitPageBytes    size from which pages are split, 0 for none
+ * @param urlStatMap        receives the counts of each page, by page index
+ * @param firstIndex        index of the source's first page
+ * @return wall-clock seconds taken
+ */
+double analyzePages(const std::string & parser, PageSource & source,
+                    unsigned numThreads, size_t splitPageBytes, std::map<int, PageCounts> & urlStatMap,
+                    int firstIndex = 0)
+{
+    auto isSplit = [&source, splitPageBytes](size_t i) {
+        return splitPageBytes != 0 && source.pageBytes(i) >= splitPageBytes;
+    };
+    const auto startTime = std::chrono::steady_clock::now();
+
+    #pragma omp parallel num_threads(numThreads)
+    {
+        std::unique_ptr<HtmlAnalyzer> analyzer = makeHtmlAnalyzer(parser);
+        std::unique_ptr<PageSource::Reader> reader = source.reader();
+        #pragma omp for schedule(dynamic)
+        for (int i = 0; i < static_cast<int>(source.size()); ++i) {
+            if (isSplit(i))
+                continue;
+            const PageCounts stats = analyzer->analyze(reader->read(i));
+
+            #pragma omp critical
+            {
+                urlStatMap.insert({firstIndex + i, stats});
+            }
+        }
+    }
+
+    std::unique_ptr<PageSource::Reader> reader = source.reader();
+    for (size_t i = 0; i < source.size(); ++i) {
+        if (!isSplit(i))
+            continue;
+        const boost::string_view page = reader->read(i);
+        urlStatMap.insert({firstIndex + static_cast<int>(i),
+                           countDomNodesParallel(page.data(), page.size(), numThreads)});
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+// Counts of every page by one analyzer backend, and the time they took
+struct AnalyzerRun {
+    double seconds = 0;
+    std::map<int, PageCounts> stats;
+};
+
+/**
+ * Prints the throughput of each backend run on the same pages, its totals
+ * and the pages on which its counts differ from those of the first one (the
+ * reference), with the first of them
+ *
+ * @param backends      names of the backends, the reference first
+ * @param runs          their runs
+ * @param numPages      pages analyzed
+ * @param totalBytes    bytes analyzed
+ * @param urls          names of the pages
+ * @param numThreads    threads the backends ran on
+ */
+void compareAnalyzers(const std::vector<std::string> & backends, const std::map<std::string, AnalyzerRun> & runs,
+                      size_t numPages, uint64_t totalBytes, const std::vector<std::string> & urls, unsigned numThreads)
+{
+    const std::string & reference = backends.front();
+    const std::map<int, PageCounts> & referenceStats = runs.at(reference).stats;
+
+    std::cout << std::endl << "Analyzers on " << numPages << " pages ("
+              << totalBytes / 1e6 << " MB), " << numThreads << " threads:" << std::endl
+              << "  " << std::setw(10) << std::left << "parser" << std::right
+              << std::setw(17) << "throughput"
+              << std::setw(12) << "# Nodes"
+              << std::setw(12) << "# Leaf"
+              << std::setw(12) << "# Div"
+              << "   pages differing from " << reference << std::endl;
+
+    auto printCounts = [](const PageCounts & counts) {
+        std::cout << std::get<0>(counts) << '/' << std::get<1>(counts) << '/' << std::get<2>(counts);
+    };
+
+    for (const std::string & backend : backends) {
+        const AnalyzerRun & run = runs.at(backend);
+        PageCounts totals;
+        unsigned differing = 0;
+        int firstDifference = -1;
+        for (const auto & pair : run.stats) {
+            std::get<0>(totals) += std::get<0>(pair.second);
+            std::get<1>(totals) += std::get<1>(pair.second);
+            std::get<2>(totals) += std::get<2>(pair.second);
+            if (pair.second != referenceStats.at(pair.first) && differing++ == 0)
+                firstDifference = pair.first;
+        }
+        std::cout << "  " << std::setw(10) << std::left << backend << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(2) << totalBytes / run.seconds / 1e6 << " MB/s"
+                  << std::defaultfloat
+                  << std::setw(12) << std::get<0>(totals)
+                  << std::setw(12) << std::get<1>(totals)
+                  << std::setw(12) << std::get<2>(totals)
+                  << std::setw(10) << differing << std::endl;
+        if (firstDifference >= 0) {
+            std::cout << "    first: " << urls[firstDifference] << ' ';
+            printCounts(run.stats.at(firstDifference));
+            std::cout << " vs ";
+            printCounts(referenceStats.at(firstDifference));
+            std::cout << std::endl;
+        }
+    }
+}
+
 int main(int argc, char * argv[])
 {
     std::vector<std::string> urls;
+    std::vector<std::string> args;
+    std::map<std::string, std::string> options;
+    parseArgs(argc, argv, args, options);
 
-    if (argc < 3) {
-        std::cerr << "Expecting 2 arguments <path_to_text_file_with_urls> <num_threads> " << std::endl;
+    // Pages on disk instead of URLs: the only argument is then the number
+    // of threads
+    const bool archiveInput = options.count("input-archives") != 0;
+    const bool localInput = archiveInput || options.count("input-dir") || options.count("input-files");
+    if (args.size() < (localInput ? 1u : 2u)) {
+        std::cerr << "Expecting 2 arguments <path_to_text_file_with_urls> <num_threads> " << std::endl
+                  << "         or 1 argument <num_threads> with --input-dir, --input-files or --input-archives" << std::endl
+                  << "Options:" << std::endl
+                  << "  --input-dir=DIR     analyze the html files under DIR (mapped, not fetched)" << std::endl
+                  << "  --input-files=A,B   analyze the given files" << std::endl
+                  << "  --input-archives=A,B  analyze the pages in .tar, .tar.gz, .tar.zst, .gz or .zst files," << std::endl
+                  << "                      decompressed in memory" << std::endl
+                  << "  --input-ext=LIST    extensions taken from --input-dir and tar archives (default "
+                  << kDefaultInputExtensions << ", empty for all)" << std::endl
+                  << "  --fetch-workers=N   concurrent fetches across all hosts (default "
+                  << kDefaultFetchWorkers << ")" << std::endl
+                  << "  --max-per-host=N    upper bound for a host's adaptive in-flight limit" << std::endl
+                  << "  --ktls              enable kernel TLS receive/send offload (Linux, OpenSSL 3)" << std::endl
+                  << "  --pipeline=N        pipeline up to N same-origin GET requests per connection" << std::endl
+                  << "  --proxy=HOST:PORT   tunnel all connections through an HTTP CONNECT proxy" << std::endl
+                  << "                      (default: $HTTPS_PROXY / $https_proxy)" << std::endl
+                  << "  --ca-file=PATH      additional trusted CA certificates (PEM)" << std::endl
+                  << "  --insecure          do not verify server certificates (unsafe)" << std::endl
+                  << "  --parser=NAME       analyzer backend: fast (the tokenizer, default), bitstack" << std::endl
+                  << "                      (nesting only, memory bounded by depth), dom (element tree)," << std::endl
+                  << "                      regex or spirit; --dom is --parser=dom" << std::endl
+                  << "  --compare[=A,B,...] also run these backends (default all) on the same pages and" << std::endl
+                  << "                      report their MB/s and the pages whose counts differ" << std::endl
+                  << "  --split-page-kb=N   count pages of at least N KB one at a time, split across all" << std::endl
+                  << "                      threads (default " << kDefaultSplitPageKb << ", 0 disables)" << std::endl;
         return -1;
     }
     
-    if (!bfs::exists(argv[1]))
-       std::cerr <<"Could not find input file"<< argv[1] 
+    // Analyzer backends, checked before anything is fetched
+    std::string parser = options.count("dom") ? "dom" : "fast";
+    if (options.count("parser"))
+        parser = options.at("parser");
+    std::vector<std::string> backends = { parser };
+    if (options.count("compare")) {
+        const std::string & list = options.at("compare");
+        for (const std::string & backend : list.empty() ? htmlAnalyzerNames() : splitList(list)) {
+            if (std::find(backends.begin(), backends.end(), backend) == backends.end())
+                backends.push_back(backend);
+        }
+    }
+    for (const std::string & backend : backends) {
+        if (!makeHtmlAnalyzer(backend)) {
+            std::cerr << "Unknown parser " << backend << "; expecting one of:";
+            for (const std::string & name : htmlAnalyzerNames())
+                std::cerr << ' ' << name;
+            std::cerr << std::endl;
+            return StatusCode::FATAL_ERROR;
+        }
+    }
+
+    if (!localInput && !bfs::exists(args[0]))
+       std::cerr <<"Could not find input file"<< args[0] 
        << ". Please provide a text file with Urls" << std::endl;
     
     unsigned short numThreadsRequested = 1;
     int maxThreadsOnSystem = omp_get_num_procs();
     try {
-        numThreadsRequested = boost::lexical_cast<unsigned short>(argv[2]);
+        numThreadsRequested = boost::lexical_cast<unsigned short>(args[localInput ? 0 : 1]);
         if (numThreadsRequested > maxThreadsOnSystem) {
             std::cout << "Cannot process with more threads than those available on this system (" 
                     << maxThreadsOnSystem << "). Limiting to " 
@@ -51,69 +488,122 @@ int main(int argc, char * argv[])
         std::cerr << "Could not understand the input for number of threads." << e.what() << '\n';
     }
     
-    std::ifstream infile(argv[1]);    
-    std::map<int, std::string> urlMap;
-    try {
-        if (infile.is_open())
-        {
-            int i = 0;
-            std::string line;
-            while (infile >> line)
+    std::vector<PageCharset> charsets;
+    std::unique_ptr<PageSource> source;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    omp_set_num_threads(numThreadsRequested);
+
+    const std::vector<std::string> extensions = splitList(options.count("input-ext") ? options.at("input-ext")
+                                                                                     : std::string(kDefaultInputExtensions));
+    if (archiveInput) {
+        // Read as a stream below
+    } else if (localInput) {
+        std::vector<InputFile> files;
+        if (options.count("input-dir"))
+            files = findInputFiles(options.at("input-dir"), extensions, numThreadsRequested);
+        if (options.count("input-files")) {
+            const std::vector<InputFile> listed = statInputFiles(splitList(options.at("input-files")),
+                                                                 numThreadsRequested);
+            files.insert(files.end(), listed.begin(), listed.end());
+        }
+        for (const InputFile & file : files)
+            urls.emplace_back(file.path);
+        charsets.resize(files.size());
+        source.reset(new MappedPages(std::move(files), charsets));
+    } else {
+        std::ifstream infile(args[0]);    
+        std::map<int, std::string> urlMap;
+        try {
+            if (infile.is_open())
             {
-                urls.emplace_back(line);
-                urlMap.insert({++i, line});
+                int i = 0;
+                std::string line;
+                while (infile >> line)
+                {
+                    urls.emplace_back(line);
+                    urlMap.insert({++i, line});
+                }
             }
+            infile.close();
+        } catch( const std::exception& ex) {
+            infile.close();
+            std::cout << "Failed to read input file :"<< args[0] <<  ex.what() << std::endl;
+            return StatusCode::FATAL_ERROR;
+        } 
+        catch(...) {
+            infile.close();
+            return StatusCode::FATAL_ERROR;
         }
-        infile.close();
-    } catch( const std::exception& ex) {
-        infile.close();
-        std::cout << "Failed to read input file :"<< argv[1] <<  ex.what() << std::endl;
-        return StatusCode::FATAL_ERROR;
-    } 
-    catch(...) {
-        infile.close();
-        return StatusCode::FATAL_ERROR;
-    }
-    
-    auto startTime = std::chrono::high_resolution_clock::now();
 
-    UrlContentGetter contentGetter;
-    std::vector<std::string> htmls;
-    for (int i = 0; i< static_cast<int>(urls.size()); ++i)
-    {
-        auto html = contentGetter.getUrlContent(urls[i]);
-        // Copy into new structure for later analysis
-        htmls.emplace_back(html);
+        const unsigned fetchWorkers = getUnsignedOption(options, "fetch-workers", kDefaultFetchWorkers);
+        const unsigned maxPerHost = getUnsignedOption(options, "max-per-host", fetchWorkers);
+        FetchOptions fetchOptions;
+        fetchOptions.enableKtls = options.count("ktls") != 0;
+        fetchOptions.pipelineDepth = getUnsignedOption(options, "pipeline", 0);
+        fetchOptions.proxy = proxyFromOptions(options);
+        fetchOptions.noProxy = noProxyFromOptions(options);
+        fetchOptions.verifyPeer = options.count("insecure") == 0;
+        if (options.count("ca-file"))
+            fetchOptions.caFile = options.at("ca-file");
+        FetchScheduler scheduler(fetchWorkers, maxPerHost, fetchOptions);
+        const double fetchCpuStart = processCpuSeconds();
+        std::vector<PageBuffer> htmls = scheduler.fetchAll(urls);
+        const double fetchCpuSeconds = processCpuSeconds() - fetchCpuStart;
+        scheduler.printHostStats(std::cout);
+        if (scheduler.bytesFetched() > 0)
+            std::cout << "Fetch CPU time " << fetchCpuSeconds << " seconds for "
+                      << scheduler.bytesFetched() / 1e6 << " MB ("
+                      << fetchCpuSeconds / (scheduler.bytesFetched() / 1e9) << " CPU seconds per GB, "
+                      << static_cast<double>(scheduler.bodyBytesCopied()) / scheduler.bytesFetched()
+                      << " body copies per byte after decryption)"
+                      << std::endl;
+        charsets.resize(htmls.size());
+        source.reset(new BufferedPages(std::move(htmls), scheduler.contentTypes(), charsets));
     }
-    int indx = 0;
-    
-    // Brute-force multi-threading
-    // With the knowledge that the current parsing code in getCleanDomTree
-    // is inefficient (and hence time-consuming) and assuming that html sizes 
-    // are large enough , the best use of multi-threading is for the following 
-    // loop. Additionally, writing the results atomically to an array will be 
-    // less costly than mapping to separate arrays and then reducing.  At this
-    // point this approach is the most maintainable with lower risks of errors.
-    std::map<int, std::tuple<uint64_t, uint64_t, uint64_t>> urlStatMap;
 
-    omp_set_num_threads(numThreadsRequested);
-    
-    #pragma omp parallel
-    {
-        #pragma omp for
-        for (int i=0; i < htmls.size(); ++i) {
-            // Pre-process the input HTML to remove special characters and other
-            // cruft except for the interesting tag content.
-            auto const& stats = getCleanDomTree(htmls[i]);
+    // Brute-force multi-threading
+    // One page per iteration, with one analyzer and one page reader per
+    // thread (files on disk are mapped by the thread that analyzes them);
+    // the analyzers keep no shared state, so pages are counted
+    // independently and only the result insertion is serialized. With the
+    // tokenizer, large pages are left out of the loop and then counted one
+    // at a time, each by all threads. With --compare every backend is run
+    // in turn on the same pages.
+    std::map<std::string, AnalyzerRun> runs;
+    size_t numPages = 0;
+    uint64_t analyzedBytes = 0;
+    const size_t splitPageBytes = parser != "fast" || numThreadsRequested < 2 ? 0
+        : static_cast<size_t>(getUnsignedOption(options, "split-page-kb", kDefaultSplitPageKb)) * 1024;
+    auto analyzeWithBackends = [&](PageSource & pages, int firstIndex) {
+        for (const std::string & backend : backends) {
+            AnalyzerRun & run = runs[backend];
+            run.seconds += analyzePages(backend, pages, numThreadsRequested, backend == parser ? splitPageBytes : 0,
+                                        run.stats, firstIndex);
+        }
+        numPages += pages.size();
+        for (size_t i = 0; i < pages.size(); ++i)
+            analyzedBytes += pages.pageBytes(i);
+    };
 
-            #pragma omp critical
-            {
-                urlStatMap.insert({i, {std::get<0>(stats), 
-                                std::get<1>(stats), 
-                                std::get<2>(stats)} });
+    ArchiveStats archiveStats;
+    if (archiveInput) {
+        // Each batch of pages out of the archives is analyzed, then dropped
+        archiveStats = streamArchives(splitList(options.at("input-archives")), extensions, numThreadsRequested,
+                                      [&](std::vector<ArchiveMember> & members) {
+            std::vector<PageBuffer> htmls;
+            for (ArchiveMember & member : members) {
+                urls.emplace_back(std::move(member.name));
+                htmls.emplace_back(std::move(member.data));
             }
-        }
+            std::vector<PageCharset> batchCharsets(htmls.size());
+            BufferedPages batch(std::move(htmls), std::vector<std::string>(members.size()), batchCharsets);
+            analyzeWithBackends(batch, static_cast<int>(charsets.size()));
+            charsets.insert(charsets.end(), batchCharsets.begin(), batchCharsets.end());
+        });
+    } else {
+        analyzeWithBackends(*source, 0);
     }
+    const std::map<int, PageCounts> & urlStatMap = runs[parser].stats;
 
     // Write out results in table
     std::cout << std::endl
@@ -123,41 +613,54 @@ int main(int argc, char * argv[])
               << std::setw(15) << "# Leaf Nodes" << "\t"
               << std::setw(15) << "# Div Nodes"
               << std::endl;
-    uint64_t index = 0;
     for (auto const& pair : urlStatMap)
     {
         auto stats = pair.second;
+        // Long urls and paths keep their tail, which tells pages apart
+        const std::string & url = urls[pair.first];
         std::cout 
                 << std::setw(5) << pair.first+1 << "\t" 
-                << std::setw(40) << urls[pair.first].substr(0, std::min(40u, static_cast<unsigned int>(urls[indx].size()))) << "\t"
+                << std::setw(40) << (url.size() > 40 ? "..." + url.substr(url.size() - 37) : url) << "\t"
                 << std::setw(15) << std::get<0>(stats) 
                 << std::setw(15) << std::get<1>(stats)
                 << std::setw(15) << std::get<2>(stats)
                 << std::endl;
     }
+
+    // Charsets of the pages, and what it took to parse them as UTF-8
+    std::map<std::string, unsigned> charsetPages;
+    unsigned transcodedPages = 0;
+    unsigned invalidPages = 0;
+    for (const PageCharset & charset : charsets) {
+        ++charsetPages[charset.name];
+        transcodedPages += charset.transcoded;
+        invalidPages += !charset.validUtf8;
+    }
+    if (!charsets.empty()) {
+        std::cout << std::endl << "Charsets:";
+        for (const auto & pair : charsetPages)
+            std::cout << ' ' << pair.first << " (" << pair.second << ')';
+        std::cout << "; " << transcodedPages << " pages transcoded to UTF-8, "
+                  << invalidPages << " with invalid UTF-8" << std::endl;
+    }
     
-    // Following code uses boost spirit, qi, and fusion libraries 
-    // to construct an abstract syntax tree to do more detailed
-    // parsing. However, the lack of complete grammar causes it to  
-    // fail un-gracefully. No effort was spent to make correct the
-    // root cause nor making it thread-safe. This initial implementation
-    // is abandoned in favor of the simpler regex parser above.
-    //  
-    /*
-     for (const auto& html : htmls)
-    {
-        const auto& html = htmls[i];
-        std::tuple<unsigned int, unsigned int, unsigned int> stats;
-        std::this_thread::sleep_for(5000ms);
-        if (!html.empty())
-           stats = parseHtml(html);
-        std::cout << "Num nodes" << std::get<0>(stats)
-            << "Num leaf nodes" << std::get<1>(stats)
-            << "Num Div nodes" << std::get<2>(stats)
-            << std::endl;
-    }
-    */
-     
+    // Decompression and analysis are timed apart: a batch is analyzed
+    // before the next one is decompressed
+    if (archiveInput) {
+        std::cout << std::endl << "Archives: " << archiveStats.compressedBytes / 1e6 << " MB decompressed to "
+                  << archiveStats.decompressedBytes / 1e6 << " MB in " << archiveStats.decompressSeconds
+                  << " seconds";
+        if (archiveStats.decompressedBytes > 0 && archiveStats.decompressSeconds > 0)
+            std::cout << " (" << archiveStats.decompressedBytes / archiveStats.decompressSeconds / 1e6 << " MB/s)";
+        std::cout << ", " << archiveStats.members << " pages";
+        if (analyzedBytes > 0 && runs[parser].seconds > 0)
+            std::cout << "; analysis (" << parser << ") " << analyzedBytes / runs[parser].seconds / 1e6 << " MB/s";
+        std::cout << std::endl;
+    }
+
+    if (options.count("compare"))
+        compareAnalyzers(backends, runs, numPages, analyzedBytes, urls, numThreadsRequested);
+
     auto endTime = std::chrono::high_resolution_clock::now();
     std::cout << "Elapsed time "
               << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count()/1000.
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Generates HtmlEntityTrie.hpp from the WHATWG list of named character
+references (https://html.spec.whatwg.org/entities.json).
+
+    python3 tools/gen_entity_trie.py entities.json [HtmlEntityTrie.hpp]
+
+The trie is laid out breadth-first, the children of a node consecutive and
+sorted by character; the replacement texts are stored once each, in the
+order their names come in that layout. Regenerating from the same list
+gives the same file.
+"""
+
+import json
+import os
+import sys
+
+
+class Node(object):
+    __slots__ = ('c', 'children', 'value')
+
+    def __init__(self, c):
+        self.c = c
+        self.children = {}
+        self.value = None
+
+
+def load_entities(path):
+    """Names without the leading '&' (with ';' where the list has it) and
+    their replacement text"""
+    with open(path, 'rb') as f:
+        entities = json.loads(f.read().decode('utf-8'))
+    return dict((name.lstrip('&'), entry['characters']) for name, entry in entities.items())
+
+
+def build_trie(entities):
+    root = Node('')
+    for name, value in entities.items():
+        node = root
+        for c in name:
+            node = node.children.setdefault(c, Node(c))
+        node.value = value
+    # Breadth-first, so the children of a node get consecutive indices
+    order = [root]
+    first_child = {}
+    i = 0
+    while i < len(order):
+        node = order[i]
+        first_child[id(node)] = len(order)
+        order.extend(node.children[c] for c in sorted(node.children))
+        i += 1
+    return order, first_child
+
+
+def generate(entities):
+    order, first_child = build_trie(entities)
+
+    values = b''
+    offsets = {}
+    for node in order:
+        if node.value is not None and node.value not in offsets:
+            offsets[node.value] = len(values)
+            values += node.value.encode('utf-8')
+
+    if len(order) > 0xFFFF or len(values) > 0xFFFF:
+        raise ValueError('the trie does not fit 16-bit indices')
+
+    rows = []
+    for node in order:
+        encoded = node.value.encode('utf-8') if node.value is not None else b''
+        if len(node.children) > 0xFF or len(encoded) > 0xFF:
+            raise ValueError('a node does not fit 8-bit counts')
+        rows.append("{'%s',%d,%d,%d,%d}" % (node.c if node.c else '\\0', len(node.children),
+                                            first_child[id(node)] if node.children else 0,
+                                            offsets[node.value] if node.value is not None else 0,
+                                            len(encoded)))
+    node_lines = ['    ' + ', '.join(rows[i:i + 6]) + ',' for i in range(0, len(rows), 6)]
+    value_lines = ['    "' + ''.join('\\x%02X' % b for b in bytearray(values[i:i + 24])) + '"'
+                   for i in range(0, len(values), 24)]
+
+    return '''#pragma once
+
+// Generated by tools/gen_entity_trie.py from the WHATWG entities.json; do
+// not edit.
+
+#include <cstddef>
+#include <cstdint>
+
+// The named character references of HTML (%(count)d names, with and without the
+// trailing ';' for the legacy ones), from the WHATWG entities.json, as a trie
+// laid out breadth-first: the children of a node are consecutive and sorted
+// by character, so a lookup is one binary search per input character. Node 0
+// is the root. The replacement text of a name is the valueLength bytes of
+// UTF-8 at valueOffset in kEntityValues; identical values are stored once.
+namespace html_detail {
+    struct EntityNode {
+        char c;                 // character that leads to this node
+        uint8_t childCount;
+        uint16_t firstChild;
+        uint16_t valueOffset;
+        uint8_t valueLength;    // 0 if no name ends here
+    };
+
+    constexpr EntityNode kEntityNodes[] = {
+%(nodes)s
+    };
+
+    const char kEntityValues[] =
+%(values)s;
+
+    // Names in the trie: the nodes a name ends at
+    constexpr size_t entityNameCount()
+    {
+        size_t count = 0;
+        for (const EntityNode & node : kEntityNodes)
+            count += node.valueLength != 0;
+        return count;
+    }
+
+    const size_t kEntityNameCount = %(count)d;
+    static_assert(entityNameCount() == kEntityNameCount, "every entity name has a node");
+}
+''' % {'count': len(entities), 'nodes': '\n'.join(node_lines), 'values': '\n'.join(value_lines)}
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        sys.stderr.write(__doc__)
+        return 2
+    output = argv[2] if len(argv) == 3 else os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                                          os.pardir, 'HtmlEntityTrie.hpp')
+    text = generate(load_entities(argv[1]))
+    with open(output, 'wb') as f:
+        f.write(text.encode('ascii'))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))